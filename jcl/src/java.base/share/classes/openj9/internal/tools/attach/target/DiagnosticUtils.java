@@ -83,6 +83,7 @@ public class DiagnosticUtils {
 	private static final String DIAGNOSTICS_DUMP_JAVA = "Dump.java"; //$NON-NLS-1$
 	private static final String DIAGNOSTICS_DUMP_SNAP = "Dump.snap"; //$NON-NLS-1$
 	private static final String DIAGNOSTICS_DUMP_SYSTEM = "Dump.system"; //$NON-NLS-1$
+	private static final String DIAGNOSTICS_DUMP_ALLOCPROFILE = "Dump.allocprofile"; //$NON-NLS-1$
 
 	/**
 	 * Get JVM statistics
@@ -368,6 +369,9 @@ public class DiagnosticUtils {
 	private static final String DIAGNOSTICS_DUMP_SYSTEM_HELP = "Create a native core file.%n" //$NON-NLS-1$
 			+ FORMAT_PREFIX + DIAGNOSTICS_DUMP_SYSTEM + FILE_PATH_HELP;
 
+	private static final String DIAGNOSTICS_DUMP_ALLOCPROFILE_HELP = "Write the live sampled allocations in pprof format. Requires -XX:+AllocationProfiler.%n" //$NON-NLS-1$
+			+ FORMAT_PREFIX + DIAGNOSTICS_DUMP_ALLOCPROFILE + FILE_PATH_HELP;
+
 	private static final String DIAGNOSTICS_JSTAT_CLASS_HELP = "Show JVM classloader statistics.%n" //$NON-NLS-1$
 			+ FORMAT_PREFIX + DIAGNOSTICS_STAT_CLASS + "%n" //$NON-NLS-1$
 			+ "NOTE: this utility might significantly affect the performance of the target VM.%n"; //$NON-NLS-1$
@@ -403,6 +407,9 @@ public class DiagnosticUtils {
 
 		commandTable.put(DIAGNOSTICS_DUMP_SYSTEM, DiagnosticUtils::doDump);
 		helpTable.put(DIAGNOSTICS_DUMP_SYSTEM, DIAGNOSTICS_DUMP_SYSTEM_HELP);
+
+		commandTable.put(DIAGNOSTICS_DUMP_ALLOCPROFILE, DiagnosticUtils::doDump);
+		helpTable.put(DIAGNOSTICS_DUMP_ALLOCPROFILE, DIAGNOSTICS_DUMP_ALLOCPROFILE_HELP);
 		
 		commandTable.put(DIAGNOSTICS_STAT_CLASS, DiagnosticUtils::getJstatClass);
 		helpTable.put(DIAGNOSTICS_STAT_CLASS, DIAGNOSTICS_JSTAT_CLASS_HELP);
@@ -0,0 +1,293 @@
+/*[INCLUDE-IF Sidecar18-SE]*/
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.jvm.format;
+
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.io.OutputStream;
+import java.io.OutputStreamWriter;
+import java.io.PrintWriter;
+import java.io.RandomAccessFile;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.channels.FileChannel;
+import java.nio.charset.StandardCharsets;
+import java.text.SimpleDateFormat;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.Comparator;
+import java.util.Date;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Locale;
+import java.util.Map;
+
+/**
+ * Converts a binary verbose GC log, written with -Xgc:verboseBinary, into XML.
+ *
+ * The file starts with a header identifying the layout and byte order, followed
+ * by fixed-layout records which were drained from several buffers. Records are
+ * reordered by sequence number. By default the text records are written out
+ * unchanged, which gives the verbose GC log the JVM would have written without
+ * -Xgc:verboseBinary. With -cycles, each cycle record is written as one XML
+ * element instead. Records of unknown types are skipped.
+ */
+public class VerboseGCFormat {
+	private static final String EYECATCHER = "J9VGCBIN"; //$NON-NLS-1$
+	private static final int BYTE_ORDER_MARK = 0x01020304;
+	private static final int SUPPORTED_VERSION = 3;
+	private static final int RECORD_ALIGNMENT = 8;
+
+	static final int RECORD_CYCLE_START = 1;
+	static final int RECORD_CYCLE_END = 2;
+	static final int RECORD_TEXT = 3;
+
+	private static final String[] CYCLE_TYPES = {
+		"unknown", //$NON-NLS-1$
+		"global", //$NON-NLS-1$
+		"scavenge", //$NON-NLS-1$
+		"partial gc", //$NON-NLS-1$
+		"global mark phase", //$NON-NLS-1$
+		"global garbage collect", //$NON-NLS-1$
+	};
+
+	/**
+	 * A J9VerboseBinaryRecordHeader and, for the cycle record types, the fields
+	 * of the J9VerboseBinaryCycleRecord which follows it, or for text records the text.
+	 */
+	static final class Record {
+		final long sequence;
+		final long timestamp;
+		final int type;
+		long hiresTimestamp;
+		long nurseryFreeBytes;
+		long nurseryTotalBytes;
+		long tenureFreeBytes;
+		long tenureTotalBytes;
+		int cycleType;
+		byte[] text;
+
+		Record(long sequence, long timestamp, int type) {
+			this.sequence = sequence;
+			this.timestamp = timestamp;
+			this.type = type;
+		}
+	}
+
+	/**
+	 * The records of a binary verbose GC log, sorted by sequence number.
+	 */
+	static final class Log {
+		final int version;
+		final long hiresFrequency;
+		final List<Record> records;
+
+		Log(int version, long hiresFrequency, List<Record> records) {
+			this.version = version;
+			this.hiresFrequency = hiresFrequency;
+			this.records = records;
+		}
+	}
+
+	public static void main(String args[]) {
+		boolean cycles = (args.length > 0) && "-cycles".equals(args[0]); //$NON-NLS-1$
+		int first = cycles ? 1 : 0;
+		if (((args.length - first) < 1) || ((args.length - first) > 2)) {
+			System.err.println("VerboseGCFormat [-cycles] <binary verbose GC log> [output file]"); //$NON-NLS-1$
+			System.exit(1);
+		}
+		boolean toFile = (2 == (args.length - first));
+		try {
+			Log log = readLog(args[first]);
+			OutputStream out = System.out;
+			if (toFile) {
+				out = new FileOutputStream(args[first + 1]);
+			}
+			try {
+				if (cycles) {
+					PrintWriter writer = new PrintWriter(new OutputStreamWriter(out, StandardCharsets.UTF_8));
+					writeXML(log, writer);
+					writer.flush();
+				} else {
+					writeText(log, out);
+				}
+				out.flush();
+			} finally {
+				if (toFile) {
+					out.close();
+				}
+			}
+		} catch (IOException e) {
+			System.err.println("VerboseGCFormat: " + e.getMessage()); //$NON-NLS-1$
+			System.exit(1);
+		}
+	}
+
+	/**
+	 * Read every record in the file, sorted by sequence number.
+	 * @param fileName the binary verbose GC log
+	 * @return the log
+	 * @throws IOException if the file cannot be read or is not a binary verbose GC log
+	 */
+	static Log readLog(String fileName) throws IOException {
+		ByteBuffer data;
+		try (RandomAccessFile file = new RandomAccessFile(fileName, "r")) { //$NON-NLS-1$
+			FileChannel channel = file.getChannel();
+			data = channel.map(FileChannel.MapMode.READ_ONLY, 0, channel.size());
+		}
+
+		byte[] eyecatcher = new byte[EYECATCHER.length()];
+		if (data.remaining() < (eyecatcher.length + 24)) {
+			throw new IOException(fileName + " is not a binary verbose GC log"); //$NON-NLS-1$
+		}
+		data.get(eyecatcher);
+		if (!EYECATCHER.equals(new String(eyecatcher, StandardCharsets.US_ASCII))) {
+			throw new IOException(fileName + " is not a binary verbose GC log"); //$NON-NLS-1$
+		}
+
+		/* the file is in the byte order of the JVM which wrote it */
+		data.order(ByteOrder.BIG_ENDIAN);
+		if (BYTE_ORDER_MARK != data.getInt(data.position())) {
+			data.order(ByteOrder.LITTLE_ENDIAN);
+		}
+		if (BYTE_ORDER_MARK != data.getInt()) {
+			throw new IOException(fileName + " has an unrecognized byte order mark"); //$NON-NLS-1$
+		}
+		int version = data.getInt();
+		if (SUPPORTED_VERSION != version) {
+			throw new IOException(fileName + " has unsupported version " + version); //$NON-NLS-1$
+		}
+		int headerSize = data.getInt();
+		int recordHeaderSize = data.getInt();
+		long hiresFrequency = data.getLong();
+		data.position(headerSize);
+
+		List<Record> records = new ArrayList<>();
+		while (data.remaining() >= recordHeaderSize) {
+			int recordStart = data.position();
+			long sequence = data.getLong();
+			long timestamp = data.getLong();
+			int type = data.getInt();
+			int length = data.getInt();
+			data.position(recordStart + recordHeaderSize);
+			if ((length < 0) || (length > data.remaining())) {
+				/* the JVM ended before the last record was complete */
+				break;
+			}
+			int payloadStart = data.position();
+			Record record = new Record(sequence, timestamp, type);
+			switch (type) {
+			case RECORD_CYCLE_START:
+			case RECORD_CYCLE_END:
+				record.hiresTimestamp = data.getLong();
+				record.nurseryFreeBytes = data.getLong();
+				record.nurseryTotalBytes = data.getLong();
+				record.tenureFreeBytes = data.getLong();
+				record.tenureTotalBytes = data.getLong();
+				record.cycleType = data.getInt();
+				records.add(record);
+				break;
+			case RECORD_TEXT:
+				record.text = new byte[length];
+				data.get(record.text);
+				records.add(record);
+				break;
+			default:
+				/* written by a newer JVM */
+				break;
+			}
+			int padding = (RECORD_ALIGNMENT - (length % RECORD_ALIGNMENT)) % RECORD_ALIGNMENT;
+			data.position(Math.min(data.limit(), payloadStart + length + padding));
+		}
+
+		Collections.sort(records, new Comparator<Record>() {
+			@Override
+			public int compare(Record r1, Record r2) {
+				return Long.compare(r1.sequence, r2.sequence);
+			}
+		});
+		return new Log(version, hiresFrequency, records);
+	}
+
+	static String getCycleType(int cycleType) {
+		if ((cycleType < 0) || (cycleType >= CYCLE_TYPES.length)) {
+			cycleType = 0;
+		}
+		return CYCLE_TYPES[cycleType];
+	}
+
+	/**
+	 * Write the text records in order, reproducing the text verbose GC log.
+	 */
+	static void writeText(Log log, OutputStream out) throws IOException {
+		for (Record record : log.records) {
+			if (RECORD_TEXT == record.type) {
+				out.write(record.text);
+			}
+		}
+	}
+
+	/**
+	 * Write one element per cycle record. The end of a cycle also reports the time since
+	 * the start of the most recent cycle of the same type.
+	 */
+	static void writeXML(Log log, PrintWriter out) {
+		SimpleDateFormat dateFormat = new SimpleDateFormat("yyyy-MM-dd'T'HH:mm:ss.SSS"); //$NON-NLS-1$
+		Map<Integer, Record> openCycles = new HashMap<>();
+
+		out.println("<?xml version=\"1.0\" ?>"); //$NON-NLS-1$
+		out.println();
+		out.println("<verbosegc format=\"binary\" version=\"" + log.version + "\">"); //$NON-NLS-1$ //$NON-NLS-2$
+		out.println();
+		for (Record record : log.records) {
+			if (RECORD_TEXT == record.type) {
+				continue;
+			}
+			StringBuilder element = new StringBuilder();
+			if (RECORD_CYCLE_START == record.type) {
+				element.append("<cycle-start"); //$NON-NLS-1$
+				openCycles.put(Integer.valueOf(record.cycleType), record);
+			} else {
+				element.append("<cycle-end"); //$NON-NLS-1$
+			}
+			element.append(" id=\"").append(record.sequence); //$NON-NLS-1$
+			element.append("\" type=\"").append(getCycleType(record.cycleType)); //$NON-NLS-1$
+			element.append("\" timestamp=\"").append(dateFormat.format(new Date(record.timestamp))); //$NON-NLS-1$
+			if (RECORD_CYCLE_END == record.type) {
+				Record start = openCycles.remove(Integer.valueOf(record.cycleType));
+				if ((null != start) && (0 != log.hiresFrequency)) {
+					double durationms = ((record.hiresTimestamp - start.hiresTimestamp) * 1000.0) / log.hiresFrequency;
+					element.append("\" contextid=\"").append(start.sequence); //$NON-NLS-1$
+					element.append("\" durationms=\"").append(String.format(Locale.ROOT, "%.3f", Double.valueOf(durationms))); //$NON-NLS-1$ //$NON-NLS-2$
+				}
+			}
+			element.append("\" nursery-free=\"").append(record.nurseryFreeBytes); //$NON-NLS-1$
+			element.append("\" nursery-total=\"").append(record.nurseryTotalBytes); //$NON-NLS-1$
+			element.append("\" tenure-free=\"").append(record.tenureFreeBytes); //$NON-NLS-1$
+			element.append("\" tenure-total=\"").append(record.tenureTotalBytes); //$NON-NLS-1$
+			element.append("\" />"); //$NON-NLS-1$
+			out.println(element);
+		}
+		out.println("</verbosegc>"); //$NON-NLS-1$
+	}
+}
@@ -78,6 +78,10 @@ J9::CodeGenerator::CodeGenerator() :
    _liveMonitors(NULL),
    _nodesSpineCheckedList(getTypedAllocator<TR::Node*>(TR::comp()->allocator())),
    _jniCallSites(getTypedAllocator<TR_Pair<TR_ResolvedMethod,TR::Instruction> *>(TR::comp()->allocator())),
+   _barrieredReferenceSlots(std::less<ReferenceSlot>(), ReferenceSlotAllocator(TR::comp()->trMemory()->heapMemoryRegion())),
+   _pendingBarrieredReferenceSlots(std::less<ReferenceSlot>(), ReferenceSlotAllocator(TR::comp()->trMemory()->heapMemoryRegion())),
+   _allocatedObjects(std::less<TR::Node*>(), NodeSetAllocator(TR::comp()->trMemory()->heapMemoryRegion())),
+   _elidedReadBarriers(std::less<TR::Node*>(), NodeSetAllocator(TR::comp()->trMemory()->heapMemoryRegion())),
    _monitorMapping(self()->comp()->trMemory(), 256),
    _dummyTempStorageRefNode(NULL)
    {
@@ -399,6 +403,13 @@ J9::CodeGenerator::lowerCompressedRefs(
       TR::Node *newLoad = TR::Node::createWithSymRef(loadOrStoreOp, 1, 1, address, symRef);
       newLoad->setByteCodeInfo(loadOrStoreNode->getByteCodeInfo());
 
+      if (newLoad->getOpCode().isReadBar() &&
+          !loadOrStoreNode->getOpCode().isReadBar() &&
+          self()->elideReadBarrier(newLoad))
+         {
+         TR::Node::recreate(newLoad, self()->comp()->il.opCodeForIndirectLoad(TR::Int32));
+         }
+
       if (loadOrStoreNode->isNonNull())
          newLoad->setIsNonZero(true);
 
@@ -621,6 +632,16 @@ J9::CodeGenerator::lowerTreesPreTreeTopVisit(TR::TreeTop *tt, vcount_t visitCoun
    }
 
 
+void
+J9::CodeGenerator::lowerTreesPostTreeTopVisit(TR::TreeTop *tt, vcount_t visitCount)
+   {
+   OMR::CodeGeneratorConnector::lowerTreesPostTreeTopVisit(tt, visitCount);
+
+   if (TR::Compiler->om.readBarrierType() == gc_modron_readbar_range_check)
+      self()->updateReadBarrierElisionState(tt);
+   }
+
+
 void
 J9::CodeGenerator::lowerTreesPreChildrenVisit(TR::Node *parent, TR::TreeTop *treeTop, vcount_t visitCount)
    {
@@ -757,6 +778,104 @@ J9::CodeGenerator::lowerTreesPreChildrenVisit(TR::Node *parent, TR::TreeTop *tre
 
    }
 
+// GC points are anchored either by the treetop itself or by one of its children
+//
+static bool
+treeMayGC(TR::Node *node)
+   {
+   if (node->canGCandReturn() ||
+       node->getOpCode().isResolveCheck() ||
+       node->hasUnresolvedSymbolReference())
+      return true;
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      {
+      TR::Node *child = node->getChild(i);
+      if (child->canGCandReturn() || child->hasUnresolvedSymbolReference())
+         return true;
+      }
+   return false;
+   }
+
+void
+J9::CodeGenerator::updateReadBarrierElisionState(TR::TreeTop *tt)
+   {
+   TR::Node *node = tt->getNode();
+
+   // A concurrent scavenge can only start or end at a GC point, and a barriered slot
+   // or a new object stays free of evacuated references until then. Other blocks may
+   // reach this one through a GC point, so nothing is carried across blocks.
+   //
+   if (node->getOpCodeValue() == TR::BBStart || treeMayGC(node))
+      {
+      _barrieredReferenceSlots.clear();
+      _pendingBarrieredReferenceSlots.clear();
+      _allocatedObjects.clear();
+      }
+   else
+      {
+      _barrieredReferenceSlots.insert(_pendingBarrieredReferenceSlots.begin(), _pendingBarrieredReferenceSlots.end());
+      _pendingBarrieredReferenceSlots.clear();
+      }
+
+   // the object is allocated after any collection the allocation triggers
+   //
+   if (node->getOpCode().isNew())
+      _allocatedObjects.insert(node);
+   else if (node->getNumChildren() > 0 && node->getFirstChild()->getOpCode().isNew())
+      _allocatedObjects.insert(node->getFirstChild());
+   }
+
+bool
+J9::CodeGenerator::elideReadBarrier(TR::Node *load)
+   {
+   static bool disableReadBarrierElision = feGetEnv("TR_disableReadBarrierElision") != NULL;
+   static bool verifyReadBarrierElision = feGetEnv("TR_verifyReadBarrierElision") != NULL;
+
+   // other barrier types are not concerned only with evacuated objects
+   //
+   if (disableReadBarrierElision ||
+       TR::Compiler->om.readBarrierType() != gc_modron_readbar_range_check ||
+       load->hasUnresolvedSymbolReference())
+      return false;
+
+   // only the x86 and Power evaluators can turn a kept barrier into a trap
+   //
+   if (verifyReadBarrierElision &&
+       !self()->comp()->target().cpu.isX86() &&
+       !self()->comp()->target().cpu.isPower())
+      return false;
+
+   TR::Node *address = load->getFirstChild();
+   TR::Node *object = address->getOpCode().isArrayRef() ? address->getFirstChild() : address;
+   ReferenceSlot slot(address, load->getSymbolReference()->getReferenceNumber());
+
+   // loads of the slots of a new object see only null or references stored since the allocation,
+   // and the first barriered load of a slot leaves it pointing at the copy of the object
+   //
+   bool redundant = _allocatedObjects.find(object) != _allocatedObjects.end() ||
+                    _barrieredReferenceSlots.find(slot) != _barrieredReferenceSlots.end();
+
+   if (redundant &&
+       performTransformation(self()->comp(), "%sEliding read barrier on %s [%p]\n", OPT_DETAILS, load->getOpCode().getName(), load))
+      {
+      if (!verifyReadBarrierElision)
+         return true;
+      _elidedReadBarriers.insert(load);
+      }
+   else
+      {
+      _pendingBarrieredReferenceSlots.insert(slot);
+      }
+   return false;
+   }
+
+bool
+J9::CodeGenerator::isElidedReadBarrier(TR::Node *node)
+   {
+   return _elidedReadBarriers.find(node) != _elidedReadBarriers.end();
+   }
+
 void
 J9::CodeGenerator::createReferenceReadBarrier(TR::TreeTop* treeTop, TR::Node* parent)
    {
@@ -769,6 +888,9 @@ J9::CodeGenerator::createReferenceReadBarrier(TR::TreeTop* treeTop, TR::Node* pa
 
    if (symbol == TR::comp()->getSymRefTab()->findGenericIntShadowSymbol() || symbol->isCollectedReference())
       {
+      if (self()->elideReadBarrier(parent))
+         return;
+
       TR::Node::recreate(parent, TR::ardbari);
       if (treeTop->getNode()->getOpCodeValue() == TR::NULLCHK                  &&
           treeTop->getNode()->getChild(0)->getOpCodeValue() != TR::PassThrough &&
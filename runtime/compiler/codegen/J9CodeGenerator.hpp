@@ -35,8 +35,11 @@ namespace J9 { typedef J9::CodeGenerator CodeGeneratorConnector; }
 
 #include "codegen/OMRCodeGenerator.hpp"
 
+#include <set>
 #include <stdint.h>
+#include <utility>
 #include "env/IO.hpp"
+#include "env/TypedAllocator.hpp"
 #include "env/jittypes.h"
 #include "infra/List.hpp"
 #include "infra/HashTab.hpp"
@@ -77,6 +80,8 @@ public:
 
    void lowerTreesPreChildrenVisit(TR::Node * parent, TR::TreeTop * treeTop, vcount_t visitCount);
 
+   void lowerTreesPostTreeTopVisit(TR::TreeTop *tt, vcount_t visitCount);
+
    void lowerTreeIfNeeded(TR::Node *node, int32_t childNumber, TR::Node *parent, TR::TreeTop *tt);
 
    void lowerDualOperator(TR::Node *parent, int32_t childNumber, TR::TreeTop *treeTop);
@@ -89,6 +94,32 @@ public:
 
    void createReferenceReadBarrier(TR::TreeTop* treeTop, TR::Node* parent);
 
+   /**
+    * \brief
+    *      Determines whether a reference load can be lowered without a concurrent scavenge read barrier.
+    *      A load cannot observe an evacuated object if no GC point lies between it and an earlier barriered
+    *      load of the same slot, or the allocation of the object it loads from, in the same block. Loads
+    *      which keep their barrier are remembered so that later loads of the same slot can be elided.
+    *      Only the range check barrier of the software concurrent scavenger is ever elided.
+    *
+    *      When TR_verifyReadBarrierElision is set, the barrier is kept but recorded so that the evaluator
+    *      can replace its slow path with a trap. Only the x86 and Power evaluators do so; on other targets
+    *      verification disables elision instead.
+    *
+    * \param load
+    *      the indirect reference load, with its address as first child
+    *
+    * \return
+    *      true if the load should be lowered without a read barrier. Otherwise, false.
+    */
+   bool elideReadBarrier(TR::Node *load);
+
+   /**
+    * \brief
+    *      Determines whether a read barrier node was kept only to verify that its elision is safe.
+    */
+   bool isElidedReadBarrier(TR::Node *node);
+
    TR::list<TR_Pair<TR_ResolvedMethod,TR::Instruction> *> &getJNICallSites() { return _jniCallSites; }  // registerAssumptions()
 
    // OSR, not code generator
@@ -315,6 +346,21 @@ private:
    
    TR::list<TR_Pair<TR_ResolvedMethod, TR::Instruction> *> _jniCallSites; // list of instrutions representing direct jni call sites
 
+   // concurrent scavenge read barrier elision, see elideReadBarrier()
+   //
+   typedef std::pair<TR::Node*, int32_t> ReferenceSlot; // address node and symbol reference number of a loaded slot
+   typedef TR::typed_allocator<ReferenceSlot, TR::Region &> ReferenceSlotAllocator;
+   typedef std::set<ReferenceSlot, std::less<ReferenceSlot>, ReferenceSlotAllocator> ReferenceSlotSet;
+   typedef TR::typed_allocator<TR::Node*, TR::Region &> NodeSetAllocator;
+   typedef std::set<TR::Node*, std::less<TR::Node*>, NodeSetAllocator> NodeSet;
+
+   ReferenceSlotSet _barrieredReferenceSlots;        // slots loaded with a read barrier since the last GC point in the current block
+   ReferenceSlotSet _pendingBarrieredReferenceSlots; // slots loaded with a read barrier in the current tree
+   NodeSet _allocatedObjects;                        // objects allocated since the last GC point in the current block
+   NodeSet _elidedReadBarriers;                      // read barriers kept to verify their elision
+
+   void updateReadBarrierElisionState(TR::TreeTop *tt);
+
    uint16_t changeParmLoadsToRegLoads(TR::Node*node, TR::Node **regLoads, TR_BitVector *globalRegsWithRegLoad, TR_BitVector &killedParms, vcount_t visitCount); // returns number of RegLoad nodes created
 
    static bool wantToPatchClassPointer(TR::Compilation *comp,
@@ -35,6 +35,7 @@
 #include "infra/Monitor.hpp"
 #include "runtime/CodeCacheManager.hpp"
 #include "control/CompilationRuntime.hpp"
+#include "control/JitProfileSnapshot.hpp"
 #include "env/ut_j9jit.h"
 #include "env/CompilerEnv.hpp"
 
@@ -182,6 +183,9 @@ TR_OptimizationPlan *TR::DefaultCompilationStrategy::processEvent(TR_MethodEvent
          // use the counts to determine the first level of compilation
          // the level of compilation can be changed later on if option subsets are present
          hotnessLevel = TR::DefaultCompilationStrategy::getInitialOptLevel(event->_j9method);
+         // methods that got hot in the run that wrote the profile snapshot go straight to that level
+         if (compInfo->getProfileSnapshot())
+            hotnessLevel = compInfo->getProfileSnapshot()->getFirstCompilationOptLevel(event->_j9method, hotnessLevel);
          if (hotnessLevel == veryHot && // we probably want to profile
             !TR::Options::getCmdLineOptions()->getOption(TR_DisableProfiling) &&
              TR::Recompilation::countingSupported() &&
@@ -61,6 +61,7 @@ class TR_FilterBST;
 class TR_FrontEnd;
 class TR_HWProfiler;
 class TR_J9VMBase;
+class TR_JitProfileSnapshot;
 class TR_LowPriorityCompQueue;
 class TR_OptimizationPlan;
 class TR_PersistentMethodInfo;
@@ -211,6 +212,113 @@ class TR_JProfilingQueue
    };
 
 
+// Histogram of the time compilation requests spend waiting in a queue.
+// Bucket i counts waits in the [2^(i-1), 2^i) ms interval; bucket 0 counts
+// waits shorter than 1 ms and the last bucket collects everything above.
+// Must be updated with the compilation queue monitor in hand.
+class TR_CompQueueWaitTimeHistogram
+   {
+   public:
+      static const int32_t NUM_BUCKETS = 16;
+      TR_CompQueueWaitTimeHistogram() : _numSamples(0), _totalWaitMs(0), _maxWaitMs(0)
+         {
+         for (int32_t i = 0; i < NUM_BUCKETS; i++)
+            _buckets[i] = 0;
+         }
+      void update(uint64_t waitMs);
+      uint32_t getNumSamples() const { return _numSamples; }
+      void print(const char *queueName) const; // writes to the verbose log
+   private:
+      uint32_t _buckets[NUM_BUCKETS];
+      uint32_t _numSamples;
+      uint64_t _totalWaitMs;
+      uint64_t _maxWaitMs;
+   };
+
+
+// Policy that decides the order in which requests of equal priority are
+// served from the main compilation queue. Priorities always take precedence;
+// the policy only breaks ties. All methods must be called with the
+// compilation queue monitor in hand.
+class TR_CompQueueSchedulingPolicy
+   {
+   public:
+      TR_PERSISTENT_ALLOC(TR_Memory::PersistentInfo); // TODO: define its own category
+      enum Kind
+         {
+         PRIORITY_FIFO = 0, // requests of equal priority are served in arrival order (default)
+         WEIGHTED_FAIR,     // requests of equal priority are interleaved across class loaders
+         NUM_KINDS
+         };
+      // Builds the policy selected with -Xjit:compQueueSchedulingPolicy=
+      static TR_CompQueueSchedulingPolicy *allocate(TR::CompilationInfo *compInfo);
+
+      virtual const char *getName() const = 0;
+      // Invoked every time 'entry' is (re)inserted in the main queue
+      virtual void notifyQueued(TR_MethodToBeCompiled *entry) {}
+      // Returns true if 'entry' must be placed ahead of 'queued'; both have the same priority
+      virtual bool precedes(const TR_MethodToBeCompiled *entry, const TR_MethodToBeCompiled *queued) const { return false; }
+      // Invoked when a compilation thread takes 'entry' out of the main queue
+      virtual void notifyDequeued(TR_MethodToBeCompiled *entry, uint64_t waitTimeMs) {}
+      virtual void purgeEntriesOnClassLoaderUnloading(J9ClassLoader *j9classLoader) {}
+      virtual void printStats() const {}
+   protected:
+      TR_CompQueueSchedulingPolicy(TR::CompilationInfo *compInfo) : _compInfo(compInfo) {}
+      TR::CompilationInfo *_compInfo;
+   };
+
+// Default policy: priority order, then arrival order
+class TR_PriorityFIFOSchedulingPolicy : public TR_CompQueueSchedulingPolicy
+   {
+   public:
+      TR_PriorityFIFOSchedulingPolicy(TR::CompilationInfo *compInfo) : TR_CompQueueSchedulingPolicy(compInfo) {}
+      virtual const char *getName() const { return "priority-fifo"; }
+   };
+
+// Self-clocked weighted fair queuing where each class loader is a tenant.
+// A request is tagged with a virtual finish time computed from the tenant's
+// last finish time and the request weight scaled by the tenant weight.
+// Requests of equal priority are served in increasing order of their tags,
+// so a burst of requests from one application cannot starve the others.
+class TR_WeightedFairSchedulingPolicy : public TR_CompQueueSchedulingPolicy
+   {
+   public:
+      static const uint32_t MAX_TENANTS = 64; // power of two for cheap modulo
+      static const uint32_t WEIGHT_SCALE = 64;
+      TR_WeightedFairSchedulingPolicy(TR::CompilationInfo *compInfo);
+      virtual const char *getName() const { return "weighted-fair"; }
+      virtual void notifyQueued(TR_MethodToBeCompiled *entry);
+      virtual bool precedes(const TR_MethodToBeCompiled *entry, const TR_MethodToBeCompiled *queued) const
+         { return entry->_virtualFinishTime < queued->_virtualFinishTime; }
+      virtual void notifyDequeued(TR_MethodToBeCompiled *entry, uint64_t waitTimeMs);
+      virtual void purgeEntriesOnClassLoaderUnloading(J9ClassLoader *j9classLoader);
+      virtual void printStats() const;
+
+      struct Tenant
+         {
+         J9ClassLoader *_classLoader; // this is the key; NULL means the slot is free
+         uint64_t       _lastFinishTime; // virtual finish time of the last request queued by this tenant
+         uint32_t       _weight; // share of the compilation threads relative to other tenants
+         uint32_t       _numQueued;
+         uint32_t       _numDequeued;
+         uint64_t       _totalWaitMs;
+         void initialize(J9ClassLoader *classLoader, uint32_t weight)
+            {
+            _classLoader = classLoader; _lastFinishTime = 0; _weight = weight;
+            _numQueued = 0; _numDequeued = 0; _totalWaitMs = 0;
+            }
+         };
+   private:
+      static uint32_t hash(J9ClassLoader *classLoader) { return ((uintptr_t)classLoader >> 4) & (MAX_TENANTS - 1); }
+      J9ClassLoader *getClassLoader(TR_MethodToBeCompiled *entry) const;
+      Tenant *findTenant(J9ClassLoader *classLoader, bool create);
+
+      Tenant   _tenants[MAX_TENANTS];
+      Tenant   _overflowTenant; // shared by class loaders that do not fit in _tenants
+      uint64_t _virtualTime; // finish time of the last request dequeued
+   };
+
+
 // Supporting class for getting information on density of samples
 class TR_JitSampleInfo
    {
@@ -668,6 +776,7 @@ public:
                                                            CompilationPriority priority, TR_J9VMBase *fe);
    void changeCompReqFromAsyncToSync(J9Method * method);
    int32_t                promoteMethodInAsyncQueue(J9Method * method, void *pc);
+   void                   promoteAgedUpgradeRequests();
    TR_MethodToBeCompiled *getNextMethodToBeCompiled(TR::CompilationInfoPerThread *compInfoPT, bool compThreadCameOutOfSleep, TR_CompThreadActions*);
    TR_MethodToBeCompiled *peekNextMethodToBeCompiled();
    TR_MethodToBeCompiled *getMethodQueue() { return _methodQueue; }
@@ -976,6 +1085,14 @@ public:
 
    TR_JProfilingQueue &getJProfilingCompQueue() { return _JProfilingQueue; }
 
+   enum CompQueueKind { MAIN_QUEUE = 0, LOW_PRIORITY_QUEUE, JPROFILING_QUEUE, NUM_COMP_QUEUE_KINDS };
+   TR_CompQueueSchedulingPolicy *getCompQueueSchedulingPolicy() const { return _compQueueSchedulingPolicy; }
+   void setCompQueueSchedulingPolicy(TR_CompQueueSchedulingPolicy *policy) { _compQueueSchedulingPolicy = policy; }
+   TR_JitProfileSnapshot *getProfileSnapshot() const { return _profileSnapshot; }
+   void setProfileSnapshot(TR_JitProfileSnapshot *snapshot) { _profileSnapshot = snapshot; }
+   void updateCompQueueWaitTime(CompQueueKind queueKind, TR_MethodToBeCompiled *entry);
+   void printCompQueueWaitTimeStats() const;
+
    TR_JitSampleInfo &getJitSampleInfoRef() { return _jitSampleInfo; }
    TR_InterpreterSamplingTracking *getInterpSamplTrackingInfo() const { return _interpSamplTrackingInfo; }
 
@@ -1008,6 +1125,8 @@ public:
          newlyExtendedClasses[clazz] |= inProgress;
       }
    void setNewlyExtendedClasses(PersistentUnorderedMap<TR_OpaqueClassBlock*, uint8_t> *it) { _newlyExtendedClasses = it; }
+   PersistentUnorderedSet<TR_OpaqueClassBlock*> *getClassesPrefetchedToServer() const { return _classesPrefetchedToServer; }
+   void setClassesPrefetchedToServer(PersistentUnorderedSet<TR_OpaqueClassBlock*> *it) { _classesPrefetchedToServer = it; }
    void markCHTableUpdateDone(uint8_t threadId) { _chTableUpdateFlags |= (1 << threadId); }
    void resetCHTableUpdateDone(uint8_t threadId) { _chTableUpdateFlags &= ~(1 << threadId); }
    uint8_t getCHTableUpdateDone() const { return _chTableUpdateFlags; }
@@ -1199,6 +1318,11 @@ private:
    //--------------
    TR_LowPriorityCompQueue _lowPriorityCompilationScheduler;
    TR_JProfilingQueue      _JProfilingQueue;
+   TR_CompQueueSchedulingPolicy *_compQueueSchedulingPolicy; // orders requests of equal priority in _methodQueue
+   TR_CompQueueWaitTimeHistogram _compQueueWaitTimes[NUM_COMP_QUEUE_KINDS];
+   uint64_t                _lastCompQueueAgingTime; // ms; last time the queue was scanned for aged upgrade requests
+   uint32_t                _statNumAgedUpgradePromotions;
+   TR_JitProfileSnapshot  *_profileSnapshot; // NULL unless -Xjit:profileSnapshotFile= is used
 
    TR::CompilationTracingFacility _compilationTracingFacility; // Must be initialized before using
    TR_CpuEntitlement _cpuEntitlement;
@@ -1224,6 +1348,7 @@ private:
    TR::Monitor                   *_sequencingMonitor; // Used for ordering outgoing messages at the client
    uint32_t                      _compReqSeqNo; // seqNo for outgoing messages at the client
    PersistentUnorderedMap<TR_OpaqueClassBlock*, uint8_t> *_newlyExtendedClasses; // JITServer table of newly extended classes
+   PersistentUnorderedSet<TR_OpaqueClassBlock*> *_classesPrefetchedToServer; // JITServer classes whose ROMClass was sent with a compilation request
    uint8_t                       _chTableUpdateFlags;
    uint32_t                      _localGCCounter; // Number of local gc cycles done
    std::string                   _sslRootCerts;
@@ -1145,6 +1145,7 @@ TR::CompilationInfo::CompilationInfo(J9JITConfig *jitConfig) :
    _sequencingMonitor = TR::Monitor::create("JIT-SequencingMonitor");
    _compReqSeqNo = 0;
    _newlyExtendedClasses = NULL;
+   _classesPrefetchedToServer = NULL;
    _chTableUpdateFlags = 0;
    _localGCCounter = 0;
 #endif /* defined(J9VM_OPT_JITSERVER) */
@@ -3179,6 +3180,13 @@ void TR::CompilationInfo::stopCompilationThreads()
       fprintf(stderr, "Time spent relocating all AOT methods: %u ms\n", this->getAotRelocationTime()/1000);
       }
 
+   if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerbosePerformance))
+      {
+      acquireCompMonitor(vmThread);
+      printCompQueueWaitTimeStats();
+      releaseCompMonitor(vmThread);
+      }
+
    static char * printCompMem = feGetEnv("TR_PrintCompMem");
    static char * printCCUsage = feGetEnv("TR_PrintCodeCacheUsage");
 
@@ -3217,6 +3225,7 @@ void TR::CompilationInfo::stopCompilationThreads()
       {
       if (trPersistentMemory)
          trPersistentMemory->printMemStats();
+      TR::Compiler->persistentAllocator().printStatistics(false);
       }
 
    TR_DataCacheManager::getManager()->printStatistics();
@@ -3373,6 +3382,9 @@ void TR::CompilationInfo::stopCompilationThreads()
          iProfiler->printStats();
          }
       }
+   static char *printJITServerPrefetchStats = feGetEnv("TR_PrintJITServerPrefetchStats");
+   if (printJITServerPrefetchStats && getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER)
+      JITServerHelpers::printJITServerPrefetchStats(_jitConfig);
    static char *printJITServerConnStats = feGetEnv("TR_PrintJITServerConnStats");
    if (printJITServerConnStats)
       {
@@ -3721,7 +3733,9 @@ IDATA J9THREAD_PROC protectedCompilationThreadProc(J9PortLibrary *, TR::Compilat
       }
 
 #endif
+   TR::Compiler->persistentAllocator().attachThreadCache();
    compInfoPT->run();
+   TR::Compiler->persistentAllocator().releaseThreadCache();
    compInfoPT->setCompilationThreadState(COMPTHREAD_STOPPING);
 
    compInfo->debugPrint(compThread, "\tstopping compilation thread loop\n");
@@ -3831,6 +3845,8 @@ void
 TR::CompilationInfoPerThread::doSuspend()
    {
    _compInfo.setSuspendThreadDueToLowPhysicalMemory(false);
+   // A suspended thread may stay idle for a long time; don't let it hold on to cached persistent memory
+   TR::Compiler->persistentAllocator().releaseThreadCache();
    getCompThreadMonitor()->enter();
    setCompilationThreadState(COMPTHREAD_SUSPENDED);
    _compInfo.releaseCompMonitor(getCompilationThread());   // release the queue monitor before waiting
@@ -3840,6 +3856,7 @@ TR::CompilationInfoPerThread::doSuspend()
    setVMThreadNameWithFlag(getCompilationThread(), getCompilationThread(), getActiveThreadName(), 1);
    getCompThreadMonitor()->exit();
    _compInfo.acquireCompMonitor(getCompilationThread());
+   TR::Compiler->persistentAllocator().attachThreadCache();
    }
 
 J9::J9SegmentCache
@@ -4829,9 +4846,20 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
    return cur;
    }
 
+// Returns true if 'entry' must be placed ahead of 'queued' in the main queue
+static bool
+entryGoesBefore(TR_CompQueueSchedulingPolicy *policy, TR_MethodToBeCompiled *entry, TR_MethodToBeCompiled *queued)
+   {
+   if (queued->_priority != entry->_priority)
+      return queued->_priority < entry->_priority;
+   // Equal priorities: let the scheduling policy break the tie
+   return policy && policy->precedes(entry, queued);
+   }
+
 //--------------------------- queueEntry ---------------------------------
 // Insert the compilation request in the queue at the appropriate place
-// based on its priority. Must have compilationQueueMonitor in hanb
+// based on its priority; ties are broken by the scheduling policy.
+// Must have compilationQueueMonitor in hanb
 //------------------------------------------------------------------------
 void TR::CompilationInfo::queueEntry(TR_MethodToBeCompiled *entry)
    {
@@ -4839,7 +4867,11 @@ void TR::CompilationInfo::queueEntry(TR_MethodToBeCompiled *entry)
 
    entry->_freeTag |= ENTRY_QUEUED;
 
-   if (!_methodQueue || _methodQueue->_priority < entry->_priority)
+   TR_CompQueueSchedulingPolicy *policy = getCompQueueSchedulingPolicy();
+   if (policy)
+      policy->notifyQueued(entry);
+
+   if (!_methodQueue || entryGoesBefore(policy, entry, _methodQueue))
       {
       entry->_next = _methodQueue;
       _methodQueue = entry;
@@ -4848,7 +4880,7 @@ void TR::CompilationInfo::queueEntry(TR_MethodToBeCompiled *entry)
       {
       for (TR_MethodToBeCompiled *prev = _methodQueue; ; prev = prev->_next)
          {
-         if (!prev->_next || prev->_next->_priority < entry->_priority)
+         if (!prev->_next || entryGoesBefore(policy, entry, prev->_next))
             {
             entry->_next = prev->_next;
             prev->_next = entry;
@@ -4996,6 +5028,60 @@ int32_t TR::CompilationInfo::promoteMethodInAsyncQueue(J9Method * method, void *
    return i;
    }
 
+//----------------------- promoteAgedUpgradeRequests -------------------------
+// Upgrade requests that have been waiting in the main queue for longer than
+// the latency budget are promoted to CP_ASYNC_MAX, so that a burst of first
+// time compilations cannot starve the recompilation of hot methods.
+// To limit overhead, the queue is scanned at most 4 times per budget period.
+// Must have compilationQueueMonitor in hand
+//----------------------------------------------------------------------------
+void TR::CompilationInfo::promoteAgedUpgradeRequests()
+   {
+   int32_t budget = TR::Options::_compQueueUpgradeLatencyBudget;
+   if (budget <= 0)
+      return;
+   uint64_t crtTime = getPersistentInfo()->getElapsedTime();
+   if (crtTime < _lastCompQueueAgingTime + (budget >> 2))
+      return;
+   _lastCompQueueAgingTime = crtTime;
+
+   TR_MethodToBeCompiled *promotedList = NULL;
+   TR_MethodToBeCompiled *prev = NULL;
+   TR_MethodToBeCompiled *cur = _methodQueue;
+   while (cur)
+      {
+      TR_MethodToBeCompiled *next = cur->_next;
+      if (cur->_oldStartPC && // upgrade request
+          cur->_priority < CP_ASYNC_MAX &&
+          crtTime > cur->_entryTime + budget)
+         {
+         // take the request out; it will be put back at its new place below
+         if (prev)
+            prev->_next = next;
+         else
+            _methodQueue = next;
+         cur->_priority = CP_ASYNC_MAX;
+         cur->_next = promotedList;
+         promotedList = cur;
+         _statNumAgedUpgradePromotions++;
+         if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseCompileRequest))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_CR, "Promoted upgrade request %p after waiting %u ms in comp queue",
+               cur, (uint32_t)(crtTime - cur->_entryTime));
+         }
+      else
+         {
+         prev = cur;
+         }
+      cur = next;
+      }
+   while (promotedList)
+      {
+      TR_MethodToBeCompiled *next = promotedList->_next;
+      queueEntry(promotedList);
+      promotedList = next;
+      }
+   }
+
 void TR::CompilationInfo::changeCompReqFromAsyncToSync(J9Method * method)
    {
 
@@ -5110,6 +5196,8 @@ TR::CompilationInfo::getNextMethodToBeCompiled(TR::CompilationInfoPerThread *com
    {
    TR_MethodToBeCompiled *m = NULL;
    *compThreadAction = PROCESS_ENTRY;
+   if (_methodQueue)
+      promoteAgedUpgradeRequests();
    if (_methodQueue)
       {
       // If the request is sync or AOT load or InstantReplay, take it now
@@ -5215,6 +5303,7 @@ TR::CompilationInfo::getNextMethodToBeCompiled(TR::CompilationInfoPerThread *com
       if (m) // A request has been dequeued
          {
          updateCompQueueAccountingOnDequeue(m);
+         updateCompQueueWaitTime(MAIN_QUEUE, m);
          }
       }
    // When no request is in the main queue we can look in the low priority queue
@@ -5236,6 +5325,8 @@ TR::CompilationInfo::getNextMethodToBeCompiled(TR::CompilationInfoPerThread *com
       else
          {
          m = getLowPriorityCompQueue().extractFirstLPQRequest();
+         if (m)
+            updateCompQueueWaitTime(LOW_PRIORITY_QUEUE, m);
          }
       }
    // Now let's look in the JProfiling queue
@@ -5256,6 +5347,8 @@ TR::CompilationInfo::getNextMethodToBeCompiled(TR::CompilationInfoPerThread *com
       else
          {
          m = getJProfilingCompQueue().extractFirstCompRequest();
+         if (m)
+            updateCompQueueWaitTime(JPROFILING_QUEUE, m);
          }
       }
    else
@@ -5275,6 +5368,30 @@ TR::CompilationInfo::getNextMethodToBeCompiled(TR::CompilationInfoPerThread *com
    return m;
    }
 
+// Must have compilationQueueMonitor in hand
+void TR::CompilationInfo::updateCompQueueWaitTime(CompQueueKind queueKind, TR_MethodToBeCompiled *entry)
+   {
+   uint64_t crtTime = getPersistentInfo()->getElapsedTime();
+   uint64_t waitTimeMs = crtTime > entry->_entryTime ? crtTime - entry->_entryTime : 0;
+   _compQueueWaitTimes[queueKind].update(waitTimeMs);
+   if (queueKind == MAIN_QUEUE && getCompQueueSchedulingPolicy())
+      getCompQueueSchedulingPolicy()->notifyDequeued(entry, waitTimeMs);
+   }
+
+void TR::CompilationInfo::printCompQueueWaitTimeStats() const
+   {
+   static const char * const queueNames[NUM_COMP_QUEUE_KINDS] = { "main", "low priority", "JProfiling" };
+   for (int32_t i = 0; i < NUM_COMP_QUEUE_KINDS; i++)
+      {
+      if (_compQueueWaitTimes[i].getNumSamples() > 0)
+         _compQueueWaitTimes[i].print(queueNames[i]);
+      }
+   if (_statNumAgedUpgradePromotions > 0)
+      TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "Upgrade requests promoted after exceeding the latency budget: %u", _statNumAgedUpgradePromotions);
+   if (getCompQueueSchedulingPolicy())
+      getCompQueueSchedulingPolicy()->printStats();
+   }
+
 //----------------------------- computeCompThreadSleepTime ----------------------
 // Compute how much the compilation thread should sleep for throttling purposes
 // Parameters: compilationTimeMs is the wall clock time spent by previous
@@ -7491,7 +7608,7 @@ TR::CompilationInfoPerThreadBase::postCompilationTasks(J9VMThread * vmThread,
          if (_compInfo.getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER)
             _compiler->cg()->getCodeCache()->resetCodeCache();
 #endif /* defined(J9VM_OPT_JITSERVER) */
-         _compiler->cg()->getCodeCache()->unreserve();
+         _compiler->cg()->getCodeCache()->releaseReservation();
          _compiler->cg()->setCodeCache(0);
          }
       // Unreserve the data cache
@@ -12201,6 +12318,152 @@ void TR_LowPriorityCompQueue::printStats() const
    fprintf(stderr, "   Bypass ocurrences= %4u (normal comp req hapened before the fast LPQ comp req)\n", _STAT_bypass);
    }
 
+void TR_CompQueueWaitTimeHistogram::update(uint64_t waitMs)
+   {
+   int32_t bucket = 0;
+   for (uint64_t w = waitMs; w > 0 && bucket < NUM_BUCKETS - 1; w >>= 1)
+      bucket++;
+   _buckets[bucket]++;
+   _numSamples++;
+   _totalWaitMs += waitMs;
+   if (waitMs > _maxWaitMs)
+      _maxWaitMs = waitMs;
+   }
+
+void TR_CompQueueWaitTimeHistogram::print(const char *queueName) const
+   {
+   TR_VerboseLog::vlogAcquire();
+   TR_VerboseLog::writeLine(TR_Vlog_PERF, "Wait time in %s compilation queue: requests=%u avg=%llu ms max=%llu ms",
+      queueName, _numSamples, (unsigned long long)(_numSamples ? _totalWaitMs / _numSamples : 0), (unsigned long long)_maxWaitMs);
+   for (int32_t i = 0; i < NUM_BUCKETS; i++)
+      {
+      if (_buckets[i] == 0)
+         continue;
+      uint32_t lowerBound = i == 0 ? 0 : 1 << (i - 1);
+      if (i < NUM_BUCKETS - 1)
+         TR_VerboseLog::writeLine(TR_Vlog_PERF, "   [%6u, %6u) ms: %6u (%5.1f%%)", lowerBound, 1 << i, _buckets[i], _buckets[i] * 100.0 / _numSamples);
+      else
+         TR_VerboseLog::writeLine(TR_Vlog_PERF, "   [%6u,    inf) ms: %6u (%5.1f%%)", lowerBound, _buckets[i], _buckets[i] * 100.0 / _numSamples);
+      }
+   TR_VerboseLog::vlogRelease();
+   }
+
+TR_CompQueueSchedulingPolicy *
+TR_CompQueueSchedulingPolicy::allocate(TR::CompilationInfo *compInfo)
+   {
+   switch (TR::Options::_compQueueSchedulingPolicy)
+      {
+      case WEIGHTED_FAIR:
+         return new (PERSISTENT_NEW) TR_WeightedFairSchedulingPolicy(compInfo);
+      default:
+         TR_ASSERT(TR::Options::_compQueueSchedulingPolicy == PRIORITY_FIFO, "Unknown compilation queue scheduling policy %d", TR::Options::_compQueueSchedulingPolicy);
+         return new (PERSISTENT_NEW) TR_PriorityFIFOSchedulingPolicy(compInfo);
+      }
+   }
+
+TR_WeightedFairSchedulingPolicy::TR_WeightedFairSchedulingPolicy(TR::CompilationInfo *compInfo)
+   : TR_CompQueueSchedulingPolicy(compInfo), _virtualTime(0)
+   {
+   for (uint32_t i = 0; i < MAX_TENANTS; i++)
+      _tenants[i].initialize(NULL, 1);
+   _overflowTenant.initialize(NULL, 1);
+   }
+
+J9ClassLoader *
+TR_WeightedFairSchedulingPolicy::getClassLoader(TR_MethodToBeCompiled *entry) const
+   {
+   // At the server the J9Method belongs to the client and cannot be dereferenced
+   if (entry->isOutOfProcessCompReq())
+      return NULL;
+   J9Method *method = entry->getMethodDetails().getMethod();
+   return method ? J9_CLASS_FROM_METHOD(method)->classLoader : NULL;
+   }
+
+// Returns the tenant for the given class loader. If the loader is not known and
+// 'create' is true, a new tenant is added; when the table is full, class loaders
+// share the overflow tenant. Returns NULL only if 'create' is false and the
+// loader is not found.
+TR_WeightedFairSchedulingPolicy::Tenant *
+TR_WeightedFairSchedulingPolicy::findTenant(J9ClassLoader *classLoader, bool create)
+   {
+   if (!classLoader)
+      return &_overflowTenant;
+   Tenant *freeSlot = NULL;
+   uint32_t index = hash(classLoader);
+   for (uint32_t i = 0; i < MAX_TENANTS; i++, index = (index + 1) & (MAX_TENANTS - 1))
+      {
+      Tenant *tenant = _tenants + index;
+      if (tenant->_classLoader == classLoader)
+         return tenant;
+      if (!tenant->_classLoader && !freeSlot)
+         freeSlot = tenant;
+      }
+   if (!create)
+      return NULL;
+   if (!freeSlot)
+      return &_overflowTenant;
+
+   uint32_t weight = 1;
+   if (classLoader == _compInfo->getJITConfig()->javaVM->systemClassLoader && TR::Options::_compQueueBootstrapLoaderWeight > 0)
+      weight = TR::Options::_compQueueBootstrapLoaderWeight;
+   freeSlot->initialize(classLoader, weight);
+   // Do not give a new tenant credit for the time it was not competing
+   freeSlot->_lastFinishTime = _virtualTime;
+   return freeSlot;
+   }
+
+void
+TR_WeightedFairSchedulingPolicy::notifyQueued(TR_MethodToBeCompiled *entry)
+   {
+   if (entry->_virtualFinishTime != 0) // already tagged; this is a requeue
+      return;
+   Tenant *tenant = findTenant(getClassLoader(entry), true);
+   uint64_t startTime = tenant->_lastFinishTime > _virtualTime ? tenant->_lastFinishTime : _virtualTime;
+   uint32_t cost = (entry->_weight ? entry->_weight : 1) * WEIGHT_SCALE / tenant->_weight;
+   entry->_virtualFinishTime = startTime + (cost ? cost : 1);
+   tenant->_lastFinishTime = entry->_virtualFinishTime;
+   tenant->_numQueued++;
+   }
+
+void
+TR_WeightedFairSchedulingPolicy::notifyDequeued(TR_MethodToBeCompiled *entry, uint64_t waitTimeMs)
+   {
+   // Self-clocked: virtual time advances to the tag of the request entering service
+   if (entry->_virtualFinishTime > _virtualTime)
+      _virtualTime = entry->_virtualFinishTime;
+   Tenant *tenant = findTenant(getClassLoader(entry), false);
+   if (tenant)
+      {
+      tenant->_numDequeued++;
+      tenant->_totalWaitMs += waitTimeMs;
+      }
+   }
+
+void
+TR_WeightedFairSchedulingPolicy::purgeEntriesOnClassLoaderUnloading(J9ClassLoader *j9classLoader)
+   {
+   Tenant *tenant = findTenant(j9classLoader, false);
+   if (tenant && tenant != &_overflowTenant)
+      tenant->initialize(NULL, 1);
+   }
+
+void
+TR_WeightedFairSchedulingPolicy::printStats() const
+   {
+   TR_VerboseLog::vlogAcquire();
+   TR_VerboseLog::writeLine(TR_Vlog_PERF, "Compilation queue scheduling policy %s: virtualTime=%llu", getName(), (unsigned long long)_virtualTime);
+   for (uint32_t i = 0; i <= MAX_TENANTS; i++)
+      {
+      const Tenant *tenant = i < MAX_TENANTS ? _tenants + i : &_overflowTenant;
+      if (tenant->_numDequeued == 0)
+         continue;
+      TR_VerboseLog::writeLine(TR_Vlog_PERF, "   classLoader=%p weight=%u queued=%u compiled=%u avgWait=%llu ms",
+         tenant->_classLoader, tenant->_weight, tenant->_numQueued, tenant->_numDequeued,
+         (unsigned long long)(tenant->_totalWaitMs / tenant->_numDequeued));
+      }
+   TR_VerboseLog::vlogRelease();
+   }
+
 void TR_LowPriorityCompQueue::invalidateRequestsForUnloadedMethods(J9Class * unloadedClass)
    {
    TR_MethodToBeCompiled *cur = _firstLPQentry;
@@ -69,6 +69,7 @@
 #include "control/MethodToBeCompiled.hpp"
 #include "control/CompilationRuntime.hpp"
 #include "control/CompilationThread.hpp"
+#include "control/JitProfileSnapshot.hpp"
 #include "env/VMJ9.h"
 #include "env/j9method.h"
 #include "env/ut_j9jit.h"
@@ -602,6 +603,11 @@ static void jitHookInitializeSendTarget(J9HookInterface * * hook, UDATA eventNum
          }
       }
 
+   // Methods that were hot in the run that wrote the profile snapshot get lower counts
+   TR_JitProfileSnapshot *profileSnapshot = compInfo->getProfileSnapshot();
+   if (profileSnapshot && count > 0 && !TR::Options::getCountsAreProvidedByUser())
+      count = profileSnapshot->getInitialCount(method, count);
+
    // Option to display chosen counts to track possible bugs
    if (optionsJIT->getVerboseOption(TR_VerboseCounts))
       {
@@ -2114,7 +2120,13 @@ static void jitHookClassUnload(J9HookInterface * * hookInterface, UDATA eventNum
 #if defined(J9VM_OPT_JITSERVER)
    // Add to JITServer unload list
    if (compInfo->getPersistentInfo()->getRemoteCompilationMode() == JITServer::CLIENT)
+      {
       compInfo->getUnloadedClassesTempList()->push_back(clazz);
+      // The set can be cleared by a compilation thread without VM access
+      compInfo->getSequencingMonitor()->enter();
+      compInfo->getClassesPrefetchedToServer()->erase(clazz);
+      compInfo->getSequencingMonitor()->exit();
+      }
 #endif
    }
 #endif /* defined (J9VM_GC_DYNAMIC_CLASS_UNLOADING)*/
@@ -2158,6 +2170,12 @@ static void jitHookClassLoaderUnload(J9HookInterface * * hookInterface, UDATA ev
       compInfo->getDLT_HT()->onClassUnloading(classLoader);
 #endif
    compInfo->getLowPriorityCompQueue().purgeEntriesOnClassLoaderUnloading(classLoader);
+   if (compInfo->getCompQueueSchedulingPolicy())
+      {
+      compInfo->acquireCompilationLock();
+      compInfo->getCompQueueSchedulingPolicy()->purgeEntriesOnClassLoaderUnloading(classLoader);
+      compInfo->releaseCompilationLock();
+      }
 
 #if defined(J9VM_INTERP_PROFILING_BYTECODES)
    if (!TR::Options::getCmdLineOptions()->getOption(TR_DisableIProfilerThread))
@@ -2352,7 +2370,12 @@ void jitClassesRedefined(J9VMThread * currentThread, UDATA classCount, J9JITRede
 #if defined(J9VM_OPT_JITSERVER)
       // Add to JITServer unload list
       if (compInfo->getPersistentInfo()->getRemoteCompilationMode() == JITServer::CLIENT)
+         {
          compInfo->getUnloadedClassesTempList()->push_back((TR_OpaqueClassBlock *) classPair->oldClass);
+         compInfo->getSequencingMonitor()->enter();
+         compInfo->getClassesPrefetchedToServer()->erase((TR_OpaqueClassBlock *) classPair->oldClass);
+         compInfo->getSequencingMonitor()->exit();
+         }
 #endif
 
       freshClass = ((TR_J9VMBase *)fe)->convertClassPtrToClassOffset(classPair->newClass);
@@ -2513,6 +2536,17 @@ static void jitHookInterruptCompilation(J9HookInterface * * hookInterface, UDATA
    }
 #endif /* defined (J9VM_GC_DYNAMIC_CLASS_UNLOADING)*/
 
+// Runs on the signal handling thread, which is not attached to the VM,
+// so the snapshot is written later by the sampling thread
+static void jitHookUserInterrupt(J9HookInterface * * hookInterface, UDATA eventNum, void * eventData, void * userData)
+   {
+   J9VMUserInterruptEvent * event = (J9VMUserInterruptEvent *)eventData;
+   TR::CompilationInfo * compInfo = TR::CompilationInfo::get(event->vm->jitConfig);
+   TR_JitProfileSnapshot * profileSnapshot = compInfo->getProfileSnapshot();
+   if (profileSnapshot)
+      profileSnapshot->requestWrite();
+   }
+
 // jitUpdateMethodOverride is called indirectly from updateCHTable
 //
 void jitUpdateMethodOverride(J9VMThread * vmThread, J9Class * cl, J9Method * overriddenMethod, J9Method * overriddingMethod)
@@ -4030,6 +4064,15 @@ void JitShutdown(J9JITConfig * jitConfig)
 
    TR::CompilationInfo * compInfo = TR::CompilationInfo::get(jitConfig);
 
+   // IProfiler has been stopped above, so the snapshot sees its final state
+   TR_JitProfileSnapshot *profileSnapshot = compInfo->getProfileSnapshot();
+   if (profileSnapshot && vmThread)
+      {
+      profileSnapshot->write(vmThread);
+      if (options && options->getVerboseOption(TR_VerbosePerformance))
+         profileSnapshot->printStats();
+      }
+
    TR_HWProfiler *hwProfiler = ((TR_JitPrivateConfig*)(jitConfig->privateConfig))->hwProfiler;
    if (compInfo->getPersistentInfo()->isRuntimeInstrumentationEnabled())
       {
@@ -4135,6 +4178,10 @@ void JitShutdown(J9JITConfig * jitConfig)
       j9tty_printf(PORTLIB, "\tNo prof. info because timestamp expired: %10d\n", TR_IProfiler::_STATS_timestampHasExpired);
       }
 
+   static char * isPrintCHTableStats = feGetEnv("TR_PrintCHTableStats");
+   if (isPrintCHTableStats && vmThread && compInfo->getPersistentInfo()->getPersistentCHTable())
+      compInfo->getPersistentInfo()->getPersistentCHTable()->dumpStats(TR_J9VMBase::get(jitConfig, vmThread));
+
 #if defined(J9VM_OPT_JITSERVER)
    static char * isPrintJITServerMsgStats = feGetEnv("TR_PrintJITServerMsgStats");
    if (isPrintJITServerMsgStats && compInfo->getPersistentInfo()->getRemoteCompilationMode() == JITServer::CLIENT)
@@ -5874,7 +5921,10 @@ static int32_t J9THREAD_PROC samplerThreadProc(void * entryarg)
          if (crtTime > lastProcNumCheck + 300000) // every 5 mins
             {
             if (trPersistentMemory && TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseJitMemory))
+               {
                trPersistentMemory->printMemStatsToVlog();
+               TR::Compiler->persistentAllocator().printStatistics(true);
+               }
 
             // time to reevaluate the number of processors
             compInfo->computeAndCacheCpuEntitlement();
@@ -5989,6 +6039,11 @@ static int32_t J9THREAD_PROC samplerThreadProc(void * entryarg)
             iProfilerActivationLogic(jitConfig, compInfo);
 #endif // J9VM_INTERP_PROFILING_BYTECODES
             inlinerAggressivenessLogic(compInfo);
+
+            // A user signal asked for the profile snapshot to be written
+            TR_JitProfileSnapshot *profileSnapshot = compInfo->getProfileSnapshot();
+            if (profileSnapshot && profileSnapshot->isWriteRequested())
+               profileSnapshot->write(samplerThread);
             } // if
          } // while
 
@@ -6501,6 +6556,13 @@ int32_t setUpHooks(J9JavaVM * javaVM, J9JITConfig * jitConfig, TR_FrontEnd * vm)
       return -1;
       }
 
+   if (compInfo->getProfileSnapshot() &&
+       (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_USER_INTERRUPT, jitHookUserInterrupt, OMR_GET_CALLSITE(), NULL))
+      {
+      j9tty_printf(PORTLIB, "Error: Unable to register user interrupt hook\n");
+      return -1;
+      }
+
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
    if (!vmj9->isAOT_DEPRECATED_DO_NOT_USE())
       {
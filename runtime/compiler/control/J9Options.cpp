@@ -258,6 +258,11 @@ int32_t J9::Options::_numDLTBufferMatchesToEagerlyIssueCompReq = 8; //a value of
 int32_t J9::Options::_dltPostponeThreshold = 2;
 
 int32_t J9::Options::_expensiveCompWeight = TR::CompilationInfo::JSR292_WEIGHT;
+int32_t J9::Options::_compQueueSchedulingPolicy = 0; // TR_CompQueueSchedulingPolicy::PRIORITY_FIFO
+int32_t J9::Options::_compQueueUpgradeLatencyBudget = 0; // ms; 0 means disabled
+int32_t J9::Options::_compQueueBootstrapLoaderWeight = 2;
+int32_t J9::Options::_hotCodeCacheMinOptLevel = 0; // 0 means no dedicated hot code cache
+int32_t J9::Options::_profileSnapshotCount = 10;
 int32_t J9::Options::_jProfilingEnablementSampleThreshold = 10000;
 
 bool J9::Options::_aggressiveLockReservation = false;
@@ -724,6 +729,15 @@ TR::OptionTable OMR::Options::_feOptions[] = {
    {"compilationYieldStatsThreshold=", "M<nnn>\tprint stats about compilation yield points if the "
                                        "threshold is exceeded. Default 1000 usec. ",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compYieldStatsThreshold, 0, "F%d", NOT_IN_SUBSET},
+   {"compQueueBootstrapLoaderWeight=", "M<nnn>\tshare of the compilation threads given to the bootstrap class loader "
+                                       "relative to other class loaders when compQueueSchedulingPolicy=1",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compQueueBootstrapLoaderWeight, 0, "F%d", NOT_IN_SUBSET},
+   {"compQueueSchedulingPolicy=", "M<nnn>\tordering of compilation requests of equal priority. "
+                                  "0=arrival order (default), 1=weighted fair queuing across class loaders",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compQueueSchedulingPolicy, 0, "F%d", NOT_IN_SUBSET},
+   {"compQueueUpgradeLatencyBudget=", "M<nnn>\tnumber of ms an upgrade request can wait in the compilation queue "
+                                      "before being promoted. Default is 0 which means don't do it",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compQueueUpgradeLatencyBudget, 0, "F%d", NOT_IN_SUBSET},
    {"compThreadPriority=",    "M<nnn>\tThe priority of the compilation thread. "
                               "Use an integer between 0 and 4. Default is 4 (highest priority)",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compilationThreadPriorityCode, 0, "F%d", NOT_IN_SUBSET},
@@ -764,6 +778,9 @@ TR::OptionTable OMR::Options::_feOptions[] = {
    {"gcTrace=",           "D<nnn>\ttrace gc stack walks after gc number nnn",
         TR::Options::setJitConfigNumericValue, offsetof(J9JITConfig, gcTraceThreshold), 0, "F%d"},
 #endif
+   {"hotCodeCacheMinOptLevel=", "C<nnn>\tbodies compiled at this opt level or above (3=hot, 5=scorching) are "
+                                "placed in a code cache dedicated to hot methods. Default is 0 which means don't do it",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_hotCodeCacheMinOptLevel, 0, "F%d", NOT_IN_SUBSET},
    {"HWProfilerAOTWarmOptLevelThreshold=", "O<nnn>\tAOT Warm Opt Level Threshold",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_hwprofilerAOTWarmOptLevelThreshold, 0, "F%d", NOT_IN_SUBSET},
    {"HWProfilerBufferMaxPercentageToDiscard=", "O<nnn>\tpercentage of HW profiling buffers "
@@ -904,6 +921,11 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_numFirstTimeCompilationsToExitIdleMode, 0, "F%d", NOT_IN_SUBSET },
    {"profileAllTheTime=",    "R<nnn>\tInterpreter profiling will be on all the time",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_profileAllTheTime, 0, " %d", NOT_IN_SUBSET},
+   {"profileSnapshotCount=", "M<nnn>\tInitial invocation count of methods that were compiled in the run that wrote the profile snapshot",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_profileSnapshotCount, 0, "F%d", NOT_IN_SUBSET},
+   {"profileSnapshotFile=", "L<filename>\tread the profile snapshot from filename at startup and write it back at shutdown "
+                            "or when the JVM receives a user signal",
+        TR::Options::setStringForPrivateBase, offsetof(TR_JitPrivateConfig,profileSnapshotFileName), 0, "P%s"},
    {"queuedInvReqThresholdToDowngradeOptLevel=", "M<nnn>\tDowngrade opt level if too many inv req",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_numQueuedInvReqToDowngradeOptLevel , 0, "F%d", NOT_IN_SUBSET},
    {"queueSizeThresholdToDowngradeDuringCLP=", "M<nnn>\tCompilation queue size threshold (interpreted methods) when opt level is downgraded during class load phase",
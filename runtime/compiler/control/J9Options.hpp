@@ -308,6 +308,11 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
    static uint32_t _hwprofilerZRISF;
 
    static int32_t _expensiveCompWeight; // weight of a comp request to be considered expensive
+   static int32_t _compQueueSchedulingPolicy; // see TR_CompQueueSchedulingPolicy::Kind
+   static int32_t _compQueueUpgradeLatencyBudget; // ms; upgrade requests waiting longer are promoted
+   static int32_t _compQueueBootstrapLoaderWeight; // used by weighted fair scheduling
+   static int32_t _hotCodeCacheMinOptLevel; // TR_Hotness; 0 disables the hot code cache
+   static int32_t _profileSnapshotCount; // initial count of methods compiled in the run that wrote the profile snapshot
    static int32_t _jProfilingEnablementSampleThreshold;
 
    static bool _aggressiveLockReservation;
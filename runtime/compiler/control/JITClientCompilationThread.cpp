@@ -3126,6 +3126,7 @@ remoteCompile(
    if (compiler->isOptServer())
       compiler->setOption(TR_Server);
    auto classInfoTuple = JITServerHelpers::packRemoteROMClassInfo(clazz, compiler->fej9vm()->vmThread(), compiler->trMemory());
+   auto prefetchBundle = JITServerHelpers::packPrefetchBundle(compiler, method, useAotCompilation);
    std::string optionsStr = TR::Options::packOptions(compiler->getOptions());
    std::string recompMethodInfoStr = compiler->isRecompilationEnabled() ? std::string((char *) compiler->getRecompilationInfo()->getMethodInfo(), sizeof(TR_PersistentMethodInfo)) : std::string();
 
@@ -3165,7 +3166,7 @@ remoteCompile(
          }
       client->buildCompileRequest(TR::comp()->getPersistentInfo()->getClientUID(), romMethodOffset,
                                  method, clazz, *compInfoPT->getMethodBeingCompiled()->_optimizationPlan, detailsStr, details.getType(), unloadedClasses,
-                                 classInfoTuple, optionsStr, recompMethodInfoStr, seqNo, useAotCompilation);
+                                 classInfoTuple, optionsStr, recompMethodInfoStr, seqNo, useAotCompilation, prefetchBundle);
 
       JITServer::MessageType response;
       while(!handleServerMessage(client, compiler->fej9vm(), response));
@@ -3212,6 +3213,11 @@ remoteCompile(
       {
       JITServerHelpers::postStreamFailure(OMRPORT_FROM_J9PORT(compInfoPT->getJitConfig()->javaVM->portLibrary));
 
+      // The server may have lost the classes prefetched so far (e.g. it was restarted)
+      compInfo->getSequencingMonitor()->enter();
+      compInfo->getClassesPrefetchedToServer()->clear();
+      compInfo->getSequencingMonitor()->exit();
+
       client->~ClientStream();
       TR_Memory::jitPersistentFree(client);
       compInfoPT->setClientStream(NULL);
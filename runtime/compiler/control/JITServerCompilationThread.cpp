@@ -129,7 +129,9 @@ TR::CompilationInfoPerThreadRemote::CompilationInfoPerThreadRemote(TR::Compilati
    _classOfStaticMap(NULL),
    _fieldAttributesCache(NULL),
    _staticAttributesCache(NULL),
-   _isUnresolvedStrCache(NULL)
+   _isUnresolvedStrCache(NULL),
+   _prefetchedIPMethod(NULL),
+   _prefetchedIPMethodIsCompiled(false)
    {}
 
 /**
@@ -289,7 +291,7 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
       {
       auto req = stream->readCompileRequest<uint64_t, uint32_t, J9Method *, J9Class*, TR_OptimizationPlan, std::string,
          J9::IlGeneratorMethodDetailsType, std::vector<TR_OpaqueClassBlock*>,
-         JITServerHelpers::ClassInfoTuple, std::string, std::string, uint32_t, bool>();
+         JITServerHelpers::ClassInfoTuple, std::string, std::string, uint32_t, bool, JITServerHelpers::PrefetchBundle>();
 
       clientId                           = std::get<0>(req);
       uint32_t romMethodOffset           = std::get<1>(req);
@@ -304,6 +306,7 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
       std::string recompInfoStr          = std::get<10>(req);
       seqNo                              = std::get<11>(req); // Sequence number at the client
       useAotCompilation                  = std::get<12>(req);
+      auto &prefetchBundle               = std::get<13>(req);
 
       if (useAotCompilation)
          {
@@ -431,6 +434,12 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
          JITServerHelpers::cacheRemoteROMClass(getClientData(), clazz, romClass, &classInfoTuple);
          }
 
+      // Pre-populate the session with the data the client predicted we will ask for.
+      // This must follow the processing of unloaded classes and the caching of the ROMClass above.
+      JITServerHelpers::cachePrefetchBundle(clientSession, clazz, prefetchBundle, compInfo->persistentMemory());
+      if (std::get<5>(prefetchBundle))
+         setPrefetchedIProfilerInfo((TR_OpaqueMethodBlock *)ramMethod, std::get<4>(prefetchBundle), std::get<6>(prefetchBundle));
+
       J9ROMMethod *romMethod = (J9ROMMethod*)((uint8_t*)romClass + romMethodOffset);
 
       // Build my entry
@@ -803,6 +812,42 @@ TR::CompilationInfoPerThreadRemote::getCachedIProfilerInfo(TR_OpaqueMethodBlock
    return ipEntry;
    }
 
+/**
+ * @brief Method executed by JITServer to remember the IProfiler info of the method being compiled,
+ *        which the client sent together with the compilation request
+ *
+ * @param method The method being compiled
+ * @param ipData Serialized IProfiler entries of the entire method; empty if the method has no info
+ * @param isCompiled Whether the method was compiled when the client collected the info
+ */
+void
+TR::CompilationInfoPerThreadRemote::setPrefetchedIProfilerInfo(TR_OpaqueMethodBlock *method, const std::string &ipData, bool isCompiled)
+   {
+   _prefetchedIPMethod = method;
+   _prefetchedIPMethodIsCompiled = isCompiled;
+   _prefetchedIPData = ipData;
+   }
+
+/**
+ * @brief Method executed by JITServer to retrieve the IProfiler info sent with the compilation request.
+ *        The info can be retrieved only once; afterwards it lives in the IProfiler cache of the client session.
+ *
+ * @param method The method of interest
+ * @param ipData (output) Serialized IProfiler entries of the method
+ * @param isCompiled (output) Whether the method was compiled when the client collected the info
+ * @return Returns true if the client sent the info for this method
+ */
+bool
+TR::CompilationInfoPerThreadRemote::getPrefetchedIProfilerInfo(TR_OpaqueMethodBlock *method, std::string &ipData, bool &isCompiled)
+   {
+   if (!_prefetchedIPMethod || _prefetchedIPMethod != method)
+      return false;
+   _prefetchedIPMethod = NULL;
+   isCompiled = _prefetchedIPMethodIsCompiled;
+   ipData.swap(_prefetchedIPData);
+   return true;
+   }
+
 /**
  * @brief Method executed by JITServer to cache a resolved method to the resolved method cache
  *
@@ -1069,6 +1114,8 @@ TR::CompilationInfoPerThreadRemote::clearPerCompilationCaches()
    clearPerCompilationCache(_fieldAttributesCache);
    clearPerCompilationCache(_staticAttributesCache);
    clearPerCompilationCache(_isUnresolvedStrCache);
+   _prefetchedIPMethod = NULL;
+   _prefetchedIPData.clear();
    }
 
 /**
@@ -22,10 +22,16 @@
 
 #include "control/JITServerHelpers.hpp"
 
+#include <algorithm>
 #include "control/CompilationRuntime.hpp"
 #include "control/JITServerCompilationThread.hpp"
 #include "control/MethodToBeCompiled.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "ilgen/J9ByteCode.hpp"
+#include "ilgen/J9ByteCodeIterator.hpp"
 #include "infra/CriticalSection.hpp"
+#include "net/ServerStream.hpp"
+#include "runtime/JITServerIProfiler.hpp"
 
 
 uint32_t     JITServerHelpers::serverMsgTypeCount[] = {};
@@ -33,6 +39,9 @@ uint64_t     JITServerHelpers::_waitTimeMs = 1000;
 bool         JITServerHelpers::_serverAvailable = true;
 uint64_t     JITServerHelpers::_nextConnectionRetryTime = 0;
 TR::Monitor *JITServerHelpers::_clientStreamMonitor = NULL;
+uint32_t     JITServerHelpers::_numPrefetchBundles = 0;
+uint32_t     JITServerHelpers::_numPrefetchedClasses = 0;
+uint32_t     JITServerHelpers::_numPrefetchedCPEntries = 0;
 
 static size_t
 methodStringsLength(J9ROMMethod *method)
@@ -174,6 +183,34 @@ JITServerHelpers::printJITServerCacheStats(J9JITConfig *jitConfig, TR::Compilati
       }
    }
 
+void
+JITServerHelpers::printJITServerPrefetchStats(J9JITConfig *jitConfig)
+   {
+   PORT_ACCESS_FROM_JITCONFIG(jitConfig);
+   j9tty_printf(PORTLIB, "JITServer Prefetch Statistics:\n");
+   j9tty_printf(PORTLIB, "Bundles received: %u  ROMClasses cached: %u  Constant pool entries cached: %u\n",
+      _numPrefetchBundles, _numPrefetchedClasses, _numPrefetchedCPEntries);
+
+   // Bucket i holds the round trips that took less than 2^(i+1) usec; the last bucket holds the rest
+   j9tty_printf(PORTLIB, "Round trip times (usec) by message type:\n");
+   j9tty_printf(PORTLIB, "Type#  #trips   avg");
+   for (int b = 0; b < JITServer::ServerStream::RTT_HISTOGRAM_BUCKETS - 1; ++b)
+      j9tty_printf(PORTLIB, " %6u", 2u << b);
+   j9tty_printf(PORTLIB, "   more TypeName\n");
+   for (int i = 0; i < JITServer::MessageType_ARRAYSIZE; ++i)
+      {
+      JITServer::MessageType type = (JITServer::MessageType)i;
+      uint32_t numRoundTrips = JITServer::ServerStream::getNumRoundTrips(type);
+      if (numRoundTrips == 0)
+         continue;
+      j9tty_printf(PORTLIB, "#%04d %7u %5llu", i, numRoundTrips,
+         (unsigned long long)(JITServer::ServerStream::getRoundTripTimeUs(type) / numRoundTrips));
+      for (int b = 0; b < JITServer::ServerStream::RTT_HISTOGRAM_BUCKETS; ++b)
+         j9tty_printf(PORTLIB, " %6u", JITServer::ServerStream::getRoundTripHistogram(type, b));
+      j9tty_printf(PORTLIB, " %s\n", JITServer::messageNames[i]);
+      }
+   }
+
 void 
 JITServerHelpers::cacheRemoteROMClass(ClientSessionData *clientSessionData, J9Class *clazz, J9ROMClass *romClass, ClassInfoTuple *classInfoTuple)
    {
@@ -288,6 +325,158 @@ JITServerHelpers::packRemoteROMClassInfo(J9Class *clazz, J9VMThread *vmThread, T
                           clazz->romClass, cp, classFlags, classChainOffsetOfIdentifyingLoaderForClazz, origROMMethods);
    }
 
+/**
+ * @brief Method executed by the JITClient to collect the data the server is expected to ask for
+ *        while compiling a method, so that it can travel with the compilation request
+ *
+ * The bundle contains the class references made by the bytecodes of the method that are
+ * already resolved, the ROMClasses of the resolved classes that were not sent before,
+ * and the IProfiler info of the method, including its call graph entries.
+ * Must be called with VM access in hand.
+ */
+JITServerHelpers::PrefetchBundle
+JITServerHelpers::packPrefetchBundle(TR::Compilation *comp, J9Method *method, bool useAotCompilation)
+   {
+   PrefetchBundle bundle;
+   static bool disablePrefetch = feGetEnv("TR_DisableJITServerPrefetch") ? true : false;
+   TR_J9VMBase *fej9 = comp->fej9();
+   // AOT compilations must validate every class they obtain, and with runtime
+   // resolution the server must see all class references as unresolved
+   if (disablePrefetch || useAotCompilation || (fej9->_jitConfig->runtimeFlags & J9JIT_RUNTIME_RESOLVE))
+      return bundle;
+
+   J9Class *clazz = J9_CLASS_FROM_METHOD(method);
+   J9ConstantPool *ramCP = J9_CP_FROM_METHOD(method);
+   J9ROMConstantPoolItem *romCP = ramCP->romConstantPool;
+   std::vector<int32_t> &cpIndices = std::get<2>(bundle);
+   std::vector<TR_OpaqueClassBlock *> &cpClasses = std::get<3>(bundle);
+   std::vector<J9Class *> candidates;
+
+      {
+      TR::StackMemoryRegion stackMemoryRegion(*comp->trMemory());
+      TR_ResolvedJ9Method resolvedMethod((TR_OpaqueMethodBlock *)method, fej9, comp->trMemory());
+      TR_J9ByteCodeIterator bci(NULL, &resolvedMethod, fej9, comp);
+      for (TR_J9ByteCode bc = bci.first(); bc != J9BCunknown; bc = bci.next())
+         {
+         int32_t classCPIndex = -1;
+         switch (bc)
+            {
+            case J9BCnew:
+            case J9BCanewarray:
+            case J9BCmultianewarray:
+            case J9BCcheckcast:
+            case J9BCinstanceof:
+               classCPIndex = bci.next2Bytes();
+               break;
+            case J9BCgetstatic:
+            case J9BCputstatic:
+            case J9BCgetfield:
+            case J9BCputfield:
+               classCPIndex = ((J9ROMFieldRef *)&romCP[bci.next2Bytes()])->classRefCPIndex;
+               break;
+            case J9BCinvokevirtual:
+            case J9BCinvokespecial:
+            case J9BCinvokestatic:
+            case J9BCinvokeinterface:
+               classCPIndex = ((J9ROMMethodRef *)&romCP[bci.next2Bytes()])->classRefCPIndex;
+               break;
+            default:
+               break;
+            }
+         if (classCPIndex < 0)
+            continue;
+
+         // Only entries that are already resolved; the server would get the same answer
+         // from getClassFromConstantPool without triggering class loading
+         J9Class *resolvedClass = ((J9RAMClassRef *)&ramCP[classCPIndex])->value;
+         if (!resolvedClass || std::find(cpIndices.begin(), cpIndices.end(), classCPIndex) != cpIndices.end())
+            continue;
+         cpIndices.push_back(classCPIndex);
+         cpClasses.push_back(fej9->convertClassPtrToClassOffset(resolvedClass));
+         if (resolvedClass != clazz && std::find(candidates.begin(), candidates.end(), resolvedClass) == candidates.end())
+            candidates.push_back(resolvedClass);
+         }
+      }
+
+   // Send the ROMClass of a class only once; the set is reset when a class is
+   // unloaded or when the connection to the server fails
+   std::vector<J9Class *> &classes = std::get<0>(bundle);
+   TR::CompilationInfo *compInfo = TR::CompilationInfo::get();
+   compInfo->getSequencingMonitor()->enter();
+   auto &classesPrefetched = *compInfo->getClassesPrefetchedToServer();
+   for (J9Class *candidate : candidates)
+      {
+      if (classes.size() >= MAX_PREFETCH_CLASSES)
+         break;
+      if (classesPrefetched.insert((TR_OpaqueClassBlock *)candidate).second)
+         classes.push_back(candidate);
+      }
+   compInfo->getSequencingMonitor()->exit();
+
+   std::vector<ClassInfoTuple> &classInfos = std::get<1>(bundle);
+   classInfos.reserve(classes.size());
+   for (J9Class *prefetchClass : classes)
+      classInfos.push_back(packRemoteROMClassInfo(prefetchClass, fej9->vmThread(), comp->trMemory()));
+
+   JITClientIProfiler *iProfiler = (JITClientIProfiler *)fej9->getIProfiler();
+   if (iProfiler)
+      {
+      bool abort = iProfiler->serializeIProfileInfoForMethod((TR_OpaqueMethodBlock *)method, comp, std::get<4>(bundle));
+      std::get<5>(bundle) = !abort;
+      std::get<6>(bundle) = TR::CompilationInfo::isCompiled(method);
+      }
+
+   return bundle;
+   }
+
+/**
+ * @brief Method executed by the JITServer to cache the data that the client sent with a
+ *        compilation request. The IProfiler info is handled by the compilation thread.
+ */
+void
+JITServerHelpers::cachePrefetchBundle(ClientSessionData *clientSessionData, J9Class *clazz, PrefetchBundle &bundle, TR_PersistentMemory *trMemory)
+   {
+   std::vector<J9Class *> &classes = std::get<0>(bundle);
+   std::vector<ClassInfoTuple> &classInfos = std::get<1>(bundle);
+   std::vector<int32_t> &cpIndices = std::get<2>(bundle);
+   std::vector<TR_OpaqueClassBlock *> &cpClasses = std::get<3>(bundle);
+   if (classes.empty() && cpIndices.empty() && !std::get<5>(bundle))
+      return;
+   _numPrefetchBundles++;
+
+   for (size_t i = 0; i < classes.size(); ++i)
+      {
+      if (getRemoteROMClassIfCached(clientSessionData, classes[i]))
+         continue;
+      J9ROMClass *romClass = romClassFromString(std::get<0>(classInfos[i]), trMemory);
+      OMR::CriticalSection cachePrefetchedClass(clientSessionData->getROMMapMonitor());
+      if (clientSessionData->getROMClassMap().find(classes[i]) == clientSessionData->getROMClassMap().end())
+         {
+         ClientSessionData::ClassInfo classInfo;
+         cacheRemoteROMClass(clientSessionData, classes[i], romClass, &classInfos[i], classInfo);
+         _numPrefetchedClasses++;
+         }
+      else
+         {
+         // Another compilation thread cached the class in the meantime
+         trMemory->freePersistentMemory(romClass);
+         }
+      }
+
+   if (!cpIndices.empty())
+      {
+      OMR::CriticalSection cachePrefetchedCPEntries(clientSessionData->getROMMapMonitor());
+      auto it = clientSessionData->getROMClassMap().find(clazz);
+      if (it != clientSessionData->getROMClassMap().end())
+         {
+         auto &constantClassPoolCache = it->second._constantClassPoolCache;
+         for (size_t i = 0; i < cpIndices.size(); ++i)
+            constantClassPoolCache.insert({ cpIndices[i], cpClasses[i] });
+         _numPrefetchedCPEntries += cpIndices.size();
+         }
+      }
+   }
+
 J9ROMClass *
 JITServerHelpers::romClassFromString(const std::string &romClassStr, TR_PersistentMemory *trMemory)
    {
@@ -71,7 +71,19 @@ class JITServerHelpers
       uintptr_t, std::vector<J9ROMMethod *>                          // 20: _classChainOffsetOfIdentifyingLoaderForClazz 21. _origROMMethods
       >;
 
+   // Data that the client sends together with a compilation request because it predicts
+   // that the server will ask for it; the server uses it to pre-populate the client session.
+   // NOTE: when adding new elements to this tuple, add them to the end.
+   using PrefetchBundle = std::tuple
+      <
+      std::vector<J9Class *>, std::vector<ClassInfoTuple>,           // 0: classes not yet sent      1: their ClassInfoTuples
+      std::vector<int32_t>, std::vector<TR_OpaqueClassBlock *>,      // 2: resolved class cpIndices  3: the classes they resolve to
+      std::string, bool, bool                                        // 4: IProfiler data of the method  5: IProfiler data was sent  6: method is compiled
+      >;
+
    static ClassInfoTuple packRemoteROMClassInfo(J9Class *clazz, J9VMThread *vmThread, TR_Memory *trMemory);
+   static PrefetchBundle packPrefetchBundle(TR::Compilation *comp, J9Method *method, bool useAotCompilation);
+   static void cachePrefetchBundle(ClientSessionData *clientSessionData, J9Class *clazz, PrefetchBundle &bundle, TR_PersistentMemory *trMemory);
    static void cacheRemoteROMClass(ClientSessionData *clientSessionData, J9Class *clazz, J9ROMClass *romClass, ClassInfoTuple *classInfoTuple);
    static void cacheRemoteROMClass(ClientSessionData *clientSessionData, J9Class *clazz, J9ROMClass *romClass, ClassInfoTuple *classInfoTuple, ClientSessionData::ClassInfo &classInfo);
    static J9ROMClass *getRemoteROMClassIfCached(ClientSessionData *clientSessionData, J9Class *clazz);
@@ -94,6 +106,7 @@ class JITServerHelpers
    static void printJITServerMsgStats(J9JITConfig *);
    static void printJITServerCHTableStats(J9JITConfig *, TR::CompilationInfo *);
    static void printJITServerCacheStats(J9JITConfig *, TR::CompilationInfo *);
+   static void printJITServerPrefetchStats(J9JITConfig *);
 
    static uint32_t serverMsgTypeCount[JITServer::MessageType_ARRAYSIZE];
 
@@ -110,6 +123,13 @@ class JITServerHelpers
       return _clientStreamMonitor;
       }
 
+   static const uint32_t MAX_PREFETCH_CLASSES = 16; // per compilation request
+
+   // Prefetch statistics, collected at the server
+   static uint32_t _numPrefetchBundles;
+   static uint32_t _numPrefetchedClasses;
+   static uint32_t _numPrefetchedCPEntries;
+
    static uint64_t _waitTimeMs;
    static uint64_t _nextConnectionRetryTime;
    static bool _serverAvailable;
@@ -0,0 +1,498 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "control/JitProfileSnapshot.hpp"
+
+#include <algorithm>
+#include <string.h>
+#include "j9.h"
+#include "j9protos.h"
+#include "rommeth.h"
+#include "vmaccess.h"
+#include "AtomicSupport.hpp"
+#include "control/CompilationRuntime.hpp"
+#include "control/Options.hpp"
+#include "control/Recompilation.hpp"
+#include "control/RecompilationInfo.hpp"
+#include "env/VMJ9.h"
+#include "runtime/IProfiler.hpp"
+
+TR_JitProfileSnapshot *
+TR_JitProfileSnapshot::allocate(J9JITConfig *jitConfig, const char *fileName)
+   {
+   TR_JitProfileSnapshot *snapshot = new (PERSISTENT_NEW) TR_JitProfileSnapshot(jitConfig, fileName);
+   if (!snapshot)
+      return NULL;
+   snapshot->_hashTable = (SnapshotMethod **)jitPersistentAlloc(HASH_TABLE_SIZE * sizeof(SnapshotMethod *));
+   if (!snapshot->_hashTable)
+      return NULL;
+   memset(snapshot->_hashTable, 0, HASH_TABLE_SIZE * sizeof(SnapshotMethod *));
+   // A missing or unusable file is not an error: the snapshot will be created at shutdown
+   snapshot->load();
+   return snapshot;
+   }
+
+TR_JitProfileSnapshot::TR_JitProfileSnapshot(J9JITConfig *jitConfig, const char *fileName)
+   : _jitConfig(jitConfig),
+     _fileName(fileName),
+     _data(NULL),
+     _hashTable(NULL),
+     _writeRequested(false),
+     _writeInProgress(0),
+     _numMethodsLoaded(0),
+     _numCountsLowered(0),
+     _numOptLevelsApplied(0),
+     _numIProfilerEntriesRestored(0),
+     _numMethodsWritten(0),
+     _numIProfilerEntriesWritten(0)
+   {
+   }
+
+uint32_t
+TR_JitProfileSnapshot::hashName(uint32_t hash, const char *data, uint32_t length)
+   {
+   for (uint32_t i = 0; i < length; i++)
+      hash = (hash << 5) + hash + data[i];
+   return hash;
+   }
+
+bool
+TR_JitProfileSnapshot::load()
+   {
+   PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
+   I_64 fileLength = j9file_length(_fileName);
+   if (fileLength < (I_64)sizeof(FileHeader))
+      return false;
+
+   IDATA fd = j9file_open(_fileName, EsOpenRead, 0);
+   if (fd == -1)
+      return false;
+
+   FileHeader header;
+   bool success = false;
+   if (j9file_read(fd, &header, sizeof(header)) == sizeof(header) &&
+       header._magic == SNAPSHOT_MAGIC &&
+       header._version == SNAPSHOT_VERSION &&
+       (I_64)header._dataSize == fileLength - (I_64)sizeof(FileHeader))
+      {
+      _data = (uint8_t *)jitPersistentAlloc(header._dataSize);
+      if (_data && j9file_read(fd, _data, header._dataSize) == (IDATA)header._dataSize)
+         success = true;
+      }
+   j9file_close(fd);
+   if (!success)
+      {
+      if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerbosePerformance))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "Ignoring unreadable profile snapshot %s", _fileName);
+      return false;
+      }
+
+   // Validate the records and index them by name
+   uint8_t *cursor = _data;
+   uint8_t *end = _data + header._dataSize;
+   for (uint32_t i = 0; i < header._numMethods; i++)
+      {
+      if (cursor + sizeof(MethodRecord) > end)
+         break;
+      const MethodRecord *record = (const MethodRecord *)cursor;
+      uint32_t namesSize = alignRecordSize(record->_classNameLength + record->_nameLength + record->_signatureLength);
+      if (record->_recordSize < sizeof(MethodRecord) + namesSize ||
+          (record->_recordSize & 7) != 0 ||
+          cursor + record->_recordSize > end)
+         break;
+
+      SnapshotMethod *snapshotMethod = (SnapshotMethod *)jitPersistentAlloc(sizeof(SnapshotMethod));
+      if (!snapshotMethod)
+         break;
+      snapshotMethod->_record = record;
+      snapshotMethod->_className = (const char *)(cursor + sizeof(MethodRecord));
+      snapshotMethod->_name = snapshotMethod->_className + record->_classNameLength;
+      snapshotMethod->_signature = snapshotMethod->_name + record->_nameLength;
+      snapshotMethod->_iprofilerEntries = cursor + sizeof(MethodRecord) + namesSize;
+      snapshotMethod->_iprofilerEntriesRestored = 0;
+
+      uint32_t hash = hashName(5381, snapshotMethod->_className, record->_classNameLength);
+      hash = hashName(hash, snapshotMethod->_name, record->_nameLength);
+      hash = hashName(hash, snapshotMethod->_signature, record->_signatureLength);
+      snapshotMethod->_hash = hash;
+      snapshotMethod->_next = _hashTable[hash % HASH_TABLE_SIZE];
+      _hashTable[hash % HASH_TABLE_SIZE] = snapshotMethod;
+
+      _numMethodsLoaded++;
+      cursor += record->_recordSize;
+      }
+
+   if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerbosePerformance))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "Loaded profile snapshot %s: %u methods", _fileName, _numMethodsLoaded);
+   return true;
+   }
+
+TR_JitProfileSnapshot::SnapshotMethod *
+TR_JitProfileSnapshot::findMethod(J9Method *method)
+   {
+   if (_numMethodsLoaded == 0)
+      return NULL;
+
+   J9UTF8 *className;
+   J9UTF8 *name;
+   J9UTF8 *signature;
+   getClassNameSignatureFromMethod(method, className, name, signature);
+
+   uint32_t hash = hashName(5381, (const char *)J9UTF8_DATA(className), J9UTF8_LENGTH(className));
+   hash = hashName(hash, (const char *)J9UTF8_DATA(name), J9UTF8_LENGTH(name));
+   hash = hashName(hash, (const char *)J9UTF8_DATA(signature), J9UTF8_LENGTH(signature));
+
+   for (SnapshotMethod *cursor = _hashTable[hash % HASH_TABLE_SIZE]; cursor; cursor = cursor->_next)
+      {
+      const MethodRecord *record = cursor->_record;
+      if (cursor->_hash == hash &&
+          record->_classNameLength == J9UTF8_LENGTH(className) &&
+          record->_nameLength == J9UTF8_LENGTH(name) &&
+          record->_signatureLength == J9UTF8_LENGTH(signature) &&
+          !memcmp(cursor->_className, J9UTF8_DATA(className), record->_classNameLength) &&
+          !memcmp(cursor->_name, J9UTF8_DATA(name), record->_nameLength) &&
+          !memcmp(cursor->_signature, J9UTF8_DATA(signature), record->_signatureLength))
+         {
+         // The class may have changed between runs
+         if (record->_bytecodeSize != J9_BYTECODE_SIZE_FROM_ROM_METHOD(J9_ROM_METHOD_FROM_RAM_METHOD(method)))
+            return NULL;
+         return cursor;
+         }
+      }
+   return NULL;
+   }
+
+int32_t
+TR_JitProfileSnapshot::getInitialCount(J9Method *method, int32_t count)
+   {
+   SnapshotMethod *snapshotMethod = findMethod(method);
+   if (!snapshotMethod)
+      return count;
+
+   int32_t newCount;
+   if (snapshotMethod->_record->_hotness != NOT_COMPILED)
+      newCount = TR::Options::_profileSnapshotCount;
+   else // was interpreted in the previous run; give it credit for the invocations seen so far
+      newCount = std::max(count - (int32_t)snapshotMethod->_record->_invocationCount, TR::Options::_profileSnapshotCount);
+
+   if (newCount >= count)
+      return count;
+   _numCountsLowered++;
+   return newCount;
+   }
+
+TR_Hotness
+TR_JitProfileSnapshot::getFirstCompilationOptLevel(J9Method *method, TR_Hotness defaultLevel)
+   {
+   SnapshotMethod *snapshotMethod = findMethod(method);
+   if (!snapshotMethod)
+      return defaultLevel;
+
+   // IProfiler entries are restored once, even if the method is compiled again
+   TR_IProfiler *iProfiler = TR_J9VMBase::get(_jitConfig, NULL)->getIProfiler();
+   if (iProfiler && iProfiler->isIProfilingEnabled() &&
+       0 == VM_AtomicSupport::lockCompareExchangeU32((uint32_t *)&snapshotMethod->_iprofilerEntriesRestored, 0, 1))
+      _numIProfilerEntriesRestored += restoreIProfilerEntries(snapshotMethod, method, iProfiler);
+
+   int8_t recordedLevel = snapshotMethod->_record->_hotness;
+   if (recordedLevel == NOT_COMPILED || recordedLevel <= (int8_t)defaultLevel || recordedLevel > (int8_t)scorching)
+      return defaultLevel;
+   _numOptLevelsApplied++;
+   return std::min((TR_Hotness)recordedLevel, veryHot);
+   }
+
+uint32_t
+TR_JitProfileSnapshot::restoreIProfilerEntries(SnapshotMethod *snapshotMethod, J9Method *method, TR_IProfiler *iProfiler)
+   {
+   const MethodRecord *record = snapshotMethod->_record;
+   const uint8_t *entry = snapshotMethod->_iprofilerEntries;
+   const uint8_t *end = (const uint8_t *)record + record->_recordSize;
+   uintptr_t bytecodeStart = (uintptr_t)J9_BYTECODE_START_FROM_ROM_METHOD(J9_ROM_METHOD_FROM_RAM_METHOD(method));
+   uint32_t numRestored = 0;
+
+   for (uint32_t i = 0; i < record->_numIProfilerEntries; i++)
+      {
+      TR_IPBCDataStorageHeader *storage = (TR_IPBCDataStorageHeader *)entry;
+      uint32_t entrySize;
+      if (entry + sizeof(TR_IPBCDataStorageHeader) > end)
+         break;
+      if (storage->ID == TR_IPBCD_FOUR_BYTES)
+         entrySize = alignRecordSize(sizeof(TR_IPBCDataFourBytesStorage));
+      else if (storage->ID == TR_IPBCD_EIGHT_WORDS)
+         entrySize = alignRecordSize(sizeof(TR_IPBCDataEightWordsStorage));
+      else
+         break;
+      if (entry + entrySize > end || storage->pc >= record->_bytecodeSize)
+         break;
+
+      if (iProfiler->restoreSnapshotSample(bytecodeStart + storage->pc, storage))
+         numRestored++;
+      entry += entrySize;
+      }
+   return numRestored;
+   }
+
+bool
+TR_JitProfileSnapshot::append(SnapshotBuffer *buffer, const void *data, uint32_t length)
+   {
+   if (buffer->_failed)
+      return false;
+   if (buffer->_size + length > buffer->_capacity)
+      {
+      uint32_t newCapacity = std::max(std::max(buffer->_capacity * 2, buffer->_size + length), (uint32_t)INITIAL_BUFFER_SIZE);
+      uint8_t *newData = (uint8_t *)jitPersistentAlloc(newCapacity);
+      if (!newData)
+         {
+         buffer->_failed = true;
+         return false;
+         }
+      if (buffer->_data)
+         {
+         memcpy(newData, buffer->_data, buffer->_size);
+         jitPersistentFree(buffer->_data);
+         }
+      buffer->_data = newData;
+      buffer->_capacity = newCapacity;
+      }
+   memcpy(buffer->_data + buffer->_size, data, length);
+   buffer->_size += length;
+   return true;
+   }
+
+// Appends one method record to the buffer.
+// Returns the size of the record, 0 if the method is not worth recording or the buffer cannot grow.
+uint32_t
+TR_JitProfileSnapshot::writeMethodRecord(SnapshotBuffer *buffer, J9Method *method, TR_IProfiler *iProfiler, uint32_t *numIProfilerEntries)
+   {
+   J9ROMMethod *romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(method);
+   if (romMethod->modifiers & (J9AccAbstract | J9AccNative))
+      return 0;
+
+   TR::Options *options = TR::Options::getCmdLineOptions();
+   int32_t initialCount = J9ROMMETHOD_HAS_BACKWARDS_BRANCHES(romMethod) ? options->getInitialBCount() : options->getInitialCount();
+   MethodRecord record;
+   record._flags = 0;
+   if (TR::CompilationInfo::isCompiled(method))
+      {
+      TR_PersistentJittedBodyInfo *bodyInfo = TR::Recompilation::getJittedBodyInfoFromPC(TR::CompilationInfo::getJ9MethodStartPC(method));
+      if (!bodyInfo) // not recompilable; there is no opt level to remember
+         return 0;
+      record._hotness = (int8_t)bodyInfo->getHotness();
+      if (bodyInfo->getIsProfilingBody())
+         record._flags |= ProfilingBody;
+      if (bodyInfo->getIsAotedBody())
+         record._flags |= AotedBody;
+      record._invocationCount = initialCount;
+      }
+   else
+      {
+      // Remember interpreted methods that got at least half way to their first compilation
+      int32_t count = TR::CompilationInfo::getInvocationCount(method);
+      if (count < 0 || count > initialCount / 2)
+         return 0;
+      record._hotness = NOT_COMPILED;
+      record._invocationCount = initialCount - count;
+      }
+
+   J9UTF8 *className;
+   J9UTF8 *name;
+   J9UTF8 *signature;
+   getClassNameSignatureFromMethod(method, className, name, signature);
+   uint32_t namesSize = J9UTF8_LENGTH(className) + J9UTF8_LENGTH(name) + J9UTF8_LENGTH(signature);
+
+   record._classNameLength = J9UTF8_LENGTH(className);
+   record._nameLength = J9UTF8_LENGTH(name);
+   record._signatureLength = J9UTF8_LENGTH(signature);
+   record._bytecodeSize = (uint32_t)J9_BYTECODE_SIZE_FROM_ROM_METHOD(romMethod);
+   record._numIProfilerEntries = 0;
+   record._recordSize = 0;
+
+   // The record is completed once its entries have been copied into the buffer
+   static const uint8_t padding[8] = { 0 };
+   uint32_t recordStart = buffer->_size;
+   append(buffer, &record, sizeof(record));
+   append(buffer, J9UTF8_DATA(className), J9UTF8_LENGTH(className));
+   append(buffer, J9UTF8_DATA(name), J9UTF8_LENGTH(name));
+   append(buffer, J9UTF8_DATA(signature), J9UTF8_LENGTH(signature));
+   append(buffer, padding, alignRecordSize(namesSize) - namesSize);
+
+   // The IProfiler thread keeps changing the table, so it is read only once.
+   // Call graph entries are left out because the receiver classes cannot be identified across runs.
+   uintptr_t bytecodeStart = (uintptr_t)J9_BYTECODE_START_FROM_ROM_METHOD(romMethod);
+   uint32_t numEntries = 0;
+   for (uint32_t bci = 0; iProfiler && bci < record._bytecodeSize; bci++)
+      {
+      TR_IPBytecodeHashTableEntry *entry = iProfiler->searchForSnapshotSample(bytecodeStart + bci);
+      if (!entry || entry->isInvalid())
+         continue;
+      union
+         {
+         TR_IPBCDataFourBytesStorage fourBytes;
+         TR_IPBCDataEightWordsStorage eightWords;
+         uint8_t bytes[sizeof(TR_IPBCDataEightWordsStorage) + 8];
+         } storage;
+      memset(&storage, 0, sizeof(storage));
+      uint32_t entrySize;
+      if (entry->asIPBCDataFourBytes() && entry->getData() != 0)
+         {
+         storage.fourBytes.header.ID = TR_IPBCD_FOUR_BYTES;
+         storage.fourBytes.data = (uint32_t)entry->getData();
+         entrySize = alignRecordSize(sizeof(TR_IPBCDataFourBytesStorage));
+         }
+      else if (entry->asIPBCDataEightWords())
+         {
+         storage.eightWords.header.ID = TR_IPBCD_EIGHT_WORDS;
+         memcpy(storage.eightWords.data, entry->asIPBCDataEightWords()->getDataPointer(), sizeof(storage.eightWords.data));
+         entrySize = alignRecordSize(sizeof(TR_IPBCDataEightWordsStorage));
+         }
+      else
+         {
+         continue;
+         }
+      storage.fourBytes.header.pc = bci;
+      append(buffer, storage.bytes, entrySize);
+      numEntries++;
+      }
+
+   if (buffer->_failed)
+      return 0;
+
+   record._numIProfilerEntries = numEntries;
+   record._recordSize = buffer->_size - recordStart;
+   memcpy(buffer->_data + recordStart, &record, sizeof(record));
+
+   *numIProfilerEntries = numEntries;
+   return record._recordSize;
+   }
+
+bool
+TR_JitProfileSnapshot::write(J9VMThread *vmThread)
+   {
+   _writeRequested = false;
+   // Shutdown and a signal-triggered write may overlap; the second one is dropped
+   if (0 != VM_AtomicSupport::lockCompareExchangeU32((uint32_t *)&_writeInProgress, 0, 1))
+      return false;
+
+   J9JavaVM *javaVM = _jitConfig->javaVM;
+   PORT_ACCESS_FROM_JAVAVM(javaVM);
+   uint64_t startTime = j9time_current_time_millis();
+
+   FileHeader header;
+   header._magic = SNAPSHOT_MAGIC;
+   header._version = SNAPSHOT_VERSION;
+   header._numMethods = 0;
+   header._dataSize = 0;
+
+   TR_IProfiler *iProfiler = TR_J9VMBase::get(_jitConfig, NULL)->getIProfiler();
+   uint32_t numIProfilerEntries = 0;
+
+   // The records are built in memory so that no file I/O is done with VM access
+   SnapshotBuffer buffer;
+   buffer._data = NULL;
+   buffer._size = 0;
+   buffer._capacity = 0;
+   buffer._failed = false;
+
+   // Holding VM access prevents classes from being unloaded during the walk
+   bool threadHadNoVMAccess = (!(vmThread->publicFlags & J9_PUBLIC_FLAGS_VM_ACCESS));
+   if (threadHadNoVMAccess)
+      acquireVMAccess(vmThread);
+
+   J9ClassWalkState classWalkState;
+   J9Class *clazz = javaVM->internalVMFunctions->allLiveClassesStartDo(&classWalkState, javaVM, NULL);
+   while (clazz && !buffer._failed)
+      {
+      // Anonymous class names are generated and would not match in the next run
+      if (!J9ROMCLASS_IS_PRIMITIVE_OR_ARRAY(clazz->romClass) &&
+          !J9_ARE_ALL_BITS_SET(clazz->romClass->extraModifiers, J9AccClassAnonClass))
+         {
+         J9Method *ramMethods = clazz->ramMethods;
+         for (uint32_t m = 0; m < clazz->romClass->romMethodCount; m++)
+            {
+            uint32_t numEntries = 0;
+            uint32_t recordSize = writeMethodRecord(&buffer, &ramMethods[m], iProfiler, &numEntries);
+            if (recordSize)
+               {
+               header._numMethods++;
+               header._dataSize += recordSize;
+               numIProfilerEntries += numEntries;
+               }
+            }
+         }
+      clazz = javaVM->internalVMFunctions->allLiveClassesNextDo(&classWalkState);
+      }
+   javaVM->internalVMFunctions->allLiveClassesEndDo(&classWalkState);
+
+   if (threadHadNoVMAccess)
+      releaseVMAccess(vmThread);
+
+   // Write to a temporary file and rename it, so that a crash while writing
+   // does not destroy the snapshot of the previous run
+   bool success = !buffer._failed;
+   char tmpFileName[1024];
+   j9str_printf(PORTLIB, tmpFileName, sizeof(tmpFileName), "%s.tmp", _fileName);
+   if (success)
+      {
+      IDATA fd = j9file_open(tmpFileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0660);
+      if (fd == -1)
+         {
+         success = false;
+         }
+      else
+         {
+         success = (j9file_write(fd, &header, sizeof(header)) == sizeof(header)) &&
+                   (buffer._size == 0 || j9file_write(fd, buffer._data, buffer._size) == (IDATA)buffer._size);
+         j9file_close(fd);
+         }
+      }
+   if (buffer._data)
+      jitPersistentFree(buffer._data);
+
+   if (success)
+      {
+      j9file_unlink(_fileName);
+      success = (j9file_move(tmpFileName, _fileName) == 0);
+      }
+
+   if (success)
+      {
+      _numMethodsWritten = header._numMethods;
+      _numIProfilerEntriesWritten = numIProfilerEntries;
+      }
+   if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerbosePerformance))
+      {
+      if (success)
+         TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "Wrote profile snapshot %s: %u methods, %u IProfiler entries in %u ms",
+            _fileName, header._numMethods, numIProfilerEntries, (uint32_t)(j9time_current_time_millis() - startTime));
+      else
+         TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "Cannot write profile snapshot %s", _fileName);
+      }
+   _writeInProgress = 0;
+   return success;
+   }
+
+void
+TR_JitProfileSnapshot::printStats()
+   {
+   TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "Profile snapshot %s: methods loaded=%u countsLowered=%u optLevelsApplied=%u IProfilerEntriesRestored=%u",
+      _fileName, _numMethodsLoaded, _numCountsLowered, _numOptLevelsApplied, _numIProfilerEntriesRestored);
+   }
@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef JITPROFILESNAPSHOT_HPP
+#define JITPROFILESNAPSHOT_HPP
+
+#pragma once
+
+#include <stdint.h>
+#include "compile/CompilationTypes.hpp"
+#include "env/TRMemory.hpp"
+
+extern "C" {
+struct J9JITConfig;
+struct J9Method;
+struct J9VMThread;
+}
+class TR_IProfiler;
+
+/**
+ * Profile snapshot used to shorten the time to peak performance across restarts.
+ *
+ * For every method that was compiled, or was close to being compiled, the snapshot
+ * records the opt level reached by its last body, an estimate of its interpreted
+ * invocation count and the IProfiler branch and switch entries of its bytecodes.
+ * Methods are identified by class name, name and signature so that the data survives
+ * a restart of the process.
+ *
+ * The snapshot is written at JIT shutdown and, on a user signal, by the sampling thread.
+ * When a snapshot is found at startup, the initial counts of the recorded methods are
+ * lowered and the compilation controller schedules their first compilation directly at
+ * the opt level reached in the previous run, after seeding IProfiler with the recorded
+ * entries.
+ */
+class TR_JitProfileSnapshot
+   {
+public:
+   TR_PERSISTENT_ALLOC(TR_Memory::PersistentInfo);
+
+   static const uint32_t SNAPSHOT_MAGIC   = 0x5353504A; // "JPSS"
+   static const uint32_t SNAPSHOT_VERSION = 1;
+   static const int8_t   NOT_COMPILED     = -1;
+
+   // On-disk layout, in the byte order of the machine that wrote the file
+   struct FileHeader
+      {
+      uint32_t _magic;
+      uint32_t _version;
+      uint32_t _numMethods;
+      uint32_t _dataSize; // number of bytes of method records following the header
+      };
+
+   // Followed by the class name, the method name and the signature, padded to a multiple
+   // of 8 bytes, and then by _numIProfilerEntries TR_IPBCDataFourBytesStorage or
+   // TR_IPBCDataEightWordsStorage entries whose header.pc holds the bytecode index
+   struct MethodRecord
+      {
+      uint32_t _invocationCount;
+      int8_t   _hotness;         // TR_Hotness of the last body or NOT_COMPILED
+      uint8_t  _flags;
+      uint16_t _classNameLength;
+      uint16_t _nameLength;
+      uint16_t _signatureLength;
+      uint32_t _bytecodeSize;    // records whose method changed between runs are ignored
+      uint32_t _numIProfilerEntries;
+      uint32_t _recordSize;      // total size of the record, a multiple of 8
+      };
+
+   enum MethodRecordFlags
+      {
+      ProfilingBody = 0x01,
+      AotedBody     = 0x02,
+      };
+
+   static TR_JitProfileSnapshot *allocate(J9JITConfig *jitConfig, const char *fileName);
+
+   /**
+    * @brief Lower the initial invocation count of a method found in the snapshot
+    * @param method the method whose send target is being initialized
+    * @param count the count that would otherwise be used
+    * @return the count to use for the method
+    */
+   int32_t getInitialCount(J9Method *method, int32_t count);
+
+   /**
+    * @brief Choose the opt level of the first compilation of a method
+    *
+    * If the method reached a higher opt level in the previous run, the IProfiler
+    * entries recorded for it are restored and the recorded level is returned,
+    * capped at veryHot so that the usual profiling step still precedes scorching.
+    */
+   TR_Hotness getFirstCompilationOptLevel(J9Method *method, TR_Hotness defaultLevel);
+
+   /// Write the snapshot; returns false if the file could not be written
+   bool write(J9VMThread *vmThread);
+
+   void requestWrite() { _writeRequested = true; }
+   bool isWriteRequested() const { return _writeRequested; }
+
+   void printStats();
+
+private:
+   struct SnapshotMethod
+      {
+      SnapshotMethod *_next;
+      const MethodRecord *_record;
+      const char *_className;
+      const char *_name;
+      const char *_signature;
+      const uint8_t *_iprofilerEntries;
+      uint32_t _hash;
+      volatile uint32_t _iprofilerEntriesRestored;
+      };
+
+   // Records are built in memory while VM access is held and written to the file afterwards
+   struct SnapshotBuffer
+      {
+      uint8_t *_data;
+      uint32_t _size;
+      uint32_t _capacity;
+      bool _failed; // the buffer could not grow; the snapshot is not written
+      };
+
+   static const int32_t HASH_TABLE_SIZE = 4093;
+   static const uint32_t INITIAL_BUFFER_SIZE = 64 * 1024;
+
+   TR_JitProfileSnapshot(J9JITConfig *jitConfig, const char *fileName);
+
+   bool load();
+   SnapshotMethod *findMethod(J9Method *method);
+   uint32_t restoreIProfilerEntries(SnapshotMethod *snapshotMethod, J9Method *method, TR_IProfiler *iProfiler);
+   uint32_t writeMethodRecord(SnapshotBuffer *buffer, J9Method *method, TR_IProfiler *iProfiler, uint32_t *numIProfilerEntries);
+   static bool append(SnapshotBuffer *buffer, const void *data, uint32_t length);
+
+   static uint32_t hashName(uint32_t hash, const char *data, uint32_t length);
+   static uint32_t alignRecordSize(uint32_t size) { return (size + 7) & ~7; }
+
+   J9JITConfig *_jitConfig;
+   const char *_fileName;
+   uint8_t *_data;              // method records read at startup
+   SnapshotMethod **_hashTable;
+   volatile bool _writeRequested;
+   volatile uint32_t _writeInProgress;
+
+   // statistics
+   uint32_t _numMethodsLoaded;
+   uint32_t _numCountsLowered;
+   uint32_t _numOptLevelsApplied;
+   uint32_t _numIProfilerEntriesRestored;
+   uint32_t _numMethodsWritten;
+   uint32_t _numIProfilerEntriesWritten;
+   };
+
+#endif // JITPROFILESNAPSHOT_HPP
@@ -79,6 +79,7 @@ void TR_MethodToBeCompiled::initialize(TR::IlGeneratorMethodDetails & details, v
    _entryShouldBeDeallocated = false;
    _hasIncrementedNumCompThreadsCompilingHotterMethods = false;
    _weight = 0;
+   _virtualFinishTime = 0;
    _jitStateWhenQueued = UNDEFINED_STATE;
    _entryIsCountedAsInvRequest = false;
    _GCRrequest = false;
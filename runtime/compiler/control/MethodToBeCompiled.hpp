@@ -89,6 +89,7 @@ struct TR_MethodToBeCompiled
    char                   _monitorName[30]; // to be able to deallocate the string
    TR_OptimizationPlan   *_optimizationPlan;
    uint64_t              _entryTime; // time it was added to the queue (ms)
+   uint64_t              _virtualFinishTime; // ordering tag set by TR_WeightedFairSchedulingPolicy; 0 means not tagged
    TR::CompilationInfoPerThreadBase *_compInfoPT; // pointer to the thread that is handling this request
    const void *           _aotCodeToBeRelocated;
 
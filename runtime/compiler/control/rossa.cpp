@@ -52,6 +52,7 @@
 #include "control/CompilationRuntime.hpp"
 #include "control/CompilationThread.hpp"
 #include "control/JitDump.hpp"
+#include "control/JitProfileSnapshot.hpp"
 #include "control/Recompilation.hpp"
 #include "control/RecompilationInfo.hpp"
 #include "runtime/ArtifactManager.hpp"
@@ -1491,6 +1492,25 @@ onLoadInternal(
       }
 #endif
 
+   TR_CompQueueSchedulingPolicy *compQueueSchedulingPolicy = TR_CompQueueSchedulingPolicy::allocate(compInfo);
+   if (compQueueSchedulingPolicy == NULL)
+      return -1;
+   compInfo->setCompQueueSchedulingPolicy(compQueueSchedulingPolicy);
+
+   // The profile snapshot must be read before counts are set for the methods of loaded classes
+   char *profileSnapshotFileName = ((TR_JitPrivateConfig*)jitConfig->privateConfig)->profileSnapshotFileName;
+   if (profileSnapshotFileName
+#if defined(J9VM_OPT_JITSERVER)
+       && compInfo->getPersistentInfo()->getRemoteCompilationMode() != JITServer::SERVER
+#endif
+      )
+      {
+      TR_JitProfileSnapshot *profileSnapshot = TR_JitProfileSnapshot::allocate(jitConfig, profileSnapshotFileName);
+      if (profileSnapshot == NULL)
+         return -1;
+      compInfo->setProfileSnapshot(profileSnapshot);
+      }
+
    // create comp threads if compiling on separate thread
    if (compInfo->useSeparateCompilationThread())
       {
@@ -1700,6 +1720,9 @@ onLoadInternal(
 
       compInfo->setNewlyExtendedClasses(new (PERSISTENT_NEW) PersistentUnorderedMap<TR_OpaqueClassBlock*, uint8_t>(
          PersistentUnorderedMap<TR_OpaqueClassBlock*, uint8_t>::allocator_type(TR::Compiler->persistentAllocator())));
+
+      compInfo->setClassesPrefetchedToServer(new (PERSISTENT_NEW) PersistentUnorderedSet<TR_OpaqueClassBlock*>(
+         PersistentUnorderedSet<TR_OpaqueClassBlock*>::allocator_type(TR::Compiler->persistentAllocator())));
       // Try to initialize SSL
       if (JITServer::ClientStream::static_init(compInfo->getPersistentInfo()) != 0)
          return -1;
@@ -427,8 +427,7 @@ JITClientPersistentCHTable::classGotLoaded(
    TR_PersistentClassInfo *clazz = new (PERSISTENT_NEW) TR_JITClientPersistentClassInfo(classId, this);
    if (clazz)
       {
-      auto classes = getClasses();
-      classes[TR_RuntimeAssumptionTable::hashCode((uintptr_t) classId) % CLASSHASHTABLE_SIZE].add(clazz);
+      addClassInfo(clazz);
       }
    return clazz;
    }
@@ -473,7 +472,7 @@ size_t
 JITClientPersistentCHTable::collectEntireHierarchy(std::vector<TR_PersistentClassInfo*> &out) const
    {
    size_t spaceNeeded = 0;
-   for (size_t bucketIdx = 0; bucketIdx < CLASSHASHTABLE_SIZE + 1; ++bucketIdx)
+   for (size_t bucketIdx = 0; bucketIdx < getNumBuckets(); ++bucketIdx)
       for (TR_PersistentClassInfo *cl = (getClasses())[bucketIdx].getFirst(); cl; cl = cl->getNext())
          {
          spaceNeeded += FlatPersistentClassInfo::classSize(cl);
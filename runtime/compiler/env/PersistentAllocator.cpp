@@ -20,7 +20,10 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <stdio.h>
+#include <string.h>
 #include "env/PersistentAllocator.hpp"
+#include "env/VerboseLog.hpp"
 #include "il/DataTypes.hpp"
 #include "infra/Monitor.hpp"
 
@@ -32,12 +35,32 @@ PersistentAllocator::PersistentAllocator(const PersistentAllocatorKit &creationK
    _minimumSegmentSize(creationKit.minimumSegmentSize),
    _segmentAllocator(MEMORY_TYPE_JIT_PERSISTENT, creationKit.javaVM),
    _freeBlocks(),
-   _segments(SegmentContainerAllocator(RawAllocator(&creationKit.javaVM)))
+   _segments(SegmentContainerAllocator(RawAllocator(&creationKit.javaVM))),
+   _rawAllocator(&creationKit.javaVM),
+   _threadCachesEnabled(false),
+   _threadCacheKey(0),
+   _threadCaches(NULL),
+   _slabBytes(0)
    {
+   if (creationKit.enableThreadCaches)
+      _threadCachesEnabled = (0 == omrthread_tls_alloc_with_finalizer(&_threadCacheKey, threadCacheFinalizer));
    }
 
 PersistentAllocator::~PersistentAllocator() throw()
    {
+   if (_threadCachesEnabled)
+      {
+      // The blocks held by the caches live in the segments released below
+      _threadCachesEnabled = false;
+      omrthread_tls_free(_threadCacheKey);
+      while (_threadCaches)
+         {
+         ThreadCache *cache = _threadCaches;
+         _threadCaches = cache->_next;
+         _rawAllocator.deallocate(cache);
+         }
+      }
+
    while (!_segments.empty())
       {
       J9MemorySegment &segment = _segments.front();
@@ -49,6 +72,15 @@ PersistentAllocator::~PersistentAllocator() throw()
 void *
 PersistentAllocator::allocate(size_t size, const std::nothrow_t tag, void * hint) throw()
    {
+   ThreadCache *cache = getThreadCache();
+   if (cache)
+      {
+      size_t const allocSize = sizeof(Block) + mem_round(size);
+      size_t const index = freeBlocksIndex(allocSize);
+      if (index != 0)
+         return allocateFromThreadCache(cache, index, allocSize);
+      }
+
    if (::memoryAllocMonitor)
       ::memoryAllocMonitor->enter();
 
@@ -120,12 +152,21 @@ PersistentAllocator::allocateLocked(size_t requestedSize)
       return block + 1;
       }
 
+   J9MemorySegment *segment = findOrAllocateSegment(allocSize);
+   if (!segment) return 0;
+   block = new(operator new(allocSize, *segment)) Block(allocSize);
+   return block + 1;
+   }
+
+J9MemorySegment *
+PersistentAllocator::findOrAllocateSegment(size_t requiredSize)
+   {
    // Find the first persistent segment with enough free space
    //
-   J9MemorySegment *segment = findUsableSegment(allocSize);
+   J9MemorySegment *segment = findUsableSegment(requiredSize);
    if (!segment)
       {
-      size_t const segmentSize = allocSize < _minimumSegmentSize ? _minimumSegmentSize : allocSize;
+      size_t const segmentSize = requiredSize < _minimumSegmentSize ? _minimumSegmentSize : requiredSize;
       segment = _segmentAllocator.allocate(segmentSize, std::nothrow);
       if (!segment) return 0;
       try
@@ -138,9 +179,8 @@ PersistentAllocator::allocateLocked(size_t requestedSize)
          return 0;
          }
       }
-   TR_ASSERT(segment && remainingSpace(*segment) >= allocSize, "Failed to acquire a segment");
-   block = new(operator new(allocSize, *segment)) Block(allocSize);
-   return block + 1;
+   TR_ASSERT(segment && remainingSpace(*segment) >= requiredSize, "Failed to acquire a segment");
+   return segment;
    }
 
 J9MemorySegment *
@@ -196,11 +236,21 @@ PersistentAllocator::freeBlock(Block * block)
 void
 PersistentAllocator::deallocate(void * mem, size_t) throw()
    {
-   if (::memoryAllocMonitor)
-      ::memoryAllocMonitor->enter();
+   Block * block = static_cast<Block *>(mem) - 1;
 
+   ThreadCache *cache = getThreadCache();
+   if (cache)
+      {
+      size_t const index = freeBlocksIndex(block->_size);
+      if (index != 0)
+         {
+         deallocateToThreadCache(cache, index, block);
+         return;
+         }
+      }
 
-   Block * block = static_cast<Block *>(mem) - 1;
+   if (::memoryAllocMonitor)
+      ::memoryAllocMonitor->enter();
 
    // adjust the used persistent memory here and not in freePersistentmemory(block, size)
    // because that call is also used to free memory that wasn't actually committed
@@ -212,6 +262,285 @@ PersistentAllocator::deallocate(void * mem, size_t) throw()
       ::memoryAllocMonitor->exit();
    }
 
+PersistentAllocator::ThreadCache *
+PersistentAllocator::getThreadCache() throw()
+   {
+   if (!_threadCachesEnabled)
+      return NULL;
+
+   omrthread_t self = omrthread_self();
+   if (!self)
+      return NULL;
+
+   return static_cast<ThreadCache *>(omrthread_tls_get(self, _threadCacheKey));
+   }
+
+void
+PersistentAllocator::attachThreadCache() throw()
+   {
+   // Without the monitor (early startup, debug extensions) there is nothing to save
+   if (!_threadCachesEnabled || !::memoryAllocMonitor || getThreadCache())
+      return;
+
+   ThreadCache *cache = static_cast<ThreadCache *>(_rawAllocator.allocate(sizeof(ThreadCache), std::nothrow));
+   if (!cache)
+      return;
+   memset(cache, 0, sizeof(ThreadCache));
+   cache->_allocator = this;
+   if (0 != omrthread_tls_set(omrthread_self(), _threadCacheKey, cache))
+      {
+      _rawAllocator.deallocate(cache);
+      return;
+      }
+
+   ::memoryAllocMonitor->enter();
+   cache->_next = _threadCaches;
+   _threadCaches = cache;
+   ::memoryAllocMonitor->exit();
+   }
+
+void
+PersistentAllocator::releaseThreadCache() throw()
+   {
+   ThreadCache *cache = getThreadCache();
+   if (!cache)
+      return;
+
+   omrthread_tls_set(omrthread_self(), _threadCacheKey, NULL);
+
+   ::memoryAllocMonitor->enter();
+   releaseThreadCacheLocked(cache);
+   ::memoryAllocMonitor->exit();
+
+   _rawAllocator.deallocate(cache);
+   }
+
+void *
+PersistentAllocator::allocateFromThreadCache(ThreadCache *cache, size_t index, size_t allocSize) throw()
+   {
+   Block *block = cache->_freeBlocks[index];
+   if (!block)
+      {
+      // Refill with a batch of blocks: first the ones other threads returned to
+      // the central list, then a slab carved from a segment for the remainder.
+      //
+      uint32_t numBlocks = 0;
+      ::memoryAllocMonitor->enter();
+      while (numBlocks < THREAD_CACHE_BATCH_SIZE && _freeBlocks[index])
+         {
+         block = _freeBlocks[index];
+         _freeBlocks[index] = block->next();
+         block->_next = cache->_freeBlocks[index];
+         cache->_freeBlocks[index] = block;
+         numBlocks++;
+         }
+      if (numBlocks < THREAD_CACHE_BATCH_SIZE)
+         {
+         uint32_t numCarved = 0;
+         Block *slab = carveSlabLocked(allocSize, THREAD_CACHE_BATCH_SIZE - numBlocks, numCarved);
+         if (slab)
+            {
+            Block *last = slab;
+            while (last->_next)
+               last = last->_next;
+            last->_next = cache->_freeBlocks[index];
+            cache->_freeBlocks[index] = slab;
+            numBlocks += numCarved;
+            }
+         }
+      meterThreadCacheLocked(cache);
+      ::memoryAllocMonitor->exit();
+
+      cache->_numFreeBlocks[index] += numBlocks;
+      block = cache->_freeBlocks[index];
+      if (!block)
+         return 0;
+      }
+
+   TR_ASSERT(block->_size == allocSize, "block %p in thread cache for index %d has size %d (not %d)\n", block, index, block->_size, allocSize);
+   cache->_freeBlocks[index] = block->next();
+   cache->_numFreeBlocks[index]--;
+   cache->_unmeteredBytes += allocSize;
+   block->_next = NULL;
+   return block + 1;
+   }
+
+void
+PersistentAllocator::deallocateToThreadCache(ThreadCache *cache, size_t index, Block *block) throw()
+   {
+   TR_ASSERT(block->_next == NULL, "In-use persistent memory block @ belongs to a free block chain.", block);
+   block->_next = cache->_freeBlocks[index];
+   cache->_freeBlocks[index] = block;
+   cache->_unmeteredBytes -= block->_size;
+   if (++cache->_numFreeBlocks[index] > THREAD_CACHE_MAX_BLOCKS)
+      {
+      ::memoryAllocMonitor->enter();
+      flushThreadCacheLocked(cache, index, THREAD_CACHE_BATCH_SIZE);
+      meterThreadCacheLocked(cache);
+      ::memoryAllocMonitor->exit();
+      }
+   }
+
+PersistentAllocator::Block *
+PersistentAllocator::carveSlabLocked(size_t allocSize, uint32_t numBlocks, uint32_t &numCarved)
+   {
+   numCarved = 0;
+
+   // Prefer a segment that can hold the whole slab; otherwise use what is left
+   // of the first segment that fits at least one block
+   //
+   J9MemorySegment *segment = findUsableSegment(allocSize * numBlocks);
+   if (!segment)
+      {
+      segment = findOrAllocateSegment(allocSize);
+      if (!segment) return 0;
+      size_t const fit = remainingSpace(*segment) / allocSize;
+      if (fit < numBlocks)
+         numBlocks = static_cast<uint32_t>(fit);
+      }
+
+   uint8_t *slab = static_cast<uint8_t *>(operator new(allocSize * numBlocks, *segment));
+   Block *chain = 0;
+   for (uint32_t i = numBlocks; i > 0; --i)
+      chain = new (slab + (i - 1) * allocSize) Block(allocSize, chain);
+
+   _slabBytes += allocSize * numBlocks;
+   numCarved = numBlocks;
+   return chain;
+   }
+
+void
+PersistentAllocator::flushThreadCacheLocked(ThreadCache *cache, size_t index, uint32_t numBlocks)
+   {
+   for (uint32_t i = 0; i < numBlocks && cache->_freeBlocks[index]; ++i)
+      {
+      Block *block = cache->_freeBlocks[index];
+      cache->_freeBlocks[index] = block->next();
+      cache->_numFreeBlocks[index]--;
+      block->_next = NULL;
+      freeBlock(block);
+      }
+   }
+
+void
+PersistentAllocator::meterThreadCacheLocked(ThreadCache *cache)
+   {
+   if (cache->_unmeteredBytes > 0)
+      TR::AllocatedMemoryMeter::update_allocated(cache->_unmeteredBytes, persistentAlloc);
+   else if (cache->_unmeteredBytes < 0)
+      TR::AllocatedMemoryMeter::update_freed(-cache->_unmeteredBytes, persistentAlloc);
+   cache->_unmeteredBytes = 0;
+   }
+
+void
+PersistentAllocator::releaseThreadCacheLocked(ThreadCache *cache)
+   {
+   for (size_t index = 1; index < PERSISTANT_BLOCK_SIZE_BUCKETS; ++index)
+      flushThreadCacheLocked(cache, index, cache->_numFreeBlocks[index]);
+   meterThreadCacheLocked(cache);
+
+   ThreadCache **link = &_threadCaches;
+   while (*link && *link != cache)
+      link = &(*link)->_next;
+   if (*link)
+      *link = cache->_next;
+   }
+
+void
+PersistentAllocator::threadCacheFinalizer(void *data)
+   {
+   ThreadCache *cache = static_cast<ThreadCache *>(data);
+   PersistentAllocator *allocator = cache->_allocator;
+
+   ::memoryAllocMonitor->enter();
+   allocator->releaseThreadCacheLocked(cache);
+   ::memoryAllocMonitor->exit();
+
+   allocator->_rawAllocator.deallocate(cache);
+   }
+
+void
+PersistentAllocator::printStatistics(bool toVerboseLog)
+   {
+   size_t numSegments = 0;
+   size_t segmentBytes = 0;
+   size_t unusedBytes = 0;
+   size_t numFixedFree[PERSISTANT_BLOCK_SIZE_BUCKETS] = { 0 };
+   size_t fixedFreeBytes = 0;
+   size_t numVariableFree = 0;
+   size_t variableFreeBytes = 0;
+   size_t largestVariableFree = 0;
+   size_t numThreadCaches = 0;
+   size_t threadCachedBytes = 0;
+   size_t slabBytes = 0;
+
+   if (::memoryAllocMonitor)
+      ::memoryAllocMonitor->enter();
+
+   for (auto i = _segments.begin(); i != _segments.end(); ++i)
+      {
+      J9MemorySegment &segment = *i;
+      numSegments++;
+      segmentBytes += segment.heapTop - segment.heapBase;
+      unusedBytes += remainingSpace(segment);
+      }
+   for (size_t index = 1; index < PERSISTANT_BLOCK_SIZE_BUCKETS; ++index)
+      {
+      for (Block *block = _freeBlocks[index]; block; block = block->next())
+         {
+         numFixedFree[index]++;
+         fixedFreeBytes += block->_size;
+         }
+      }
+   for (Block *block = _freeBlocks[0]; block; block = block->next())
+      {
+      numVariableFree++;
+      variableFreeBytes += block->_size;
+      largestVariableFree = block->_size; // the chain is in ascending size order
+      }
+   // The per-thread counts are read without the owners' cooperation, so they are approximate
+   for (ThreadCache *cache = _threadCaches; cache; cache = cache->_next)
+      {
+      numThreadCaches++;
+      for (size_t index = 1; index < PERSISTANT_BLOCK_SIZE_BUCKETS; ++index)
+         threadCachedBytes += cache->_numFreeBlocks[index] * (sizeof(Block) + index * sizeof(void *));
+      }
+   slabBytes = _slabBytes;
+
+   if (::memoryAllocMonitor)
+      ::memoryAllocMonitor->exit();
+
+   size_t const carvedBytes = segmentBytes - unusedBytes;
+   size_t const freeBytes = fixedFreeBytes + variableFreeBytes + threadCachedBytes;
+   size_t const fragmentation = carvedBytes ? (freeBytes * 100) / carvedBytes : 0;
+
+   char fixedFreeCounts[PERSISTANT_BLOCK_SIZE_BUCKETS * 12] = "";
+   size_t length = 0;
+   for (size_t index = 1; index < PERSISTANT_BLOCK_SIZE_BUCKETS && length < sizeof(fixedFreeCounts); ++index)
+      length += snprintf(fixedFreeCounts + length, sizeof(fixedFreeCounts) - length, " %d:%d", (int)(sizeof(Block) + index * sizeof(void *)), (int)numFixedFree[index]);
+
+   if (toVerboseLog)
+      {
+      TR_VerboseLog::vlogAcquire();
+      TR_VerboseLog::writeLine(TR_Vlog_MEMORY, "Persistent allocator: segments=%zu segmentKB=%zu unusedKB=%zu slabKB=%zu fragmentation=%zu%%",
+         numSegments, segmentBytes >> 10, unusedBytes >> 10, slabBytes >> 10, fragmentation);
+      TR_VerboseLog::writeLine(TR_Vlog_MEMORY, "Persistent allocator: fixed free blocks (size:count)%s totalKB=%zu",
+         fixedFreeCounts, fixedFreeBytes >> 10);
+      TR_VerboseLog::writeLine(TR_Vlog_MEMORY, "Persistent allocator: variable free blocks=%zu totalKB=%zu largest=%zu threadCaches=%zu threadCachedKB=%zu",
+         numVariableFree, variableFreeBytes >> 10, largestVariableFree, numThreadCaches, threadCachedBytes >> 10);
+      TR_VerboseLog::vlogRelease();
+      }
+   else
+      {
+      fprintf(stderr, "Persistent allocator: segments=%zu segmentKB=%zu unusedKB=%zu slabKB=%zu fragmentation=%zu%%\n",
+         numSegments, segmentBytes >> 10, unusedBytes >> 10, slabBytes >> 10, fragmentation);
+      fprintf(stderr, "Persistent allocator: fixed free blocks (size:count)%s totalKB=%zu\n",
+         fixedFreeCounts, fixedFreeBytes >> 10);
+      fprintf(stderr, "Persistent allocator: variable free blocks=%zu totalKB=%zu largest=%zu threadCaches=%zu threadCachedKB=%zu\n",
+         numVariableFree, variableFreeBytes >> 10, largestVariableFree, numThreadCaches, threadCachedBytes >> 10);
+      }
+   }
+
 }
 
 void *
@@ -35,6 +35,7 @@ namespace TR { using J9::PersistentAllocator; }
 #include "env/J9SegmentAllocator.hpp"
 #include "infra/ReferenceWrapper.hpp"
 #include "env/MemorySegment.hpp"
+#include "omrthread.h"
 #include <deque>
 
 extern "C" {
@@ -53,6 +54,28 @@ public:
    void *allocate(size_t size, void * hint = 0);
    void deallocate(void * p, size_t sizeHint = 0) throw();
 
+   /**
+    * @brief Report segment usage, free list contents and thread cache occupancy
+    * @param toVerboseLog write the report to the verbose log instead of stderr
+    */
+   void printStatistics(bool toVerboseLog);
+
+   /**
+    * @brief Give the calling thread a cache of small blocks, if thread caching is enabled
+    *
+    * Only compilation threads, which allocate persistent memory at a high rate,
+    * take a cache; other threads use the central free lists.
+    */
+   void attachThreadCache() throw();
+
+   /**
+    * @brief Return the blocks cached by the calling thread to the central free lists
+    *
+    * Called when a compilation thread suspends or stops, so that a thread which no
+    * longer compiles does not keep memory that other threads could use.
+    */
+   void releaseThreadCache() throw();
+
    friend bool operator ==(const PersistentAllocator &left, const PersistentAllocator &right)
       {
       return &left == &right;
@@ -85,10 +108,38 @@ private:
          0;
       }
 
+   // Per-thread cache of small blocks, indexed like _freeBlocks. Blocks move
+   // between a cache and the central free lists in batches, so the monitor is
+   // taken once per batch instead of once per allocation. Cached blocks are free
+   // as far as the memory meter is concerned; the bytes a thread allocates and
+   // frees through its cache are reported whenever the monitor is next taken.
+   //
+   struct ThreadCache
+      {
+      Block * _freeBlocks[PERSISTANT_BLOCK_SIZE_BUCKETS];
+      uint32_t _numFreeBlocks[PERSISTANT_BLOCK_SIZE_BUCKETS];
+      intptr_t _unmeteredBytes; // allocated minus freed through the cache since last reported
+      PersistentAllocator * _allocator;
+      ThreadCache * _next; // all caches of this allocator, for teardown
+      };
+
+   static const uint32_t THREAD_CACHE_BATCH_SIZE = 32; // blocks moved per refill or flush
+   static const uint32_t THREAD_CACHE_MAX_BLOCKS = 2 * THREAD_CACHE_BATCH_SIZE; // per size class
+
    void * allocateLocked(size_t);
    void freeBlock(Block *);
 
+   ThreadCache * getThreadCache() throw();
+   void * allocateFromThreadCache(ThreadCache *cache, size_t index, size_t allocSize) throw();
+   void deallocateToThreadCache(ThreadCache *cache, size_t index, Block *block) throw();
+   Block * carveSlabLocked(size_t allocSize, uint32_t numBlocks, uint32_t &numCarved);
+   void flushThreadCacheLocked(ThreadCache *cache, size_t index, uint32_t numBlocks);
+   void meterThreadCacheLocked(ThreadCache *cache);
+   void releaseThreadCacheLocked(ThreadCache *cache);
+   static void threadCacheFinalizer(void *cache);
+
    J9MemorySegment * findUsableSegment(size_t requiredSize);
+   J9MemorySegment * findOrAllocateSegment(size_t requiredSize);
 
    static void * allocate(J9MemorySegment &memorySegment, size_t size) throw();
    static size_t remainingSpace(J9MemorySegment &memorySegment) throw();
@@ -99,6 +150,12 @@ private:
    typedef TR::typed_allocator<TR::reference_wrapper<J9MemorySegment>, TR::RawAllocator> SegmentContainerAllocator;
    typedef std::deque<TR::reference_wrapper<J9MemorySegment>, SegmentContainerAllocator> SegmentContainer;
    SegmentContainer _segments;
+
+   RawAllocator _rawAllocator;
+   bool _threadCachesEnabled;
+   omrthread_tls_key_t _threadCacheKey;
+   ThreadCache * _threadCaches;
+   size_t _slabBytes; // bytes carved from segments to refill thread caches
    };
 
 }
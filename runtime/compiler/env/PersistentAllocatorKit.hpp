@@ -39,14 +39,16 @@ namespace J9
 
 struct PersistentAllocatorKit
    {
-   PersistentAllocatorKit(size_t const minimumSegmentSize, J9JavaVM &javaVM) :
+   PersistentAllocatorKit(size_t const minimumSegmentSize, J9JavaVM &javaVM, bool const enableThreadCaches = false) :
       minimumSegmentSize(minimumSegmentSize),
-      javaVM(javaVM)
+      javaVM(javaVM),
+      enableThreadCaches(enableThreadCaches)
       {
       }
 
    size_t const minimumSegmentSize;
    J9JavaVM &javaVM;
+   bool const enableThreadCaches; // small blocks are cached per thread; requires the VM threading library
    };
 
 }
@@ -51,7 +51,10 @@
 class TR_OpaqueClassBlock;
 
 TR_PersistentCHTable::TR_PersistentCHTable(TR_PersistentMemory *trPersistentMemory)
-   : _trPersistentMemory(trPersistentMemory)
+   : _bucketsLog2(CHTABLE_INITIAL_BUCKETS_LOG2),
+     _numClasses(0),
+     _numResizes(0),
+     _trPersistentMemory(trPersistentMemory)
    {
    /*
     * We want to avoid strange memory allocation failures that might occur in a
@@ -60,12 +63,82 @@ TR_PersistentCHTable::TR_PersistentCHTable(TR_PersistentMemory *trPersistentMemo
     * invokes libstdc++. So making a byte array as part of the
     * TR_PersistentCHTable class and pointing _classes (static type casting) to
     * the byte array memory region, after initializing, also does the same work.
+    * Larger bucket arrays are allocated as classes are loaded, see growBuckets().
     */
 
-   memset(_buffer, 0, sizeof(TR_LinkHead<TR_PersistentClassInfo>) * (CLASSHASHTABLE_SIZE + 1));
+   memset(_buffer, 0, sizeof(_buffer));
    _classes = static_cast<TR_LinkHead<TR_PersistentClassInfo> *>(static_cast<void *>(_buffer));
    }
 
+/**
+ * Add persistent JIT class information to the table, growing the table if
+ * the chains have become too long.
+ * The caller must insure that class table lock is obtained
+ */
+void
+TR_PersistentCHTable::addClassInfo(TR_PersistentClassInfo *clazz)
+   {
+   getBucket(clazz->getClassId()).add(clazz);
+   _numClasses++;
+   if ((_numClasses > (getNumBuckets() * CHTABLE_MAX_LOAD_FACTOR)) && (_bucketsLog2 < CHTABLE_MAX_BUCKETS_LOG2))
+      growBuckets();
+   }
+
+/**
+ * Remove persistent JIT class information from the table.
+ * The caller must insure that class table lock is obtained
+ */
+void
+TR_PersistentCHTable::removeClassInfo(TR_PersistentClassInfo *clazz)
+   {
+   TR_LinkHead<TR_PersistentClassInfo> &bucket = getBucket(clazz->getClassId());
+   for (TR_PersistentClassInfo *cl = bucket.getFirst(); cl; cl = cl->getNext())
+      {
+      if (cl == clazz)
+         {
+         bucket.remove(clazz);
+         _numClasses--;
+         return;
+         }
+      }
+   }
+
+/**
+ * Double the number of buckets and rehash the classes into them.
+ * If the larger array cannot be allocated the table keeps its current size.
+ * The caller must insure that class table lock is obtained
+ */
+void
+TR_PersistentCHTable::growBuckets()
+   {
+   uint32_t oldNumBuckets = getNumBuckets();
+   uint32_t newNumBuckets = oldNumBuckets * 2;
+   TR_LinkHead<TR_PersistentClassInfo> *oldClasses = _classes;
+   TR_LinkHead<TR_PersistentClassInfo> *newClasses = (TR_LinkHead<TR_PersistentClassInfo> *)
+      _trPersistentMemory->allocatePersistentMemory(sizeof(TR_LinkHead<TR_PersistentClassInfo>) * newNumBuckets, TR_Memory::PersistentCHTable);
+   if (!newClasses)
+      return;
+
+   memset(newClasses, 0, sizeof(TR_LinkHead<TR_PersistentClassInfo>) * newNumBuckets);
+   _classes = newClasses;
+   _bucketsLog2++;
+   _numResizes++;
+
+   for (uint32_t i = 0; i < oldNumBuckets; ++i)
+      {
+      TR_PersistentClassInfo *cl = oldClasses[i].getFirst();
+      while (cl)
+         {
+         TR_PersistentClassInfo *next = cl->getNext();
+         getBucket(cl->getClassId()).add(cl);
+         cl = next;
+         }
+      }
+
+   if (oldClasses != static_cast<TR_LinkHead<TR_PersistentClassInfo> *>(static_cast<void *>(_buffer)))
+      _trPersistentMemory->freePersistentMemory(oldClasses);
+   }
+
 
 void
 TR_PersistentCHTable::commitSideEffectGuards(TR::Compilation *comp)
@@ -297,7 +370,7 @@ TR_PersistentCHTable::findSingleJittedImplementer(
 TR_PersistentClassInfo *
 TR_PersistentCHTable::findClassInfo(TR_OpaqueClassBlock * classId)
    {
-   TR_PersistentClassInfo *cl = _classes[TR_RuntimeAssumptionTable::hashCode((uintptr_t)classId) % CLASSHASHTABLE_SIZE].getFirst();
+   TR_PersistentClassInfo *cl = getBucket(classId).getFirst();
    while (cl &&
           cl->getClassId() != classId)
       cl = cl->getNext();
@@ -633,19 +706,42 @@ TR_PersistentCHTable::findSingleConcreteSubClass(
    }
 
 
-#ifdef DEBUG
 void
 TR_PersistentCHTable::dumpStats(TR_FrontEnd * fe)
    {
+   TR::ClassTableCriticalSection dumpStats(fe);
+   uint32_t numBuckets = getNumBuckets();
+   uint32_t usedBuckets = 0;
+   uint32_t maxChain = 0;
+   uint32_t chainHistogram[5] = { 0 }; // 1, 2, 3-4, 5-8, >8 classes
+
+   for (uint32_t i = 0; i < numBuckets; ++i)
+      {
+      uint32_t chain = 0;
+      for (TR_PersistentClassInfo *pci = _classes[i].getFirst(); pci; pci = pci->getNext())
+         chain++;
+      if (chain == 0)
+         continue;
+      usedBuckets++;
+      if (chain > maxChain)
+         maxChain = chain;
+      chainHistogram[(chain <= 2) ? (chain - 1) : (chain <= 4) ? 2 : (chain <= 8) ? 3 : 4]++;
+      }
+
+   PORT_ACCESS_FROM_JITCONFIG(((TR_J9VMBase *)fe)->getJ9JITConfig());
+   j9tty_printf(PORTLIB, "Persistent CHTable statistics:\n");
+   j9tty_printf(PORTLIB, "\tclasses=%u buckets=%u used=%u resizes=%u\n", _numClasses, numBuckets, usedBuckets, _numResizes);
+   j9tty_printf(PORTLIB, "\tmax chain=%u average chain=%.2f\n", maxChain, usedBuckets ? (double)_numClasses / usedBuckets : 0.0);
+   j9tty_printf(PORTLIB, "\tchains of length 1=%u 2=%u 3-4=%u 5-8=%u >8=%u\n",
+      chainHistogram[0], chainHistogram[1], chainHistogram[2], chainHistogram[3], chainHistogram[4]);
    }
-#endif
 
 
 void
 TR_PersistentCHTable::dumpMethodCounts(TR_FrontEnd *fe, TR_Memory &trMemory)
    {
    TR_J9VMBase *fej9 = (TR_J9VMBase *)fe;
-   for (int32_t i = 0; i < CLASSHASHTABLE_SIZE; i++)
+   for (uint32_t i = 0; i < getNumBuckets(); i++)
       {
       for (TR_PersistentClassInfo *pci = _classes[i].getFirst(); pci; pci = pci->getNext())
          {
@@ -668,7 +764,7 @@ TR_PersistentCHTable::dumpMethodCounts(TR_FrontEnd *fe, TR_Memory &trMemory)
 void
 TR_PersistentCHTable::resetVisitedClasses() // highly time consuming
    {
-   for (int32_t i = 0; i <= CLASSHASHTABLE_SIZE; ++i)
+   for (uint32_t i = 0; i < getNumBuckets(); ++i)
       {
       TR_PersistentClassInfo * cl = _classes[i].getFirst();
       while (cl)
@@ -709,7 +805,7 @@ TR_PersistentCHTable::classGotLoaded(
    TR_PersistentClassInfo *clazz = new (PERSISTENT_NEW) TR_PersistentClassInfo(classId);
    if (clazz)
       {
-      _classes[TR_RuntimeAssumptionTable::hashCode((uintptr_t) classId) % CLASSHASHTABLE_SIZE].add(clazz);
+      addClassInfo(clazz);
       }
    return clazz;
    }
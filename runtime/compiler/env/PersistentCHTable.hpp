@@ -25,12 +25,19 @@
 
 #include <stdint.h>
 #include "compile/CompilationTypes.hpp"
+#include "env/RuntimeAssumptionTable.hpp"
 #include "env/TRMemory.hpp"
 #include "il/DataTypes.hpp"
 #include "infra/Link.hpp"
 
 #define CLASSHASHTABLE_SIZE  (4001) // close to 8000 classes will be loaded in WebSphere
 
+// The persistent CH table starts with 4096 buckets and doubles whenever the
+// average chain holds more than CHTABLE_MAX_LOAD_FACTOR classes
+#define CHTABLE_INITIAL_BUCKETS_LOG2  (12)
+#define CHTABLE_MAX_BUCKETS_LOG2      (24)
+#define CHTABLE_MAX_LOAD_FACTOR       (2)
+
 class TR_FrontEnd;
 class TR_OpaqueClassBlock;
 class TR_OpaqueMethodBlock;
@@ -84,17 +91,32 @@ class TR_PersistentCHTable
    virtual void removeClass(TR_FrontEnd *, TR_OpaqueClassBlock *classId, TR_PersistentClassInfo *info, bool removeInfo);
    virtual void resetVisitedClasses(); // highly time consuming
 
-#ifdef DEBUG
-   void dumpStats(TR_FrontEnd *);
-#endif
+   void dumpStats(TR_FrontEnd *);         // Print the number of classes, buckets and chain lengths
 
    protected:
    void removeAssumptionFromRAT(OMR::RuntimeAssumption *assumption);
    TR_LinkHead<TR_PersistentClassInfo> *getClasses() const { return _classes; }
+   uint32_t getNumBuckets() const { return (uint32_t)1 << _bucketsLog2; }
+
+   // Fibonacci hashing: the top bits of the 32 bit product are the best mixed
+   uint32_t bucketIndex(TR_OpaqueClassBlock *classId) const
+      {
+      return ((uint32_t)TR_RuntimeAssumptionTable::hashCode((uintptr_t)classId)) >> (32 - _bucketsLog2);
+      }
+   TR_LinkHead<TR_PersistentClassInfo> &getBucket(TR_OpaqueClassBlock *classId) const { return _classes[bucketIndex(classId)]; }
+
+   // The class table lock must be held to add or remove class infos
+   void addClassInfo(TR_PersistentClassInfo *clazz);
+   void removeClassInfo(TR_PersistentClassInfo *clazz);
 
    private:
-   uint8_t _buffer[sizeof(TR_LinkHead<TR_PersistentClassInfo>) * (CLASSHASHTABLE_SIZE + 1)];
+   void growBuckets();
+
+   uint8_t _buffer[sizeof(TR_LinkHead<TR_PersistentClassInfo>) << CHTABLE_INITIAL_BUCKETS_LOG2];
    TR_LinkHead<TR_PersistentClassInfo> *_classes;
+   uint32_t _bucketsLog2;
+   uint32_t _numClasses;
+   uint32_t _numResizes;
    TR_PersistentMemory *_trPersistentMemory;
    };
 
@@ -39,7 +39,7 @@ bool initializeJIT(J9JavaVM *vm)
          TR::CompilerEnv(
             vm,
             rawAllocator,
-            (TR::PersistentAllocatorKit( 1 << 20, *vm))
+            (TR::PersistentAllocatorKit( 1 << 20, *vm, true))
             );
       }
    catch (const std::bad_alloc& ba)
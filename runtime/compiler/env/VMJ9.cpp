@@ -5300,7 +5300,20 @@ TR_J9VMBase::getDesignatedCodeCache(TR::Compilation *comp) // MCT
    bool hadClassUnloadMonitor;
    bool hadVMAccess = releaseClassUnloadMonitorAndAcquireVMaccessIfNeeded(comp, &hadClassUnloadMonitor);
 
-   TR::CodeCache * result = TR::CodeCacheManager::instance()->reserveCodeCache(false, 0, compThreadID, &numReserved);
+   TR::CodeCache * result = NULL;
+   // Keep bodies of hot methods packed together in a dedicated code cache
+   // to reduce iTLB and i-cache misses
+   if (comp && TR::Options::_hotCodeCacheMinOptLevel > 0 &&
+       comp->getMethodHotness() >= TR::Options::_hotCodeCacheMinOptLevel &&
+       !comp->compileRelocatableCode() &&
+       !comp->isOutOfProcessCompilation())
+      result = TR::CodeCacheManager::instance()->reserveHotCodeCache(compThreadID);
+   if (!result)
+      result = TR::CodeCacheManager::instance()->reserveCodeCache(false, 0, compThreadID, &numReserved);
+   // The idle hot code cache counts as reserved, so ordinary compilations must be able to
+   // use it; otherwise they would be retried forever once all other code caches are full
+   if (!result && TR::Options::_hotCodeCacheMinOptLevel > 0)
+      result = TR::CodeCacheManager::instance()->reserveHotCodeCache(compThreadID, false);
 
    acquireClassUnloadMonitorAndReleaseVMAccessIfNeeded(comp, hadVMAccess, hadClassUnloadMonitor);
    if (!result)
@@ -5394,7 +5407,7 @@ TR_J9VMBase::reserveTrampolineIfNecessary(TR::Compilation * comp, TR::SymbolRefe
          if (retValue != OMR::CodeCacheErrorCode::ERRORCODE_SUCCESS)
             {
             // We couldn't allocate trampoline in this code cache
-            curCache->unreserve(); // delete the old reservation
+            curCache->releaseReservation(); // delete the old reservation
             if (retValue == OMR::CodeCacheErrorCode::ERRORCODE_INSUFFICIENTSPACE && !inBinaryEncoding) // code cache full, allocate a new one
                {
                // Allocate a new code cache and try again
@@ -5976,6 +5989,10 @@ TR_J9VMBase::canAllocateInlineClass(TR_OpaqueClassBlock *clazzOffset)
    // Can not inline the allocation if the class is an interface or abstract
    if (clazz->romClass->modifiers & (J9AccAbstract | J9AccInterface))
       return false;
+
+   // Can not inline the allocation if the GC allocates instances of the class in tenure space
+   if (clazz->classFlags & J9ClassPretenured)
+      return false;
    return true;
    }
 
@@ -6843,7 +6860,7 @@ TR_J9VM::getResolvedTrampoline(TR::Compilation *comp, TR::CodeCache* curCache, J
    int32_t retValue = curCache->reserveResolvedTrampoline((TR_OpaqueMethodBlock *)method, inBinaryEncoding);
    if (retValue != OMR::CodeCacheErrorCode::ERRORCODE_SUCCESS)
       {
-      curCache->unreserve();  // delete the old reservation
+      curCache->releaseReservation();  // delete the old reservation
       if (retValue == OMR::CodeCacheErrorCode::ERRORCODE_INSUFFICIENTSPACE && !inBinaryEncoding) // code cache full, allocate a new one
          {
          if (!isAOT_DEPRECATED_DO_NOT_USE())
@@ -138,6 +138,7 @@ typedef struct TR_JitPrivateConfig
    TR::FILE      *rtLogFile;
    char          *rtLogFileName;
    char          *itraceFileNamePrefix;
+   char          *profileSnapshotFileName;
    TR_IProfiler  *iProfiler;
    TR_HWProfiler *hwProfiler;
    TR_JProfilerThread  *jProfiler;
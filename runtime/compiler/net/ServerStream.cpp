@@ -21,16 +21,42 @@
  *******************************************************************************/
 
 #include "ServerStream.hpp"
+#include "env/CompilerEnv.hpp"
+#include "j9.h"
 
 namespace JITServer
 {
 int ServerStream::_numConnectionsOpened = 0;
 int ServerStream::_numConnectionsClosed = 0;
+uint32_t ServerStream::_numRoundTrips[] = {};
+uint64_t ServerStream::_roundTripTimeUs[] = {};
+uint32_t ServerStream::_roundTripHistogram[][ServerStream::RTT_HISTOGRAM_BUCKETS] = {};
 
 ServerStream::ServerStream(int connfd, BIO *ssl)
-   : CommunicationStream()
+   : CommunicationStream(),
+   _writeTimeUs(0)
    {
    initStream(connfd, ssl);
    _numConnectionsOpened++;
    }
+
+uint64_t
+ServerStream::currentTimeUs()
+   {
+   PORT_ACCESS_FROM_PORT(TR::Compiler->portLib);
+   return j9time_usec_clock();
+   }
+
+void
+ServerStream::recordRoundTrip(MessageType type)
+   {
+   // Statistics are updated without synchronization; occasional lost updates are acceptable
+   uint64_t roundTripUs = currentTimeUs() - _writeTimeUs;
+   int bucket = 0;
+   while (bucket < RTT_HISTOGRAM_BUCKETS - 1 && roundTripUs >= (2u << bucket))
+      bucket++;
+   _numRoundTrips[type]++;
+   _roundTripTimeUs[type] += roundTripUs;
+   _roundTripHistogram[type][bucket]++;
+   }
 }
@@ -86,6 +86,7 @@ public:
       {
       _sMsg.setType(type);
       setArgsRaw<Args...>(_sMsg, args...);
+      _writeTimeUs = currentTimeUs();
       writeMessage(_sMsg);
       }
 
@@ -122,6 +123,7 @@ public:
                throw StreamMessageTypeMismatch(_sMsg.type(), _cMsg.type());
             }
          }
+      recordRoundTrip(_sMsg.type());
       return getArgsRaw<T...>(_cMsg);
       }
 
@@ -231,10 +233,25 @@ public:
    static int getNumConnectionsOpened() { return _numConnectionsOpened; }
    static int getNumConnectionsClosed() { return _numConnectionsClosed; }
 
+   // Round trip times of the queries sent to clients, measured from the write of
+   // a query to the read of its response. Bucket i of the histogram counts the
+   // round trips shorter than 2^(i+1) usec; the last bucket counts all the others.
+   static const int RTT_HISTOGRAM_BUCKETS = 16;
+   static uint32_t getNumRoundTrips(MessageType type) { return _numRoundTrips[type]; }
+   static uint64_t getRoundTripTimeUs(MessageType type) { return _roundTripTimeUs[type]; }
+   static uint32_t getRoundTripHistogram(MessageType type, int bucket) { return _roundTripHistogram[type][bucket]; }
+
 private:
+   static uint64_t currentTimeUs();
+   void recordRoundTrip(MessageType type);
+
    static int _numConnectionsOpened;
    static int _numConnectionsClosed;
+   static uint32_t _numRoundTrips[MessageType_ARRAYSIZE];
+   static uint64_t _roundTripTimeUs[MessageType_ARRAYSIZE];
+   static uint32_t _roundTripHistogram[MessageType_ARRAYSIZE][RTT_HISTOGRAM_BUCKETS];
    uint64_t _clientId;  // UID of client connected to this communication stream
+   uint64_t _writeTimeUs; // time when the last message was sent to the client
    };
 
 
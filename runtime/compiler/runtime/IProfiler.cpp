@@ -3405,6 +3405,44 @@ TR_IProfiler::countEntries()
    return count;
    }
 
+TR_IPBytecodeHashTableEntry *
+TR_IProfiler::searchForSnapshotSample(uintptr_t pc)
+   {
+   return searchForSample(pc, bcHash(pc));
+   }
+
+// Seed the hash table with an entry read from the profile snapshot.
+// Data collected during this run is never overwritten.
+bool
+TR_IProfiler::restoreSnapshotSample(uintptr_t pc, TR_IPBCDataStorageHeader *storage)
+   {
+   int32_t bucket = bcHash(pc);
+   if (searchForSample(pc, bucket))
+      return false;
+
+   // The bytecode must still be of the kind the entry was collected for
+   U_8 byteCode = *(U_8*) pc;
+   if (storage->ID == TR_IPBCD_FOUR_BYTES)
+      {
+      if (!isCompact(byteCode))
+         return false;
+      }
+   else if (storage->ID == TR_IPBCD_EIGHT_WORDS)
+      {
+      if (!isSwitch(byteCode))
+         return false;
+      }
+   else
+      {
+      return false;
+      }
+
+   TR_IPBytecodeHashTableEntry *entry = findOrCreateEntry(bucket, pc, true);
+   if (!entry)
+      return false;
+   entry->loadFromPersistentCopy(storage, NULL);
+   return true;
+   }
 
 // helper functions for replay
 //
@@ -559,6 +559,9 @@ public:
    TR_IPMethodHashTableEntry *findOrCreateMethodEntry(J9Method *, J9Method *, bool addIt, uint32_t pcIndex =  ~0);
    uint32_t releaseAllEntries();
    uint32_t countEntries();
+   // used to save and restore the profile snapshot (control/JitProfileSnapshot.cpp)
+   TR_IPBytecodeHashTableEntry *searchForSnapshotSample(uintptr_t pc);
+   bool restoreSnapshotSample(uintptr_t pc, TR_IPBCDataStorageHeader *storage);
    void advanceEpochForHistoryBuffer() { _readSampleRequestsHistory->advanceEpoch(); }
    uint32_t getReadSampleFailureRate() const { return _readSampleRequestsHistory->getReadSampleFailureRate(); }
    uint32_t getTotalReadSampleRequests() const { return _readSampleRequestsHistory->getTotalReadSampleRequests(); }
@@ -91,6 +91,15 @@ J9::CodeCache::allocate(TR::CodeCacheManager *cacheManager, size_t segmentSize,
    }
 
 
+void
+J9::CodeCache::releaseReservation()
+   {
+   if (_manager->releaseHotCodeCache(self()))
+      return;
+   self()->OMR::CodeCache::unreserve();
+   }
+
+
 bool
 J9::CodeCache::initialize(TR::CodeCacheManager *manager,
                           TR::CodeCacheMemorySegment *codeCacheSegment,
@@ -71,6 +71,13 @@ public:
 
    static TR::CodeCache *     allocate(TR::CodeCacheManager *cacheManager, size_t segmentSize, int32_t reservingCompThreadID);
 
+   /**
+    * @brief Cancel the reservation a compilation holds on this code cache. The
+    *        reservation of the hot code cache is handed back to the code cache
+    *        manager instead. unreserve() always cancels the reservation.
+    */
+   void                       releaseReservation();
+
    // Code Cache Reclamation
    void                       addFreeBlock(OMR::FaintCacheBlock *block);
 
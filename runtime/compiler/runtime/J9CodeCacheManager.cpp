@@ -697,6 +697,7 @@ J9::CodeCacheManager::printMccStats()
    {
    self()->printRemainingSpaceInCodeCaches();
    self()->printOccupancyStats();
+   self()->printHotCodeCacheStats();
    }
 
 
@@ -722,3 +723,103 @@ J9::CodeCacheManager::printOccupancyStats()
       codeCache->printOccupancyStats();
       }
    }
+
+
+TR::CodeCache *
+J9::CodeCacheManager::reserveHotCodeCache(int32_t compThreadID, bool allowCreation)
+   {
+   TR::CodeCacheConfig &config = self()->codeCacheConfig();
+
+      {
+      CacheListCriticalSection reserveHotCache(self());
+      if (_hotCodeCacheInUse && _hotCodeCache && _hotCodeCache->getReservingCompThreadID() != _hotCodeCacheUserID)
+         {
+         // The compilation cancelled its reservation with OMR::CodeCache::unreserve() rather
+         // than releaseReservation(), so the cache may now be used by anyone. Retire it.
+         _hotCodeCache = NULL;
+         _hotCodeCacheInUse = false;
+         }
+      if (_hotCodeCacheInUse)
+         {
+         _numHotCodeCacheReservationFailures++;
+         return NULL;
+         }
+      if (_hotCodeCache)
+         {
+         // Transfer the reservation from the code cache manager to the compilation thread
+         _hotCodeCache->OMR::CodeCache::unreserve();
+         _hotCodeCache->reserve(compThreadID);
+         _hotCodeCacheInUse = true;
+         _hotCodeCacheUserID = compThreadID;
+         _numHotCodeCacheReservations++;
+         return _hotCodeCache;
+         }
+      if (!allowCreation || !self()->canAddNewCodeCache())
+         return NULL;
+      // Prevent other threads from creating a hot code cache concurrently
+      _hotCodeCacheInUse = true;
+      }
+
+   // Must not hold any monitor when creating a code cache; see addCodeCache
+   TR::CodeCache *codeCache = self()->allocateCodeCacheFromNewSegment(config.codeCacheKB() << 10, compThreadID);
+
+   CacheListCriticalSection reserveHotCache(self());
+   if (!codeCache)
+      {
+      _hotCodeCacheInUse = false;
+      return NULL;
+      }
+   if (!codeCache->isReserved())
+      codeCache->reserve(compThreadID);
+   _hotCodeCache = codeCache;
+   _hotCodeCacheUserID = compThreadID;
+   _numHotCodeCaches++;
+   _numHotCodeCacheReservations++;
+   if (config.verboseCodeCache())
+      {
+      TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "Designated code cache %p [%p-%p] for hot method bodies",
+         codeCache, codeCache->getCodeBase(), codeCache->getCodeTop());
+      }
+   return codeCache;
+   }
+
+
+bool
+J9::CodeCacheManager::releaseHotCodeCache(TR::CodeCache *codeCache)
+   {
+   TR::CodeCacheConfig &config = self()->codeCacheConfig();
+   CacheListCriticalSection releaseHotCache(self());
+   if (codeCache != _hotCodeCache || !_hotCodeCacheInUse)
+      return false;
+
+   _hotCodeCacheInUse = false;
+   if (codeCache->getFreeContiguousSpace() < config.lowCodeCacheThreshold())
+      {
+      // Retire the hot code cache; a new one will be created on demand
+      _hotCodeCache = NULL;
+      if (config.verboseCodeCache())
+         {
+         TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "Hot code cache %p is full; returning it to the pool of code caches", codeCache);
+         }
+      return false;
+      }
+   codeCache->OMR::CodeCache::unreserve();
+   codeCache->reserve(HOT_CODE_CACHE_OWNER_ID);
+   return true;
+   }
+
+
+void
+J9::CodeCacheManager::printHotCodeCacheStats()
+   {
+   CacheListCriticalSection scanCacheList(self());
+   if (_numHotCodeCaches == 0)
+      return;
+   TR_VerboseLog::vlogAcquire();
+   TR_VerboseLog::writeLine(TR_Vlog_CODECACHE, "Hot code caches created=%u reservations=%u reservationsDeniedWhileInUse=%u",
+      _numHotCodeCaches, _numHotCodeCacheReservations, _numHotCodeCacheReservationFailures);
+   if (_hotCodeCache)
+      TR_VerboseLog::writeLine(TR_Vlog_CODECACHE, "Current hot code cache %p has %llu bytes empty",
+         _hotCodeCache, (unsigned long long)_hotCodeCache->getFreeContiguousSpace());
+   TR_VerboseLog::vlogRelease();
+   }
@@ -53,7 +53,13 @@ class OMR_EXTENSIBLE CodeCacheManager : public OMR::CodeCacheManagerConnector
 public:
    CodeCacheManager(TR_FrontEnd *fe, TR::RawAllocator rawAllocator) :
       OMR::CodeCacheManagerConnector(rawAllocator),
-      _fe(fe)
+      _fe(fe),
+      _hotCodeCache(NULL),
+      _hotCodeCacheInUse(false),
+      _hotCodeCacheUserID(HOT_CODE_CACHE_OWNER_ID),
+      _numHotCodeCaches(0),
+      _numHotCodeCacheReservations(0),
+      _numHotCodeCacheReservationFailures(0)
       {
       _codeCacheManager = reinterpret_cast<TR::CodeCacheManager *>(this);
       }
@@ -151,8 +157,51 @@ public:
     */
    void printOccupancyStats();
 
+   /**
+    * @brief Reserve the code cache dedicated to bodies of hot methods.
+    *        While no compilation is using it, the hot code cache stays reserved
+    *        on behalf of the code cache manager, so ordinary compilations never
+    *        allocate into it and hot bodies are packed together. A new hot code
+    *        cache is created when there is none or the current one is full.
+    *
+    *        Ordinary compilations also use the hot code cache when no other
+    *        code cache can be reserved, so that it never keeps them from
+    *        reaching the code cache full handling.
+    *
+    * @param[in] compThreadID : the ID of the compilation thread making the request
+    * @param[in] allowCreation : whether a hot code cache may be created if there is none
+    *
+    * @return the reserved hot code cache; NULL if it is being used by another
+    *         compilation or cannot be created
+    */
+   TR::CodeCache *reserveHotCodeCache(int32_t compThreadID, bool allowCreation = true);
+
+   /**
+    * @brief Take back the reservation of the hot code cache when a compilation
+    *        is done with it. A hot code cache that is almost full is retired
+    *        and becomes an ordinary code cache.
+    *
+    * @param[in] codeCache : the code cache being unreserved
+    *
+    * @return true if the code cache manager kept the reservation; false otherwise
+    */
+   bool releaseHotCodeCache(TR::CodeCache *codeCache);
+
+   /**
+    * @brief Print hot code cache usage statistics
+    */
+   void printHotCodeCacheStats();
+
+   static const int32_t HOT_CODE_CACHE_OWNER_ID = -2; // reserving ID used while no compilation uses the hot code cache
+
 private :
    TR_FrontEnd *_fe;
+   TR::CodeCache *_hotCodeCache;
+   bool _hotCodeCacheInUse; // also set while the hot code cache is being created
+   int32_t _hotCodeCacheUserID; // compilation thread given the hot code cache while _hotCodeCacheInUse
+   uint32_t _numHotCodeCaches;
+   uint32_t _numHotCodeCacheReservations;
+   uint32_t _numHotCodeCacheReservationFailures;
    static TR::CodeCacheManager *_codeCacheManager;
    static J9JITConfig *_jitConfig;
    static J9JavaVM *_javaVM;
@@ -43,7 +43,8 @@ JITServerIProfiler::allocate(J9JITConfig *jitConfig)
 
 JITServerIProfiler::JITServerIProfiler(J9JITConfig *jitConfig)
    : TR_IProfiler(jitConfig), _statsIProfilerInfoFromCache(0), _statsIProfilerInfoMsgToClient(0),
-   _statsIProfilerInfoReqNotCacheable(0), _statsIProfilerInfoIsEmpty(0), _statsIProfilerInfoCachingFailures(0)
+   _statsIProfilerInfoReqNotCacheable(0), _statsIProfilerInfoIsEmpty(0), _statsIProfilerInfoCachingFailures(0),
+   _statsIProfilerInfoFromPrefetch(0)
    {
    _useCaching = feGetEnv("TR_DisableIPCaching") ? false: true;
    }
@@ -234,16 +235,31 @@ JITServerIProfiler::profilingSample(TR_OpaqueMethodBlock *method, uint32_t byteC
          }
       }
    
-   // Now ask the client
+   // Now ask the client, unless it already sent the info for the entire method
+   // together with the compilation request
    //
-   auto stream = TR::CompilationInfo::getStream();
-   stream->write(JITServer::MessageType::IProfiler_profilingSample, method, byteCodeIndex, (uintptr_t)(_useCaching ? 0 : 1));
-   auto recv = stream->read<std::string, bool, bool, bool>();
-   const std::string ipdata = std::get<0>(recv);
-   bool wholeMethod = std::get<1>(recv); // indicates whether the client sent info for entire method
-   bool usePersistentCache = std::get<2>(recv); // indicates whether info can be saved in persistent memory, or only in heap memory
-   bool isCompiled = std::get<3>(recv);
-   _statsIProfilerInfoMsgToClient++;
+   std::string ipdata;
+   bool wholeMethod = false; // indicates whether the client sent info for entire method
+   bool usePersistentCache = false; // indicates whether info can be saved in persistent memory, or only in heap memory
+   bool isCompiled = false;
+   if (_useCaching && compInfoPT->getPrefetchedIProfilerInfo(method, ipdata, isCompiled))
+      {
+      // The prefetched data belongs to the method being compiled, which is always cached persistently
+      wholeMethod = true;
+      usePersistentCache = true;
+      _statsIProfilerInfoFromPrefetch++;
+      }
+   else
+      {
+      auto stream = TR::CompilationInfo::getStream();
+      stream->write(JITServer::MessageType::IProfiler_profilingSample, method, byteCodeIndex, (uintptr_t)(_useCaching ? 0 : 1));
+      auto recv = stream->read<std::string, bool, bool, bool>();
+      ipdata = std::get<0>(recv);
+      wholeMethod = std::get<1>(recv);
+      usePersistentCache = std::get<2>(recv);
+      isCompiled = std::get<3>(recv);
+      _statsIProfilerInfoMsgToClient++;
+      }
 
    bool doCache = _useCaching && wholeMethod;
    if (!doCache)
@@ -398,6 +414,7 @@ JITServerIProfiler::printStats()
       j9tty_printf(PORTLIB, "IProfilerInfoNotCacheable:   %6u\n", _statsIProfilerInfoReqNotCacheable);
       j9tty_printf(PORTLIB, "IProfilerInfoCachingFailure: %6u\n", _statsIProfilerInfoCachingFailures);
       j9tty_printf(PORTLIB, "IProfilerInfoFromCache:   %6u\n", _statsIProfilerInfoFromCache);
+      j9tty_printf(PORTLIB, "IProfilerInfoFromPrefetch:   %6u\n", _statsIProfilerInfoFromPrefetch);
       }
    }
 
@@ -730,16 +747,15 @@ JITClientIProfiler::serializeIProfilerMethodEntries(uintptr_t *pcEntries, uint32
    }
 
 /**
- * Code to be executed on the JITClient to send IProfiler info to JITServer
+ * Code to be executed on the JITClient to serialize all IProfiler info of a method
  *
  * @param method J9Method in question
  * @param comp TR::Compilation pointer
- * @param client Connection to JITServer
- * @param usePersistentCache Whetehr to use persistent cache
- * @return Whether the operation was successful
+ * @param buffer (output) Serialized entries; empty if the method has no IProfiler info
+ * @return Whether the operation was aborted
  */
 bool
-JITClientIProfiler::serializeAndSendIProfileInfoForMethod(TR_OpaqueMethodBlock *method, TR::Compilation *comp, JITServer::ClientStream *client, bool usePersistentCache, bool isCompiled)
+JITClientIProfiler::serializeIProfileInfoForMethod(TR_OpaqueMethodBlock *method, TR::Compilation *comp, std::string &buffer)
    {
    TR::StackMemoryRegion stackMemoryRegion(*comp->trMemory());
    uint32_t numEntries = 0;
@@ -749,6 +765,7 @@ JITClientIProfiler::serializeAndSendIProfileInfoForMethod(TR_OpaqueMethodBlock *
 
    uintptr_t * pcEntries = NULL;
    bool abort = false;
+   buffer.clear();
    try {
       TR_ResolvedJ9Method resolvedj9method = TR_ResolvedJ9Method(method, comp->fej9(), comp->trMemory());
       TR_J9ByteCodeIterator bci(NULL, &resolvedj9method, static_cast<TR_J9VMBase *> (comp->fej9()), comp);
@@ -764,15 +781,9 @@ JITClientIProfiler::serializeAndSendIProfileInfoForMethod(TR_OpaqueMethodBlock *
       if (numEntries && !abort)
          {
          // Serialize the entries
-         std::string buffer(bytesFootprint, '\0');
+         buffer.resize(bytesFootprint);
          intptr_t writtenBytes = serializeIProfilerMethodEntries(pcEntries, numEntries, (uintptr_t)&buffer[0], methodStart);
          TR_ASSERT(writtenBytes == bytesFootprint, "BST doesn't match expected footprint");
-         // send the information to the server
-         client->write(JITServer::MessageType::IProfiler_profilingSample, buffer, true, usePersistentCache, isCompiled);
-         }
-      else if (!numEntries && !abort)// Empty IProfiler data for this method
-         {
-         client->write(JITServer::MessageType::IProfiler_profilingSample, std::string(), true, usePersistentCache, isCompiled);
          }
 
       // release any entry that has been locked by us
@@ -794,7 +805,27 @@ JITClientIProfiler::serializeAndSendIProfileInfoForMethod(TR_OpaqueMethodBlock *
          }
       throw;
       }
-      return abort;
+   return abort;
+   }
+
+/**
+ * Code to be executed on the JITClient to send IProfiler info to JITServer
+ *
+ * @param method J9Method in question
+ * @param comp TR::Compilation pointer
+ * @param client Connection to JITServer
+ * @param usePersistentCache Whetehr to use persistent cache
+ * @return Whether the operation was successful
+ */
+bool
+JITClientIProfiler::serializeAndSendIProfileInfoForMethod(TR_OpaqueMethodBlock *method, TR::Compilation *comp, JITServer::ClientStream *client, bool usePersistentCache, bool isCompiled)
+   {
+   std::string buffer;
+   bool abort = serializeIProfileInfoForMethod(method, comp, buffer);
+   // send the information to the server; an empty buffer means there is no IProfiler data for this method
+   if (!abort)
+      client->write(JITServer::MessageType::IProfiler_profilingSample, buffer, true, usePersistentCache, isCompiled);
+   return abort;
    }
 
 std::string
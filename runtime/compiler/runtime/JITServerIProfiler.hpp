@@ -119,6 +119,7 @@ private:
    uint32_t _statsIProfilerInfoReqNotCacheable; // info returned from client should not be cached
    uint32_t _statsIProfilerInfoIsEmpty; // client has no IP info for indicated PC
    uint32_t _statsIProfilerInfoCachingFailures;
+   uint32_t _statsIProfilerInfoFromPrefetch; // whole method info sent by the client with the compilation request
    };
 
 /**
@@ -143,6 +144,7 @@ public:
    // the base class. It may be better not to override any methods though
  
    bool serializeAndSendIProfileInfoForMethod(TR_OpaqueMethodBlock*method, TR::Compilation *comp, JITServer::ClientStream *client, bool usePersistentCache, bool isCompiled);
+   bool serializeIProfileInfoForMethod(TR_OpaqueMethodBlock *method, TR::Compilation *comp, std::string &buffer);
    std::string serializeIProfilerMethodEntry(TR_OpaqueMethodBlock *omb);
 
 private:
@@ -179,8 +179,7 @@ TR_PersistentCHTable::classGotUnloadedPost(
 
    cl = findClassInfo(classId);
    classDepth = TR::Compiler->cls.classDepthOf(classId) - 1;
-   uintptr_t hashPos = TR_RuntimeAssumptionTable::hashCode((uintptr_t)classId) % CLASSHASHTABLE_SIZE;
-   _classes[hashPos].remove(cl);
+   removeClassInfo(cl);
 
    if ((classDepth >= 0) &&
        (cl->isInitialized() || fej9->isInterfaceClass(classId)))
@@ -308,7 +307,6 @@ TR_PersistentCHTable::removeClass(
    TR_PersistentClassInfo * scl;
 
    int classDepth = TR::Compiler->cls.classDepthOf(classId) - 1;
-   uintptr_t hashPos = TR_RuntimeAssumptionTable::hashCode((uintptr_t)classId) % CLASSHASHTABLE_SIZE;
 
    if (classDepth >= 0)
       {
@@ -335,7 +333,7 @@ TR_PersistentCHTable::removeClass(
 
    if (removeInfo)
       {
-      _classes[hashPos].remove(info);
+      removeClassInfo(info);
       jitPersistentFree(info);
       }
    }
@@ -432,21 +430,19 @@ TR_PersistentCHTable::classGotRedefined(
    //
 
    TR_PersistentClassInfo *newClass = findClassInfo(newClassId);
-   uintptr_t oldIndex = TR_RuntimeAssumptionTable::hashCode((uintptr_t)oldClassId) % CLASSHASHTABLE_SIZE;
-   uintptr_t newIndex = TR_RuntimeAssumptionTable::hashCode((uintptr_t)newClassId) % CLASSHASHTABLE_SIZE;
-   _classes[oldIndex].remove(oldClass);
+   removeClassInfo(oldClass);
    oldClass->setClassId(newClassId);
-   _classes[newIndex].add(oldClass);
 
    // The new class should have had a class load event that would create a CHTable entry.
    // We'll use it to represent the moribund old class.
    //
    if (newClass)
       {
-      _classes[newIndex].remove(newClass);
+      removeClassInfo(newClass);
       newClass->setClassId(oldClassId);
-      _classes[oldIndex].add(newClass);
+      addClassInfo(newClass);
       }
+   addClassInfo(oldClass);
    }
 
 
@@ -424,7 +424,7 @@ J9::X86::CodeGenerator::reserveNTrampolines(int32_t numTrampolines)
       if (status != OMR::CodeCacheErrorCode::ERRORCODE_SUCCESS)
          {
          // Current code cache is no good. Must unreserve
-         curCache->unreserve();
+         curCache->releaseReservation();
          newCache = 0;
          if (self()->getCodeGeneratorPhase() != TR::CodeGenPhase::BinaryEncodingPhase)
             {
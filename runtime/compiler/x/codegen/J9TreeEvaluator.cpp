@@ -1021,9 +1021,17 @@ TR::Register* J9::X86::TreeEvaluator::performHeapLoadWithReadBarrier(TR::Node* n
          TR_OutlinedInstructionsGenerator og(rdbarLabel, node, cg);
          generateRegMemInstruction(CMPRegMem(use64BitClasses), node, object, generateX86MemoryReference(cg->getVMThreadRegister(), cg->comp()->fej9()->thisThreadGetEvacuateTopAddressOffset(), cg), cg);
          generateLabelInstruction(JA4, node, endLabel, cg);
-         generateMemRegInstruction(SMemReg(), node, generateX86MemoryReference(cg->getVMThreadRegister(), offsetof(J9VMThread, floatTemp1), cg), address, cg);
-         generateHelperCallInstruction(node, TR_softwareReadBarrier, NULL, cg);
-         generateRegMemInstruction(LRegMem(use64BitClasses), node, object, generateX86MemoryReference(address, 0, cg), cg);
+         if (cg->isElidedReadBarrier(node))
+            {
+            // the barrier was kept only to verify that it could be elided, which it could not
+            generateInstruction(INT3, node, cg);
+            }
+         else
+            {
+            generateMemRegInstruction(SMemReg(), node, generateX86MemoryReference(cg->getVMThreadRegister(), offsetof(J9VMThread, floatTemp1), cg), address, cg);
+            generateHelperCallInstruction(node, TR_softwareReadBarrier, NULL, cg);
+            generateRegMemInstruction(LRegMem(use64BitClasses), node, object, generateX86MemoryReference(address, 0, cg), cg);
+            }
          generateLabelInstruction(JMP4, node, endLabel, cg);
          }
          generateLabelInstruction(LABEL, node, endLabel, deps, cg);
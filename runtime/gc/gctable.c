@@ -257,5 +257,7 @@ J9MemoryManagerFunctions MemoryManagerFunctions = {
 	j9gc_notifyGCOfClassReplacement,
 	j9gc_get_jit_string_dedup_policy,
 	j9gc_stringHashFn,
-	j9gc_stringHashEqualFn
+	j9gc_stringHashEqualFn,
+	j9mm_iterate_all_objects_parallel,
+	j9mm_get_parallel_iteration_thread_count
 };
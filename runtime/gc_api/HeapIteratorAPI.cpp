@@ -28,6 +28,9 @@
 #include "ModronAssertions.h"
 
 #include "ArrayletLeafIterator.hpp"
+#include "Dispatcher.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapIteratorAPIRootIterator.hpp"
 #include "HeapIteratorAPIBufferedIterator.hpp"
@@ -42,6 +45,7 @@
 #include "MixedObjectIterator.hpp"
 #include "ObjectAccessBarrier.hpp"
 #include "OwnableSynchronizerObjectList.hpp"
+#include "ParallelTask.hpp"
 #include "PointerArrayIterator.hpp"
 #include "SlotObject.hpp"
 #include "VMInterface.hpp"
@@ -84,8 +88,68 @@ iterateRegionObjects(
 	jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData),
 	void *userData);
 
+/**
+ * Walks the objects of the heap on the GC worker threads. The regions of the heap are
+ * the units of work: every worker enumerates the same regions and iterates the objects
+ * of the regions it claims.
+ */
+class MM_ParallelHeapIteratorTask : public MM_ParallelTask
+{
+	/* Data Members */
+private:
+	UDATA _flags;
+	jvmtiIterationControl (*_func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, UDATA workerID, void *userData);
+	void *_userData;
+	volatile bool _aborted; /**< set when a callback returns JVMTI_ITERATION_ABORT */
+protected:
+public:
+
+	/* Member Functions */
+private:
+protected:
+public:
+	virtual UDATA getVMStateID(void) { return J9VMSTATE_GC; }
+	virtual void run(MM_EnvironmentBase *env);
+
+	jvmtiIterationControl
+	iterateObject(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, UDATA workerID)
+	{
+		if (!_aborted) {
+			if (JVMTI_ITERATION_ABORT == _func(vm, object, workerID, _userData)) {
+				_aborted = true;
+			}
+		}
+		return _aborted ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
+	}
+
+	bool isAborted() { return _aborted; }
+	UDATA getFlags() { return _flags; }
+
+	MM_ParallelHeapIteratorTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, UDATA workerID, void *userData), void *userData)
+		: MM_ParallelTask(env, dispatcher)
+		, _flags(flags)
+		, _func(func)
+		, _userData(userData)
+		, _aborted(false)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
 extern "C" {
 
+/* used by j9mm_iterate_all_objects_parallel */
+typedef struct J9MM_ParallelCallbackDataHolderPrivate {
+	MM_ParallelHeapIteratorTask *task;
+	MM_EnvironmentBase *env; /**< NULL when the walk is not dispatched to the GC worker threads */
+	UDATA workerID;
+} J9MM_ParallelCallbackDataHolderPrivate;
+
+static jvmtiIterationControl parallelIterateHeaps(J9JavaVM *vm, J9MM_IterateHeapDescriptor *heap, void *userData);
+static jvmtiIterationControl parallelIterateSpaces(J9JavaVM *vm, J9MM_IterateSpaceDescriptor *space, void *userData);
+static jvmtiIterationControl parallelIterateRegions(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, void *userData);
+static jvmtiIterationControl parallelIterateObjects(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *userData);
+
 /* used by j9mm_iterate_all_objects */
 static jvmtiIterationControl internalIterateHeaps(J9JavaVM *vm, J9MM_IterateHeapDescriptor *heap, void *userData);
 static jvmtiIterationControl internalIterateSpaces(J9JavaVM *vm, J9MM_IterateSpaceDescriptor *space, void *userData);
@@ -483,6 +547,98 @@ internalIterateRegions(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, void
 	return j9mm_iterate_region_objects(vm, data->portLibrary, region, data->flags, data->func, data->userData);
 }
 
+/**
+ * Answer the number of threads which may call back concurrently from
+ * j9mm_iterate_all_objects_parallel. Worker IDs are smaller than this count.
+ */
+UDATA
+j9mm_get_parallel_iteration_thread_count(J9JavaVM *vm)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm->omrVM);
+	return extensions->dispatcher->threadCountMaximum();
+}
+
+/**
+ * Walk all objects of the heap using the GC worker threads, call user provided function.
+ * The function is called concurrently from several threads, each passing its own worker ID.
+ * The walk runs on the calling thread alone, with worker ID 0, when the GC worker threads
+ * are not available.
+ * The caller must have exclusive VM access and the heap must be walkable.
+ * @param flags The flags describing the walk (0 or j9mm_iterator_flag_include_holes)
+ * @param func The function to call on each object descriptor.
+ * @param userData Pointer to storage for userData.
+ * @return JVMTI_ITERATION_ABORT if a call to func aborted the walk, JVMTI_ITERATION_CONTINUE otherwise
+ */
+jvmtiIterationControl
+j9mm_iterate_all_objects_parallel(J9VMThread *vmThread, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, UDATA workerID, void *userData), void *userData)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+	MM_ParallelHeapIteratorTask task(env, extensions->dispatcher, flags, func, userData);
+	bool dispatch = (1 < extensions->dispatcher->threadCountMaximum());
+
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	/* The worker threads are busy with the concurrent phase of a scavenge */
+	if (extensions->isConcurrentScavengerInProgress()) {
+		dispatch = false;
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+#if defined(J9VM_GC_REALTIME)
+	/* Metronome schedules its worker threads itself */
+	if (extensions->isMetronomeGC()) {
+		dispatch = false;
+	}
+#endif /* J9VM_GC_REALTIME */
+
+	if (dispatch) {
+		extensions->dispatcher->run(env, &task);
+	} else {
+		J9MM_ParallelCallbackDataHolderPrivate data;
+		data.task = &task;
+		data.env = NULL;
+		data.workerID = 0;
+		j9mm_iterate_heaps(vm, vm->portLibrary, flags, parallelIterateHeaps, &data);
+	}
+	return task.isAborted() ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
+}
+
+/* used by j9mm_iterate_all_objects_parallel */
+static jvmtiIterationControl
+parallelIterateHeaps(J9JavaVM *vm, J9MM_IterateHeapDescriptor *heap, void *userData)
+{
+	J9MM_ParallelCallbackDataHolderPrivate *data = (J9MM_ParallelCallbackDataHolderPrivate *)userData;
+	return j9mm_iterate_spaces(vm, vm->portLibrary, heap, data->task->getFlags(), parallelIterateSpaces, userData);
+}
+
+static jvmtiIterationControl
+parallelIterateSpaces(J9JavaVM *vm, J9MM_IterateSpaceDescriptor *space, void *userData)
+{
+	J9MM_ParallelCallbackDataHolderPrivate *data = (J9MM_ParallelCallbackDataHolderPrivate *)userData;
+	return j9mm_iterate_regions(vm, vm->portLibrary, space, data->task->getFlags(), parallelIterateRegions, userData);
+}
+
+static jvmtiIterationControl
+parallelIterateRegions(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, void *userData)
+{
+	J9MM_ParallelCallbackDataHolderPrivate *data = (J9MM_ParallelCallbackDataHolderPrivate *)userData;
+	jvmtiIterationControl rc = JVMTI_ITERATION_CONTINUE;
+
+	if (data->task->isAborted()) {
+		rc = JVMTI_ITERATION_ABORT;
+	} else if ((NULL == data->env) || J9MODRON_HANDLE_NEXT_WORK_UNIT(data->env)) {
+		rc = j9mm_iterate_region_objects(vm, vm->portLibrary, region, data->task->getFlags(), parallelIterateObjects, userData);
+	}
+	return rc;
+}
+
+static jvmtiIterationControl
+parallelIterateObjects(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *userData)
+{
+	J9MM_ParallelCallbackDataHolderPrivate *data = (J9MM_ParallelCallbackDataHolderPrivate *)userData;
+	return data->task->iterateObject(vm, object, data->workerID);
+}
+
 /**
  * Walk all ownable synchronizer object, call user provided function.
  * @param flags The flags describing the walk (unused currently)
@@ -526,6 +682,17 @@ j9mm_iterate_all_ownable_synchronizer_objects(J9VMThread *vmThread, J9PortLibrar
 
 } /* extern "C" */
 
+void
+MM_ParallelHeapIteratorTask::run(MM_EnvironmentBase *env)
+{
+	J9JavaVM *vm = (J9JavaVM *)env->getLanguageVM();
+	J9MM_ParallelCallbackDataHolderPrivate data;
+	data.task = this;
+	data.env = env;
+	data.workerID = env->getSlaveID();
+	j9mm_iterate_heaps(vm, vm->portLibrary, _flags, parallelIterateHeaps, &data);
+}
+
 /**
  * Initialize the specified descriptor with the specified values.
  * Invariant fields are initialized to the appropriate values for the JVM.
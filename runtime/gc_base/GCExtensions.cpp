@@ -32,6 +32,9 @@
 
 #include "EnvironmentBase.hpp"
 #include "Forge.hpp"
+#if defined(J9VM_GC_VLHGC)
+#include "FreeRegionZeroer.hpp"
+#endif /* J9VM_GC_VLHGC */
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
  #include  "IdleGCManager.hpp"
 #endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
@@ -39,6 +42,7 @@
 #include "MemorySubSpace.hpp"
 #include "ObjectModel.hpp"
 #include "ReferenceChainWalkerMarkMap.hpp"
+#include "StringDeduplicator.hpp"
 #include "SublistPool.hpp"
 #include "Wildcard.hpp"
 
@@ -179,6 +183,18 @@ MM_GCExtensions::tearDown(MM_EnvironmentBase *env)
 	}
 #endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 
+	if (NULL != stringDeduplicator) {
+		stringDeduplicator->kill(env);
+		stringDeduplicator = NULL;
+	}
+
+#if defined(J9VM_GC_VLHGC)
+	if (NULL != freeRegionZeroer) {
+		freeRegionZeroer->kill(env);
+		freeRegionZeroer = NULL;
+	}
+#endif /* J9VM_GC_VLHGC */
+
 	MM_GCExtensionsBase::tearDown(env);
 }
 
@@ -53,10 +53,17 @@
 
 class MM_ClassLoaderManager;
 class MM_EnvironmentBase;
+#if defined(J9VM_GC_VLHGC)
+class MM_FreeRegionZeroer;
+#endif /* J9VM_GC_VLHGC */
 class MM_HeapMap;
 class MM_MemorySubSpace;
 class MM_ObjectAccessBarrier;
 class MM_OwnableSynchronizerObjectList;
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+class MM_ScavengerPretenuring;
+#endif /* J9VM_GC_MODRON_SCAVENGER */
+class MM_StringDeduplicator;
 class MM_StringTable;
 class MM_UnfinalizedObjectList;
 class MM_Wildcard;
@@ -82,11 +89,16 @@ private:
 	MM_OwnableSynchronizerObjectList* ownableSynchronizerObjectLists; /**< The global linked list of ownable synchronizer object lists. */
 public:
 	MM_StringTable* stringTable; /**< top level String Table structure (internally organized as a set of hash sub-tables */
+	MM_StringDeduplicator* stringDeduplicator; /**< Shares the values of equal Strings copied by the scavenger or copy-forward, or NULL if deduplication is disabled */
+	bool stringDeduplication; /**< Deduplicate the values of Strings which survive stringDeduplicationAge collections */
+	UDATA stringDeduplicationAge; /**< Number of collections a String must survive to become a deduplication candidate */
 
 	void* gcchkExtensions;
 
 	void* tgcExtensions;
 	J9MemoryManagerVerboseInterface verboseFunctionTable;
+	bool verboseBinary; /**< Write new format verbose GC file logs as binary records drained by a background thread */
+	bool fvtest_verboseBinaryTextCopy; /**< Also write the stanza text of a binary verbose GC log to a text file, so that tests can compare it with the formatted log */
 
 #if defined(J9VM_GC_FINALIZATION)
 	IDATA finalizeCycleInterval;
@@ -100,6 +112,10 @@ public:
 	MM_MarkJavaStats markJavaStats;
 #if defined(J9VM_GC_MODRON_SCAVENGER)
 	MM_ScavengerJavaStats scavengerJavaStats;
+	MM_ScavengerPretenuring *scavengerPretenuring; /**< Chooses the classes allocated directly in tenure space, or NULL if pretenuring is disabled */
+	bool scavengerPretenure; /**< Allocate classes whose instances are repeatedly copied by the scavenger directly in tenure space */
+	UDATA scavengerPretenureThreshold; /**< Minimum bytes of a class in the survivor space for the class to be pretenured */
+	UDATA scavengerPretenureMinimumSize; /**< Minimum instance data size of an allocation made directly in tenure space */
 #endif /* J9VM_GC_MODRON_SCAVENGER */
 
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
@@ -182,11 +198,31 @@ public:
 
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
 	MM_IdleGCManager* idleGCManager; /**< Manager which registers for VM Runtime State notification & manages free heap on notification */
+	bool gcOnIdleGradual; /**< Release free heap pages in timed increments instead of collecting when the JVM becomes idle */
+	UDATA gcOnIdleReleaseStepSize; /**< Maximum bytes decommitted by each gradual idle release increment */
+	UDATA gcOnIdleReleaseInterval; /**< Milliseconds between gradual idle release increments */
 #endif
 
 	double maxRAMPercent; /**< Value of -XX:MaxRAMPercentage specified by the user */
 	double initialRAMPercent; /**< Value of -XX:InitialRAMPercentage specified by the user */
 
+#if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
+	volatile UDATA arrayletDoubleMapCount; /**< Number of arrays whose arraylet leaves were mapped into a contiguous range */
+	volatile UDATA arrayletDoubleMapFailedCount; /**< Number of arrays whose arraylet leaves could not be mapped into a contiguous range */
+	volatile UDATA arrayletDoubleMapBytes; /**< Bytes of address space mapped for contiguous views of arraylets */
+	volatile UDATA arrayletDoubleMapTime; /**< Microseconds spent mapping contiguous views of arraylets */
+#endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+
+#if defined(J9VM_GC_VLHGC)
+	MM_FreeRegionZeroer* freeRegionZeroer; /**< Zeroes free regions ahead of arraylet leaf allocation, or NULL if free region zeroing is disabled */
+	bool tarokEnableFreeRegionZeroing; /**< Zero free regions on a background thread so that arraylet leaves need not be zeroed by the allocating thread */
+	UDATA tarokZeroedFreeRegionTarget; /**< Number of zeroed free regions the background thread keeps in each allocation context */
+	bool tarokEnableNumaOwnerPlacement; /**< Copy-forward copies objects into regions of the context which owns them, rather than of the context from which they were reached */
+	UDATA tarokNumaPlacementInterval; /**< Number of copy-forward collections over which access across NUMA nodes is measured before the placement of each context is reconsidered */
+	UDATA tarokNumaPlacementMigrationPercent; /**< Percentage of the copied bytes of a context which must be reached from one other NUMA node for the context's objects to be placed on that node */
+	bool tarokRecordNumaTraffic; /**< Copy-forward counts the bytes of each context reached from each other context even without tarokEnableNumaOwnerPlacement, so that -Xtgc:numa can report them */
+#endif /* J9VM_GC_VLHGC */
+
 protected:
 private:
 protected:
@@ -281,12 +317,23 @@ public:
 		: MM_GCExtensionsBase()
 		, ownableSynchronizerObjectLists(NULL)
 		, stringTable(NULL)
+		, stringDeduplicator(NULL)
+		, stringDeduplication(false)
+		, stringDeduplicationAge(3)
 		, gcchkExtensions(NULL)
 		, tgcExtensions(NULL)
+		, verboseBinary(false)
+		, fvtest_verboseBinaryTextCopy(false)
 #if defined(J9VM_GC_FINALIZATION)
 		, finalizeCycleInterval(J9_FINALIZABLE_INTERVAL)  /* 1/2 second */
 		, finalizeCycleLimit(0)  /* 0 seconds (i.e. no time limit) */
 #endif /* J9VM_GC_FINALIZATION */
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+		, scavengerPretenuring(NULL)
+		, scavengerPretenure(false)
+		, scavengerPretenureThreshold(1024 * 1024) /* default is one MiB */
+		, scavengerPretenureMinimumSize(512)
+#endif /* J9VM_GC_MODRON_SCAVENGER */
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 		, dynamicClassUnloadingSet(false)
 		, dynamicClassUnloadingKickoffThresholdForced(false)
@@ -314,9 +361,27 @@ public:
 		, _HeapManagementMXBeanBackCompatibilityEnabled(false)
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
 		, idleGCManager(NULL)
+		, gcOnIdleGradual(false)
+		, gcOnIdleReleaseStepSize(16 * 1024 * 1024)
+		, gcOnIdleReleaseInterval(100)
 #endif
 		, maxRAMPercent(0.0) /* this would get overwritten by user specified value */
 		, initialRAMPercent(0.0) /* this would get overwritten by user specified value */
+#if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
+		, arrayletDoubleMapCount(0)
+		, arrayletDoubleMapFailedCount(0)
+		, arrayletDoubleMapBytes(0)
+		, arrayletDoubleMapTime(0)
+#endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+#if defined(J9VM_GC_VLHGC)
+		, freeRegionZeroer(NULL)
+		, tarokEnableFreeRegionZeroing(false)
+		, tarokZeroedFreeRegionTarget(4)
+		, tarokEnableNumaOwnerPlacement(false)
+		, tarokNumaPlacementInterval(8)
+		, tarokNumaPlacementMigrationPercent(75)
+		, tarokRecordNumaTraffic(false)
+#endif /* J9VM_GC_VLHGC */
 	{
 		_typeId = __FUNCTION__;
 	}
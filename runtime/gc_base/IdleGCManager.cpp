@@ -26,6 +26,7 @@
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
 #include "j9protos.h"
 #include "j9consts.h"
+#include "mmhook_internal.h"
 #include "vmhook_internal.h"
 
 #include "IdleGCManager.hpp"
@@ -33,6 +34,12 @@
 #include "GCExtensions.hpp"
 #include "OMRVMInterface.hpp"
 #include "Heap.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "HeapMemoryPoolIterator.hpp"
+#include "Math.hpp"
+#include "MemoryPool.hpp"
+#include "MemorySpace.hpp"
+#include "MemorySubSpace.hpp"
 
 MM_IdleGCManager *
 MM_IdleGCManager::newInstance(MM_EnvironmentBase* env)
@@ -81,10 +88,173 @@ MM_IdleGCManager::manageFreeHeap(J9VMThread* currentThread)
 	MM_GCExtensions* _extensions = MM_GCExtensions::getExtensions(env);
 
 	_javaVM->internalVMFunctions->internalAcquireVMAccess(currentThread);
-	_extensions->heap->systemGarbageCollect(env, J9MMCONSTANT_EXPLICIT_GC_IDLE_GC);
+	if (_extensions->gcOnIdleGradual && canReleaseGradually()) {
+		releaseFreeHeapGradually(env);
+	} else {
+		_extensions->heap->systemGarbageCollect(env, J9MMCONSTANT_EXPLICIT_GC_IDLE_GC);
+	}
 	_javaVM->internalVMFunctions->internalReleaseVMAccess(currentThread);
 }
 
+bool
+MM_IdleGCManager::canReleaseGradually()
+{
+	MM_GCExtensions* extensions = MM_GCExtensions::getExtensions(_javaVM);
+	bool result = true;
+
+	/* concurrent sweep and concurrent scavenge rebuild or allocate from the tenure free lists without exclusive VM access */
+#if defined(J9VM_GC_CONCURRENT_SWEEP)
+	if (extensions->concurrentSweep) {
+		result = false;
+	}
+#endif /* defined(J9VM_GC_CONCURRENT_SWEEP) */
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	if (extensions->isConcurrentScavengerEnabled()) {
+		result = false;
+	}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+	return result;
+}
+
+void
+MM_IdleGCManager::releaseFreeHeapGradually(MM_EnvironmentBase* env)
+{
+	MM_GCExtensions* extensions = MM_GCExtensions::getExtensions(env);
+	J9VMThread* currentThread = (J9VMThread*)env->getLanguageVMThread();
+	J9InternalVMFunctions* vmFuncs = _javaVM->internalVMFunctions;
+	UDATA step = 0;
+	UDATA totalReleasedBytes = 0;
+	bool complete = false;
+	bool interrupted = false;
+	PORT_ACCESS_FROM_JAVAVM(_javaVM);
+
+	_releaseRun = 0;
+	_releaseCursor = NULL;
+	_freeBytesVisited = 0;
+	_releasableBytesVisited = 0;
+
+	while (!complete && !interrupted) {
+		U_64 startTime = j9time_hires_clock();
+		env->acquireExclusiveVMAccess();
+		UDATA releasedBytes = releaseFreePagesIncrement(env, &complete);
+		env->releaseExclusiveVMAccess();
+		U_64 endTime = j9time_hires_clock();
+
+		step += 1;
+		totalReleasedBytes += releasedBytes;
+		TRIGGER_J9HOOK_MM_IDLE_HEAP_RELEASE_STEP(
+			extensions->hookInterface,
+			currentThread,
+			endTime,
+			J9HOOK_MM_IDLE_HEAP_RELEASE_STEP,
+			endTime - startTime,
+			step,
+			releasedBytes,
+			totalReleasedBytes,
+			_freeBytesVisited,
+			_releasableBytesVisited,
+			complete ? 1 : 0);
+
+		if (!complete) {
+			/* give up VM access between increments so that a JVM leaving the idle state is never held up for more than one step */
+			vmFuncs->internalReleaseVMAccess(currentThread);
+			omrthread_sleep(extensions->gcOnIdleReleaseInterval);
+			vmFuncs->internalAcquireVMAccess(currentThread);
+			if ((J9VM_RUNTIME_STATE_IDLE != vmFuncs->getVMRuntimeState(_javaVM))
+			|| (J9VM_RUNTIME_STATE_LISTENER_STOP == _javaVM->vmRuntimeStateListener.runtimeStateListenerState)
+			) {
+				/* the free memory which is left is likely to be allocated again soon */
+				interrupted = true;
+			}
+		}
+	}
+
+	/* Free memory in entries too small to hold a whole page cannot be returned to the operating system.
+	 * Only if enough of it has accumulated is the compacting idle collection worth its cost.
+	 */
+	if (complete && extensions->compactOnIdle && (0 != _freeBytesVisited)) {
+		float fragmentation = (float)(_freeBytesVisited - _releasableBytesVisited) / (float)_freeBytesVisited;
+		if (fragmentation > extensions->gcOnIdleCompactThreshold) {
+			extensions->heap->systemGarbageCollect(env, J9MMCONSTANT_EXPLICIT_GC_IDLE_GC);
+		}
+	}
+}
+
+UDATA
+MM_IdleGCManager::releaseFreePagesIncrement(MM_EnvironmentBase* env, bool* complete)
+{
+	MM_GCExtensions* extensions = MM_GCExtensions::getExtensions(env);
+	MM_Heap* heap = extensions->heap;
+	MM_MemorySubSpace* tenureMemorySubspace = heap->getDefaultMemorySpace()->getTenureMemorySubSpace();
+	MM_HeapMemoryPoolIterator poolIterator(env, heap, tenureMemorySubspace);
+	MM_MemoryPool* memoryPool = NULL;
+	UDATA pageSize = heap->getPageSize();
+	UDATA budget = MM_Math::roundToCeiling(pageSize, extensions->gcOnIdleReleaseStepSize);
+	UDATA releaseRun = _releaseRun;
+	UDATA cursor = (UDATA)_releaseCursor;
+	UDATA run = 0;
+	UDATA releasedBytes = 0;
+
+	/* Neither the pools nor the lists of a split free list pool are in address order relative to each other,
+	 * only the entries of one list are. The walk is cut into runs of ascending addresses, and the cursor left
+	 * by the previous increment only applies within the run it was set in: earlier runs were released entirely.
+	 */
+	*complete = true;
+	while (*complete && (NULL != (memoryPool = poolIterator.nextPoolInSubSpace()))) {
+		MM_HeapLinkedFreeHeader* freeEntry = (MM_HeapLinkedFreeHeader*)memoryPool->getFirstFreeStartingAddr(env);
+		UDATA previousStart = UDATA_MAX;
+		while (NULL != freeEntry) {
+			UDATA entryStart = (UDATA)freeEntry;
+			UDATA entryEnd = entryStart + freeEntry->getSize();
+			UDATA runCursor = 0;
+
+			if (entryStart <= previousStart) {
+				run += 1;
+			}
+			previousStart = entryStart;
+			if (run < releaseRun) {
+				runCursor = UDATA_MAX;
+			} else if (run == releaseRun) {
+				runCursor = cursor;
+			}
+
+			if (entryEnd > runCursor) {
+				/* the free header has to stay committed: only the whole pages following it can be released */
+				UDATA low = MM_Math::roundToCeiling(pageSize, entryStart + sizeof(MM_HeapLinkedFreeHeader));
+				UDATA high = MM_Math::roundToFloor(pageSize, entryEnd);
+
+				if (entryStart >= runCursor) {
+					_freeBytesVisited += freeEntry->getSize();
+					if (high > low) {
+						_releasableBytesVisited += high - low;
+					}
+				} else if (runCursor > low) {
+					/* the previous increment stopped part way through this entry */
+					low = runCursor;
+				}
+
+				if (high > low) {
+					UDATA size = OMR_MIN(high - low, budget - releasedBytes);
+					if (heap->decommitMemory((void*)low, size, (void*)low, (void*)(low + size))) {
+						releasedBytes += size;
+					}
+					releaseRun = run;
+					cursor = low + size;
+					if (releasedBytes == budget) {
+						*complete = false;
+						break;
+					}
+				}
+			}
+			freeEntry = (MM_HeapLinkedFreeHeader*)memoryPool->getNextFreeStartingAddr(env, freeEntry);
+		}
+	}
+
+	_releaseRun = releaseRun;
+	_releaseCursor = (void*)cursor;
+	return releasedBytes;
+}
+
 extern "C" {
 void idleGCManagerVMStateHook(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
 {
@@ -52,11 +52,33 @@ private:
 	 * reference to the language runtime
 	 */
 	J9JavaVM* _javaVM;
+	UDATA _releaseRun; /**< run of ascending free entry addresses the current gradual pass stopped in */
+	void* _releaseCursor; /**< address below which free memory of _releaseRun was already released during the current gradual pass */
+	UDATA _freeBytesVisited; /**< free bytes walked during the current gradual pass */
+	UDATA _releasableBytesVisited; /**< page aligned free bytes walked during the current gradual pass */
 
 protected:
 public:
 
 private:
+	/**
+	 * Release the pages of free tenure memory to the operating system in timed increments,
+	 * escalating to a compacting collection only if the free memory is too fragmented to be released.
+	 * @param env[in] the current thread, which holds VM access
+	 */
+	void releaseFreeHeapGradually(MM_EnvironmentBase* env);
+	/**
+	 * Decommit up to a step's worth of free tenure pages, resuming from _releaseCursor in _releaseRun.
+	 * Caller must hold exclusive VM access.
+	 * @param env[in] the current thread
+	 * @param complete[out] set to true if every free entry has been visited
+	 * @return the number of bytes decommitted
+	 */
+	UDATA releaseFreePagesIncrement(MM_EnvironmentBase* env, bool* complete);
+	/**
+	 * @return true if the tenure free lists may only change while exclusive VM access is held
+	 */
+	bool canReleaseGradually();
 protected:
 	/**
 	 * Initialize the object of this class and registers for Runtime State hook
@@ -86,6 +108,10 @@ public:
 	MM_IdleGCManager(MM_EnvironmentBase* env)
 		: MM_BaseNonVirtual()
 		, _javaVM((J9JavaVM*)env->getOmrVM()->_language_vm)
+		, _releaseRun(0)
+		, _releaseCursor(NULL)
+		, _freeBytesVisited(0)
+		, _releasableBytesVisited(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -27,6 +27,7 @@
 #include "MemorySpace.hpp"
 #if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
 #include "ArrayletLeafIterator.hpp"
+#include "AtomicOperations.hpp"
 #include "HeapRegionManager.hpp"
 #include "HeapRegionDescriptorVLHGC.hpp"
 #include "Heap.hpp"
@@ -366,9 +367,12 @@ MM_IndexableObjectAllocationModel::doubleMapArraylets(MM_EnvironmentBase *env, J
 	UDATA pageSize = j9mmap_get_region_granularity(NULL);
 
 	/* Get heap and from there call an OMR API that will doble map everything */
+	U_64 startTime = j9time_hires_clock();
 	result = heap->doubleMapArraylet(env, arrayletLeaveAddrs, count, arrayletLeafSize, _dataSize,
 				&firstLeafRegionDescriptor->_arrayletDoublemapID,
 				pageSize);
+	U_64 endTime = j9time_hires_clock();
+	MM_AtomicOperations::add(&extensions->arrayletDoubleMapTime, (UDATA)j9time_hires_delta(startTime, endTime, J9PORT_TIME_DELTA_IN_MICROSECONDS));
 
 	if (arrayletLeafCount > ARRAYLET_ALLOC_THRESHOLD) {
 		env->getForge()->free((void *)arrayletLeaveAddrs);
@@ -383,6 +387,10 @@ MM_IndexableObjectAllocationModel::doubleMapArraylets(MM_EnvironmentBase *env, J
 	 */
 	if (NULL == firstLeafRegionDescriptor->_arrayletDoublemapID.address) {
 		result = NULL;
+		MM_AtomicOperations::add(&extensions->arrayletDoubleMapFailedCount, 1);
+	} else {
+		MM_AtomicOperations::add(&extensions->arrayletDoubleMapCount, 1);
+		MM_AtomicOperations::add(&extensions->arrayletDoubleMapBytes, firstLeafRegionDescriptor->_arrayletDoublemapID.size);
 	}
 
 	return result;
@@ -0,0 +1,457 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "hashtable_api.h"
+#include "j9consts.h"
+#include "j9protos.h"
+#include "mmprivatehook.h"
+#include "omrthread.h"
+#include "ModronAssertions.h"
+
+#include "StringDeduplicator.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
+#include "ObjectModel.hpp"
+
+extern "C" {
+
+void
+stringDeduplicatorGCIncrementStartHook(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	((MM_StringDeduplicator *)userData)->gcStart();
+}
+
+} /* extern "C" */
+
+MM_StringDeduplicator *
+MM_StringDeduplicator::newInstance(MM_EnvironmentBase *env)
+{
+	MM_StringDeduplicator *deduplicator = (MM_StringDeduplicator *)env->getForge()->allocate(sizeof(MM_StringDeduplicator), MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL != deduplicator) {
+		new(deduplicator) MM_StringDeduplicator(env);
+		if (!deduplicator->initialize(env)) {
+			deduplicator->kill(env);
+			deduplicator = NULL;
+		}
+	}
+	return deduplicator;
+}
+
+void
+MM_StringDeduplicator::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_StringDeduplicator::initialize(MM_EnvironmentBase *env)
+{
+	_candidates = (J9Object **)env->getForge()->allocate(sizeof(J9Object *) * STRING_DEDUPLICATION_CANDIDATE_CAPACITY, MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL == _candidates) {
+		return false;
+	}
+
+	_table = hashTableNew(OMRPORT_FROM_J9PORT(_javaVM->portLibrary), J9_GET_CALLSITE(), 1024, sizeof(TableEntry), sizeof(char *), 0, OMRMEM_CATEGORY_MM, hashFn, equalFn, NULL, this);
+	if (NULL == _table) {
+		return false;
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_StringDeduplicator::monitor")) {
+		return false;
+	}
+
+	/* every collection which may move objects starts an increment, except for scavenges which call gcStart() directly */
+	J9HookInterface **privateHooks = J9_HOOK_INTERFACE(_extensions->privateHookInterface);
+	if (0 != (*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_GLOBAL_GC_INCREMENT_START, stringDeduplicatorGCIncrementStartHook, OMR_GET_CALLSITE(), this)) {
+		return false;
+	}
+	if (0 != (*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_START, stringDeduplicatorGCIncrementStartHook, OMR_GET_CALLSITE(), this)) {
+		return false;
+	}
+
+	return true;
+}
+
+void
+MM_StringDeduplicator::tearDown(MM_EnvironmentBase *env)
+{
+	J9HookInterface **privateHooks = J9_HOOK_INTERFACE(_extensions->privateHookInterface);
+	(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_GLOBAL_GC_INCREMENT_START, stringDeduplicatorGCIncrementStartHook, this);
+	(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_START, stringDeduplicatorGCIncrementStartHook, this);
+
+	if (NULL != _monitor) {
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+	if (NULL != _table) {
+		/* the thread deleted the weak references in the table as it exited */
+		hashTableFree(_table);
+		_table = NULL;
+	}
+	if (NULL != _candidates) {
+		env->getForge()->free(_candidates);
+		_candidates = NULL;
+	}
+}
+
+/**
+ * Start the thread which deduplicates the queued candidates.
+ * @return true if the thread was started, false otherwise
+ */
+bool
+MM_StringDeduplicator::startThread(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_monitor);
+
+	IDATA result = _javaVM->internalVMFunctions->createThreadWithCategory(
+						NULL,
+						_javaVM->defaultOSStackSize,
+						J9THREAD_PRIORITY_NORMAL,
+						0,
+						&threadProc,
+						this,
+						J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+
+	if (0 != result) {
+		omrthread_monitor_exit(_monitor);
+		return false;
+	}
+
+	while (thread_not_started == _threadState) {
+		omrthread_monitor_wait(_monitor);
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return thread_running == _threadState;
+}
+
+/**
+ * Ask the thread to exit and wait for it to do so.
+ */
+void
+MM_StringDeduplicator::stopThread(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_monitor);
+	if (thread_running == _threadState) {
+		_threadState = thread_stopping;
+		omrthread_monitor_notify_all(_monitor);
+		while (thread_stopped != _threadState) {
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+int J9THREAD_PROC
+MM_StringDeduplicator::threadProc(void *deduplicator)
+{
+	((MM_StringDeduplicator *)deduplicator)->threadLoop();
+	/* not reached */
+	return 0;
+}
+
+/**
+ * Main loop of the thread. Waits for a copying collection to end, then processes its candidates.
+ */
+void
+MM_StringDeduplicator::threadLoop()
+{
+	J9InternalVMFunctions *vmFuncs = _javaVM->internalVMFunctions;
+	J9VMThread *vmThread = NULL;
+
+	IDATA rc = vmFuncs->attachSystemDaemonThread(_javaVM, &vmThread, "String Deduplication");
+
+	omrthread_monitor_enter(_monitor);
+	if (JNI_OK != rc) {
+		_threadState = thread_stopped;
+		omrthread_monitor_notify_all(_monitor);
+		omrthread_exit(_monitor);
+	}
+	_vmThread = vmThread;
+	_threadState = thread_running;
+	omrthread_monitor_notify_all(_monitor);
+
+	while (thread_running == _threadState) {
+		if (!_workAvailable && !_sweepRequired) {
+			omrthread_monitor_wait(_monitor);
+		}
+		bool sweepRequired = _sweepRequired;
+		_workAvailable = false;
+		_sweepRequired = false;
+		omrthread_monitor_exit(_monitor);
+
+		vmFuncs->internalAcquireVMAccess(vmThread);
+		if (sweepRequired) {
+			sweepTable();
+		}
+		processCandidates();
+		vmFuncs->internalReleaseVMAccess(vmThread);
+
+		omrthread_monitor_enter(_monitor);
+	}
+	omrthread_monitor_exit(_monitor);
+
+	vmFuncs->internalAcquireVMAccess(vmThread);
+	clearTable();
+	vmFuncs->internalReleaseVMAccess(vmThread);
+
+	_vmThread = NULL;
+	vmFuncs->DetachCurrentThread((JavaVM *)_javaVM);
+
+	omrthread_monitor_enter(_monitor);
+	_threadState = thread_stopped;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
+
+void
+MM_StringDeduplicator::processCandidates()
+{
+	J9InternalVMFunctions *vmFuncs = _javaVM->internalVMFunctions;
+	UDATA processed = 0;
+
+	/* a collection may discard the queue and queue new candidates whenever VM access is released, so the bounds are read every time */
+	while (_cursor < OMR_MIN(_candidateCount, (UDATA)STRING_DEDUPLICATION_CANDIDATE_CAPACITY)) {
+		j9object_t string = _candidates[_cursor];
+		_cursor += 1;
+		deduplicate(string);
+
+		processed += 1;
+		if ((0 == (processed % STRING_DEDUPLICATION_YIELD_INTERVAL)) || J9_ARE_ANY_BITS_SET(_vmThread->publicFlags, J9_PUBLIC_FLAGS_HALT_THREAD_ANY)) {
+			vmFuncs->internalReleaseVMAccess(_vmThread);
+			vmFuncs->internalAcquireVMAccess(_vmThread);
+		}
+	}
+}
+
+void
+MM_StringDeduplicator::deduplicate(j9object_t string)
+{
+	j9object_t value = J9VMJAVALANGSTRING_VALUE(_vmThread, string);
+	if (NULL == value) {
+		return;
+	}
+
+	TableEntry query;
+	query.hash = hashValue(value);
+	/* a weak reference is a pointer to a slot holding the object, so a local slot can stand in for one */
+	query.string = (jobject)&string;
+
+	TableEntry *entry = (TableEntry *)hashTableFind(_table, &query);
+	if (NULL != entry) {
+		j9object_t originalValue = J9VMJAVALANGSTRING_VALUE(_vmThread, J9_JNI_UNWRAP_REFERENCE(entry->string));
+		if (originalValue != value) {
+			J9VMJAVALANGSTRING_SET_VALUE(_vmThread, string, originalValue);
+			_deduplicated += 1;
+			_bytesSaved += _extensions->objectModel.getConsumedSizeInBytesWithHeader(value);
+		}
+	} else if (STRING_DEDUPLICATION_MAX_TABLE_ENTRIES > hashTableGetCount(_table)) {
+		jobject reference = _javaVM->internalVMFunctions->j9jni_createGlobalRef((JNIEnv *)_vmThread, string, JNI_TRUE);
+		if (NULL != reference) {
+			query.string = reference;
+			if (NULL == hashTableAdd(_table, &query)) {
+				_javaVM->internalVMFunctions->j9jni_deleteGlobalRef((JNIEnv *)_vmThread, reference, JNI_TRUE);
+			}
+		}
+	}
+}
+
+UDATA
+MM_StringDeduplicator::hashValue(j9object_t value)
+{
+	UDATA hash = 0;
+	J9Class *clazz = J9OBJECT_CLAZZ(_vmThread, value);
+	U_32 size = J9INDEXABLEOBJECT_SIZE(_vmThread, value);
+
+	if (_javaVM->byteArrayClass == clazz) {
+		for (U_32 i = 0; i < size; i++) {
+			hash = (hash << 5) - hash + (U_8)J9JAVAARRAYOFBYTE_LOAD(_vmThread, value, i);
+		}
+	} else {
+		for (U_32 i = 0; i < size; i++) {
+			hash = (hash << 5) - hash + J9JAVAARRAYOFCHAR_LOAD(_vmThread, value, i);
+		}
+	}
+
+	return hash;
+}
+
+bool
+MM_StringDeduplicator::valuesEqual(j9object_t left, j9object_t right)
+{
+	if ((IS_STRING_COMPRESSED(_vmThread, left) ? 1 : 0) != (IS_STRING_COMPRESSED(_vmThread, right) ? 1 : 0)) {
+		return false;
+	}
+	if (J9VMJAVALANGSTRING_LENGTH(_vmThread, left) != J9VMJAVALANGSTRING_LENGTH(_vmThread, right)) {
+		return false;
+	}
+
+	j9object_t leftValue = J9VMJAVALANGSTRING_VALUE(_vmThread, left);
+	j9object_t rightValue = J9VMJAVALANGSTRING_VALUE(_vmThread, right);
+	if (leftValue == rightValue) {
+		return true;
+	}
+	if ((NULL == leftValue) || (NULL == rightValue)) {
+		return false;
+	}
+
+	/* the whole arrays are compared, so that any String using either array sees the same contents */
+	J9Class *clazz = J9OBJECT_CLAZZ(_vmThread, leftValue);
+	U_32 size = J9INDEXABLEOBJECT_SIZE(_vmThread, leftValue);
+	if ((clazz != J9OBJECT_CLAZZ(_vmThread, rightValue)) || (size != J9INDEXABLEOBJECT_SIZE(_vmThread, rightValue))) {
+		return false;
+	}
+
+	if (_javaVM->byteArrayClass == clazz) {
+		for (U_32 i = 0; i < size; i++) {
+			if (J9JAVAARRAYOFBYTE_LOAD(_vmThread, leftValue, i) != J9JAVAARRAYOFBYTE_LOAD(_vmThread, rightValue, i)) {
+				return false;
+			}
+		}
+	} else if (_javaVM->charArrayClass == clazz) {
+		for (U_32 i = 0; i < size; i++) {
+			if (J9JAVAARRAYOFCHAR_LOAD(_vmThread, leftValue, i) != J9JAVAARRAYOFCHAR_LOAD(_vmThread, rightValue, i)) {
+				return false;
+			}
+		}
+	} else {
+		return false;
+	}
+
+	return true;
+}
+
+UDATA
+MM_StringDeduplicator::hashFn(void *key, void *userData)
+{
+	return ((TableEntry *)key)->hash;
+}
+
+UDATA
+MM_StringDeduplicator::equalFn(void *leftKey, void *rightKey, void *userData)
+{
+	MM_StringDeduplicator *deduplicator = (MM_StringDeduplicator *)userData;
+	TableEntry *leftEntry = (TableEntry *)leftKey;
+	TableEntry *rightEntry = (TableEntry *)rightKey;
+
+	if (leftEntry->hash != rightEntry->hash) {
+		return FALSE;
+	}
+	j9object_t left = J9_JNI_UNWRAP_REFERENCE(leftEntry->string);
+	j9object_t right = J9_JNI_UNWRAP_REFERENCE(rightEntry->string);
+	/* the reference of a String which has died is cleared, and it no longer matches anything */
+	if ((NULL == left) || (NULL == right)) {
+		return FALSE;
+	}
+	return deduplicator->valuesEqual(left, right) ? TRUE : FALSE;
+}
+
+void
+MM_StringDeduplicator::sweepTable()
+{
+	J9HashTableState walkState;
+	TableEntry *entry = (TableEntry *)hashTableStartDo(_table, &walkState);
+	while (NULL != entry) {
+		if (NULL == J9_JNI_UNWRAP_REFERENCE(entry->string)) {
+			_javaVM->internalVMFunctions->j9jni_deleteGlobalRef((JNIEnv *)_vmThread, entry->string, JNI_TRUE);
+			hashTableDoRemove(&walkState);
+		}
+		entry = (TableEntry *)hashTableNextDo(&walkState);
+	}
+}
+
+void
+MM_StringDeduplicator::clearTable()
+{
+	J9HashTableState walkState;
+	TableEntry *entry = (TableEntry *)hashTableStartDo(_table, &walkState);
+	while (NULL != entry) {
+		_javaVM->internalVMFunctions->j9jni_deleteGlobalRef((JNIEnv *)_vmThread, entry->string, JNI_TRUE);
+		hashTableDoRemove(&walkState);
+		entry = (TableEntry *)hashTableNextDo(&walkState);
+	}
+}
+
+void
+MM_StringDeduplicator::flushCandidates(MM_EnvironmentBase *env)
+{
+	GC_Environment *gcEnv = env->getGCEnvironment();
+	UDATA count = gcEnv->_stringDeduplicationCandidateCount;
+
+	if (0 != count) {
+		/* claim space in the queue, dropping whatever does not fit */
+		UDATA start = MM_AtomicOperations::add(&_candidateCount, count) - count;
+		if (start < STRING_DEDUPLICATION_CANDIDATE_CAPACITY) {
+			UDATA copied = OMR_MIN(count, STRING_DEDUPLICATION_CANDIDATE_CAPACITY - start);
+			memcpy(&_candidates[start], gcEnv->_stringDeduplicationCandidates, copied * sizeof(J9Object *));
+		}
+		gcEnv->_stringDeduplicationCandidateCount = 0;
+	}
+}
+
+void
+MM_StringDeduplicator::gcStart()
+{
+	UDATA queued = OMR_MIN(_candidateCount, (UDATA)STRING_DEDUPLICATION_CANDIDATE_CAPACITY);
+	if (_cursor < queued) {
+		_dropped += queued - _cursor;
+	}
+	_candidateCount = 0;
+	_cursor = 0;
+}
+
+void
+MM_StringDeduplicator::gcEnd(MM_EnvironmentBase *env, bool successful)
+{
+	UDATA claimed = _candidateCount;
+	if (!successful) {
+		/* objects copied by a collection which backed out are back where they were */
+		_dropped += claimed;
+		_candidateCount = 0;
+		claimed = 0;
+	} else if (claimed > STRING_DEDUPLICATION_CANDIDATE_CAPACITY) {
+		_dropped += claimed - STRING_DEDUPLICATION_CANDIDATE_CAPACITY;
+		claimed = STRING_DEDUPLICATION_CANDIDATE_CAPACITY;
+	}
+
+	_stats._candidates = claimed;
+	_stats._dropped = _dropped;
+	_stats._deduplicated = _deduplicated;
+	_stats._bytesSaved = _bytesSaved;
+	_dropped = 0;
+	_deduplicated = 0;
+	_bytesSaved = 0;
+
+	omrthread_monitor_enter(_monitor);
+	_workAvailable = (0 != claimed);
+	/* weak references to Strings which died in this collection have been cleared */
+	_sweepRequired = true;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_monitor_exit(_monitor);
+}
@@ -0,0 +1,216 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(STRINGDEDUPLICATOR_HPP_)
+#define STRINGDEDUPLICATOR_HPP_
+
+#include <string.h>
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#include "BaseNonVirtual.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
+
+#define STRING_DEDUPLICATION_CANDIDATE_CAPACITY (64 * 1024) /* candidates queued by one collection */
+#define STRING_DEDUPLICATION_MAX_TABLE_ENTRIES (1024 * 1024) /* distinct values remembered by the deduplication thread */
+#define STRING_DEDUPLICATION_YIELD_INTERVAL 64 /* candidates processed between releases of VM access */
+
+extern "C" {
+/**
+ * Hook "J9HOOK_MM_PRIVATE_GLOBAL_GC_INCREMENT_START" and "J9HOOK_MM_PRIVATE_GC_INCREMENT_START" callback function
+ * Discards the queued candidates, which the collection may move
+ */
+void stringDeduplicatorGCIncrementStartHook(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+}
+
+/**
+ * Makes equal Strings share a single value array.
+ *
+ * The scavenger and copy-forward offer the Strings which survive stringDeduplicationAge collections as they copy them.
+ * GC threads buffer candidates in their GC_Environment and append them to a shared queue, which a background thread
+ * drains once the collection has ended. The thread keeps a table of weak references to Strings with distinct values:
+ * a candidate equal to a String in the table is given that String's value, as VM.setCommonData() does, and the
+ * duplicate value array is left for the next collection to reclaim.
+ *
+ * The queue holds direct object pointers, so it is only valid between collections. The thread processes it with VM
+ * access, releasing VM access regularly so that collections are not delayed, and every collection which may move
+ * objects discards whatever the thread has not processed yet.
+ */
+class MM_StringDeduplicator : public MM_BaseNonVirtual
+{
+public:
+	/**
+	 * Statistics reported when each copying collection ends.
+	 */
+	struct Stats {
+		UDATA _candidates; /**< Strings queued by the collection */
+		UDATA _dropped; /**< Strings discarded because the queue was full or the thread had not reached them before a collection */
+		UDATA _deduplicated; /**< Strings given the value of an equal String since the previous copying collection */
+		UDATA _bytesSaved; /**< size of the duplicate value arrays released since the previous copying collection */
+	};
+
+private:
+	enum ThreadState {
+		thread_not_started = 0,
+		thread_running,
+		thread_stopping,
+		thread_stopped
+	};
+
+	struct TableEntry {
+		UDATA hash; /**< hash of the contents of the value array */
+		jobject string; /**< weak global reference to the String, which is cleared once the String dies */
+	};
+
+	J9JavaVM *_javaVM;
+	MM_GCExtensions *_extensions;
+	J9Object **_candidates; /**< Strings queued by the most recent collection */
+	volatile UDATA _candidateCount; /**< candidates claimed by GC threads, which may exceed the capacity of the queue */
+	UDATA _cursor; /**< index of the next candidate for the thread to process */
+	J9HashTable *_table; /**< Strings with distinct values, accessed only by the thread */
+	omrthread_monitor_t _monitor; /**< protects the thread state and is used to wake up the thread */
+	volatile ThreadState _threadState;
+	bool _workAvailable; /**< set when a collection has queued candidates */
+	bool _sweepRequired; /**< set when a collection may have cleared references in the table */
+	J9VMThread *_vmThread; /**< the thread, while it is attached */
+	UDATA _dropped; /**< candidates dropped since the previous copying collection ended */
+	UDATA _deduplicated; /**< Strings deduplicated since the previous copying collection ended */
+	UDATA _bytesSaved; /**< bytes released since the previous copying collection ended */
+	Stats _stats; /**< statistics of the most recent copying collection */
+
+	static UDATA hashFn(void *key, void *userData);
+	static UDATA equalFn(void *leftKey, void *rightKey, void *userData);
+
+	/**
+	 * Hash the contents of the value array of a String.
+	 */
+	UDATA hashValue(j9object_t value);
+
+	/**
+	 * Determine whether two Strings may share their value arrays: they must have the same coder, and value arrays of the
+	 * same type and size with the same contents.
+	 */
+	bool valuesEqual(j9object_t left, j9object_t right);
+
+	/**
+	 * Look up a candidate in the table, sharing the value of an equal String or adding the candidate if there is none.
+	 */
+	void deduplicate(j9object_t string);
+
+	/**
+	 * Process the queued candidates. Called by the thread with VM access, which is released and reacquired regularly.
+	 */
+	void processCandidates();
+
+	/**
+	 * Remove the entries whose String has died. Called by the thread with VM access.
+	 */
+	void sweepTable();
+
+	/**
+	 * Delete every weak reference in the table. Called by the thread as it exits.
+	 */
+	void clearTable();
+
+	static int J9THREAD_PROC threadProc(void *deduplicator);
+	void threadLoop();
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_StringDeduplicator *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	bool startThread(MM_EnvironmentBase *env);
+	void stopThread(MM_EnvironmentBase *env);
+
+	/**
+	 * Determine whether an object copied by a collection is a String, and may be queued for deduplication.
+	 */
+	MMINLINE bool
+	isString(J9Class *clazz)
+	{
+		return clazz == J9VMJAVALANGSTRING_OR_NULL(_javaVM);
+	}
+
+	/**
+	 * Queue a String copied by the current collection, in the buffer of a GC thread.
+	 */
+	MMINLINE void
+	addCandidate(MM_EnvironmentBase *env, J9Object *string)
+	{
+		GC_Environment *gcEnv = env->getGCEnvironment();
+		gcEnv->_stringDeduplicationCandidates[gcEnv->_stringDeduplicationCandidateCount] = string;
+		gcEnv->_stringDeduplicationCandidateCount += 1;
+		if (STRING_DEDUPLICATION_THREAD_BUFFER_SIZE == gcEnv->_stringDeduplicationCandidateCount) {
+			flushCandidates(env);
+		}
+	}
+
+	/**
+	 * Append the candidates buffered by a GC thread to the queue. Called as each GC thread merges its stats.
+	 */
+	void flushCandidates(MM_EnvironmentBase *env);
+
+	/**
+	 * Discard the queue before a collection moves objects. Called with exclusive VM access.
+	 */
+	void gcStart();
+
+	/**
+	 * Record the statistics of a copying collection and wake up the thread.
+	 * @param successful[in] false if the collection backed out, in which case the queued candidates are no longer valid
+	 */
+	void gcEnd(MM_EnvironmentBase *env, bool successful);
+
+	/**
+	 * @return the statistics of the most recent copying collection
+	 */
+	MMINLINE Stats *getStats() { return &_stats; }
+
+	MM_StringDeduplicator(MM_EnvironmentBase *env)
+		: MM_BaseNonVirtual()
+		, _javaVM((J9JavaVM *)env->getOmrVM()->_language_vm)
+		, _extensions(MM_GCExtensions::getExtensions(env))
+		, _candidates(NULL)
+		, _candidateCount(0)
+		, _cursor(0)
+		, _table(NULL)
+		, _monitor(NULL)
+		, _threadState(thread_not_started)
+		, _workAvailable(false)
+		, _sweepRequired(false)
+		, _vmThread(NULL)
+		, _dropped(0)
+		, _deduplicated(0)
+		, _bytesSaved(0)
+	{
+		_typeId = __FUNCTION__;
+		memset(&_stats, 0, sizeof(_stats));
+	}
+};
+
+#endif /* STRINGDEDUPLICATOR_HPP_ */
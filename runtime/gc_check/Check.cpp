@@ -21,7 +21,12 @@
  *******************************************************************************/
 
 #include "Check.hpp"
+#include "CheckBase.hpp"
+#include "CheckCycle.hpp"
 #include "CheckEngine.hpp"
+#include "CheckParallelTask.hpp"
+#include "Dispatcher.hpp"
+#include "EnvironmentBase.hpp"
 
 void
 GC_Check::run(bool shouldCheck, bool shouldPrint)
@@ -36,3 +41,53 @@ GC_Check::run(bool shouldCheck, bool shouldPrint)
 		print();
 	}
 }
+
+bool
+GC_Check::checkInParallel()
+{
+	GC_CheckCycle *cycle = _engine->getCycle();
+
+	if (J9MODRON_GCCHK_MISC_PARALLEL != (cycle->getMiscFlags() & J9MODRON_GCCHK_MISC_PARALLEL)) {
+		return false;
+	}
+
+	/* the GC worker threads are idle only between the tasks of a stop-the-world collection */
+	switch (cycle->getInvoker()) {
+	case invocation_global_start:
+	case invocation_global_end:
+	case invocation_local_start:
+	case invocation_local_end:
+		break;
+	default:
+		return false;
+	}
+
+	J9VMThread *vmThread = _javaVM->internalVMFunctions->currentVMThread(_javaVM);
+	if ((NULL == vmThread) || (1 >= _extensions->dispatcher->threadCountMaximum())) {
+		return false;
+	}
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	/* The worker threads are busy with the concurrent phase of a scavenge */
+	if (_extensions->isConcurrentScavengerInProgress()) {
+		return false;
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+#if defined(J9VM_GC_REALTIME)
+	/* Metronome schedules its worker threads itself */
+	if (_extensions->isMetronomeGC()) {
+		return false;
+	}
+#endif /* J9VM_GC_REALTIME */
+
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+	if (!_engine->startWorkerEngines(this, _extensions->dispatcher->threadCountMaximum())) {
+		return false;
+	}
+	/* the worker threads walk the regions read only, so make the heap walkable for all of them here */
+	_javaVM->memoryManagerFunctions->j9gc_flush_caches_for_walk(_javaVM);
+	GC_CheckParallelTask task(env, _extensions->dispatcher, this, _engine);
+	_extensions->dispatcher->run(env, &task);
+	_engine->endWorkerEngines();
+
+	return true;
+}
@@ -35,6 +35,7 @@
 #include "GCExtensions.hpp"
 
 class GC_CheckEngine;
+class MM_EnvironmentBase;
 
 /**
  * GC_Check - abstract class for defining types of check
@@ -71,6 +72,13 @@ protected:
 	virtual void check() = 0; /**< run the check */
 	virtual void print() = 0; /**< dump the check structure to tty */
 
+	/**
+	 * Run checkWorkUnits() on the GC worker threads, if the parallel option is set and the
+	 * worker threads are available at this point of the GC.
+	 * @return true if the check was run in parallel, false if it must be run on the calling thread
+	 */
+	bool checkInParallel();
+
 public:
 	virtual void kill() = 0;
 	
@@ -82,6 +90,14 @@ public:
 	void run(bool shouldCheck, bool shouldPrint);   /**< run gc_check on the structure */
 	virtual const char *getCheckName() = 0; /**< get a string representing this check-type */
 
+	/**
+	 * Verify the units of work claimed by a GC worker thread. Checks which can be
+	 * partitioned override this and call checkInParallel() from check().
+	 * @param env the environment of the worker thread
+	 * @param engine the engine of the worker thread, used in place of _engine
+	 */
+	virtual void checkWorkUnits(MM_EnvironmentBase *env, GC_CheckEngine *engine) {}
+
 	GC_Check(J9JavaVM *javaVM, GC_CheckEngine *engine)
 		: MM_Base()
 		, _javaVM(javaVM)
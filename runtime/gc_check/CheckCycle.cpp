@@ -112,6 +112,9 @@ GC_CheckCycle::printHelp(J9PortLibrary *portLib)
 	j9tty_printf(PORTLIB, "  check\n");
 	j9tty_printf(PORTLIB, "  nocheck\n");
 	j9tty_printf(PORTLIB, "  maxErrors=X\n");
+	j9tty_printf(PORTLIB, "  parallel\n");
+	j9tty_printf(PORTLIB, "  noparallel\n");
+	j9tty_printf(PORTLIB, "  incremental=X\n");
 
 	j9tty_printf(PORTLIB, "  abort\n");
 	j9tty_printf(PORTLIB, "  noabort\n");
@@ -293,6 +296,29 @@ top:
 							continue;
 						}
 
+						if (try_scan(&scan_start, "parallel")) {
+							miscFlags |= J9MODRON_GCCHK_MISC_PARALLEL;
+							continue;
+						}
+
+						if (try_scan(&scan_start, "noparallel")) {
+							miscFlags &= ~J9MODRON_GCCHK_MISC_PARALLEL;
+							continue;
+						}
+
+						if (try_scan(&scan_start, "incremental=")) {
+							scan_udata(&scan_start, &_incrementalSlices);
+							if (0 == _incrementalSlices) {
+								goto failure;
+							}
+							if (1 < _incrementalSlices) {
+								miscFlags |= J9MODRON_GCCHK_MISC_INCREMENTAL;
+							} else {
+								miscFlags &= ~J9MODRON_GCCHK_MISC_INCREMENTAL;
+							}
+							continue;
+						}
+
 						if (try_scan(&scan_start, "darkmatter")) {
 							miscFlags |= J9MODRON_GCCHK_MISC_DARKMATTER;
 							continue;
@@ -442,6 +468,10 @@ GC_CheckCycle::run(GCCheckInvokedBy invokedBy, UDATA filterFlags)
 			abort();
 		}
 	}
+	if (_miscFlags & J9MODRON_GCCHK_MISC_INCREMENTAL) {
+		/* the next check verifies the next slice of the object heap */
+		_incrementalSlice = (_incrementalSlice + 1) % _incrementalSlices;
+	}
 	_engine->endCheckCycle(_javaVM);
 }
 
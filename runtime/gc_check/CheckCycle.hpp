@@ -32,6 +32,7 @@
 #include "j9.h"
 #include "j9cfg.h"
 
+#include "AtomicOperations.hpp"
 #include "Base.hpp"
 #include "CheckBase.hpp"
 
@@ -56,7 +57,9 @@ private:
 	UDATA _miscFlags;
 	GCCheckInvokedBy _invokedBy; /**< What stage of GC invoked the check */
 	UDATA _manualCheckInvocation; /**< Allow user to identify which installed GCCheck triggered message */
-	UDATA _errorCount; /**< Number of errors encountered  */
+	volatile UDATA _errorCount; /**< Number of errors encountered  */
+	UDATA _incrementalSlices; /**< With the incremental option, each check verifies one in this many object heap regions */
+	UDATA _incrementalSlice; /**< The regions verified by the current check are those whose index modulo _incrementalSlices equals this */
 	
 	GC_Check *_checks; /**< Pointer to head of linked list of checks to run in this cycle */
 	
@@ -85,7 +88,23 @@ public:
 	GCCheckInvokedBy getInvoker() { return _invokedBy; };
 	UDATA getManualCheckNumber() { return _manualCheckInvocation; };
 	
-	UDATA nextErrorCount() { return ++_errorCount; };
+	/**
+	 * Answer whether the object heap region with the given index is verified by the current check.
+	 * @param regionIndex the position of the region in the heap walk
+	 */
+	bool isRegionSelected(UDATA regionIndex) {
+		return (0 == (_miscFlags & J9MODRON_GCCHK_MISC_INCREMENTAL)) || (_incrementalSlice == (regionIndex % _incrementalSlices));
+	};
+
+	/**
+	 * Answer the number of the next error. Errors may be found by several GC worker threads at once.
+	 */
+	UDATA nextErrorCount() { return MM_AtomicOperations::add(&_errorCount, 1); };
+	UDATA getErrorCount() { return _errorCount; };
+	/**
+	 * Set the number of errors found, once the errors of the GC worker threads have been renumbered.
+	 */
+	void setErrorCount(UDATA errorCount) { _errorCount = errorCount; };
 	
 	/**
 	 * Run the checks
@@ -105,6 +124,8 @@ public:
 		, _invokedBy(invocation_unknown)
 		, _manualCheckInvocation(manualCountInvocation)
 		, _errorCount(0)
+		, _incrementalSlices(1)
+		, _incrementalSlice(0)
 		, _checks(NULL)
 		, _javaVM(javaVM)
 		, _portLibrary(javaVM->portLibrary)
@@ -43,6 +43,7 @@
 #include "CheckCycle.hpp"
 #include "CheckError.hpp"
 #include "CheckReporter.hpp"
+#include "CheckReporterBuffered.hpp"
 #include "CheckReporterTTY.hpp"
 #include "ClassModel.hpp"
 #include "GCExtensions.hpp"
@@ -1346,6 +1347,93 @@ GC_CheckEngine::startNewCheck(GC_Check *check)
 	clearPreviousObjects();
 }
 
+bool
+GC_CheckEngine::startWorkerEngines(GC_Check *check, UDATA workerCount)
+{
+	MM_Forge *forge = MM_GCExtensions::getExtensions(_javaVM)->getForge();
+
+	if (workerCount > _workerEngineCount) {
+		freeWorkerEngines();
+		_workerEngines = (GC_CheckEngine **)forge->allocate(workerCount * sizeof(GC_CheckEngine *), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+		_workerReporters = (GC_CheckReporterBuffered **)forge->allocate(workerCount * sizeof(GC_CheckReporterBuffered *), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+		if ((NULL == _workerEngines) || (NULL == _workerReporters)) {
+			freeWorkerEngines();
+			return false;
+		}
+		memset(_workerEngines, 0, workerCount * sizeof(GC_CheckEngine *));
+		memset(_workerReporters, 0, workerCount * sizeof(GC_CheckReporterBuffered *));
+		_workerEngineCount = workerCount;
+
+		for (UDATA i = 0; i < workerCount; i++) {
+			_workerReporters[i] = GC_CheckReporterBuffered::newInstance(_javaVM);
+			if (NULL == _workerReporters[i]) {
+				freeWorkerEngines();
+				return false;
+			}
+			_workerEngines[i] = GC_CheckEngine::newInstance(_javaVM, _workerReporters[i]);
+			if (NULL == _workerEngines[i]) {
+				freeWorkerEngines();
+				return false;
+			}
+		}
+	}
+
+	for (UDATA i = 0; i < _workerEngineCount; i++) {
+		GC_CheckEngine *worker = _workerEngines[i];
+		_workerReporters[i]->setMaxErrorsToReport(_reporter->getMaxErrorsToReport());
+		worker->_cycle = _cycle;
+		worker->_currentCheck = check;
+		worker->clearPreviousObjects();
+		worker->clearRegionDescription(&worker->_regionDesc);
+		worker->clearCheckedCache();
+		worker->_ownableSynchronizerObjectCountOnHeap = 0;
+	}
+	_workerErrorCountBase = _cycle->getErrorCount();
+
+	return true;
+}
+
+void
+GC_CheckEngine::endWorkerEngines()
+{
+	UDATA errorCount = _workerErrorCountBase;
+	for (UDATA i = 0; i < _workerEngineCount; i++) {
+		GC_CheckEngine *worker = _workerEngines[i];
+		/* the errors of each thread are output together and numbered consecutively */
+		_workerReporters[i]->replay(_reporter, &errorCount);
+		_ownableSynchronizerObjectCountOnHeap += worker->_ownableSynchronizerObjectCountOnHeap;
+	}
+	/* errors found later in the cycle are numbered after the replayed ones */
+	_cycle->setErrorCount(errorCount);
+}
+
+/**
+ * Free the engines of the GC worker threads, along with their reporters.
+ */
+void
+GC_CheckEngine::freeWorkerEngines()
+{
+	MM_Forge *forge = MM_GCExtensions::getExtensions(_javaVM)->getForge();
+
+	for (UDATA i = 0; i < _workerEngineCount; i++) {
+		if (NULL != _workerEngines[i]) {
+			/* the engine kills its reporter */
+			_workerEngines[i]->kill();
+		} else if (NULL != _workerReporters[i]) {
+			_workerReporters[i]->kill();
+		}
+	}
+	if (NULL != _workerEngines) {
+		forge->free(_workerEngines);
+		_workerEngines = NULL;
+	}
+	if (NULL != _workerReporters) {
+		forge->free(_workerReporters);
+		_workerReporters = NULL;
+	}
+	_workerEngineCount = 0;
+}
+
 /**
  * Ensure the GC internal scope pointers refer to objects within the scope.
  *
@@ -1386,6 +1474,7 @@ void
 GC_CheckEngine::kill()
 {
 	MM_Forge *forge = MM_GCExtensions::getExtensions(_javaVM)->getForge();
+	freeWorkerEngines();
 	if(_reporter) {
 		_reporter->kill();
 	}
@@ -39,7 +39,9 @@
 #include "HeapIteratorAPI.h"
 #include "MemorySpace.hpp"
 
+class GC_Check;
 class GC_CheckCycle;
+class GC_CheckReporterBuffered;
 class GC_FinalizeList;
 class GC_ScanFormatter;
 class GC_VMThreadIterator;
@@ -76,6 +78,11 @@ private:
 	#define UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER ((UDATA)-1)
 	UDATA	_ownableSynchronizerObjectCountOnList; /**< the count of ownableSynchronizerObjects on the ownableSynchronizerLists, =UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER indicates that the count has not been calculated */
 	UDATA	_ownableSynchronizerObjectCountOnHeap; /**< the count of ownableSynchronizerObjects on the heap, =UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER indicates that the count has not been calculated */
+
+	GC_CheckEngine **_workerEngines; /**< engines used by the GC worker threads during a parallel check, indexed by worker ID */
+	GC_CheckReporterBuffered **_workerReporters; /**< the reporters of _workerEngines */
+	UDATA _workerEngineCount; /**< number of entries in _workerEngines */
+	UDATA _workerErrorCountBase; /**< the cycle's error count when the GC worker threads started */
 	
 protected:
 
@@ -119,10 +126,13 @@ private:
 	
 	bool initialize(void);
 
+	void freeWorkerEngines();
+
 protected:
 
 public:
 	MMINLINE J9JavaVM *getJavaVM() { return _javaVM; };
+	MMINLINE GC_CheckCycle *getCycle() { return _cycle; };
 
 	void clearPreviousObjects();
 	void pushPreviousObject(J9Object *objectPtr);
@@ -132,6 +142,10 @@ public:
 	bool verifyOwnableSynchronizerObjectCounts();
 	MMINLINE void initializeOwnableSynchronizerCountOnList() { _ownableSynchronizerObjectCountOnList = 0; };
 	MMINLINE void initializeOwnableSynchronizerCountOnHeap() { _ownableSynchronizerObjectCountOnHeap = 0; };
+	/**
+	 * Forget the count of ownableSynchronizerObjects on the heap, for when only part of the heap was verified.
+	 */
+	MMINLINE void invalidateOwnableSynchronizerCountOnHeap() { _ownableSynchronizerObjectCountOnHeap = UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER; };
 
 	UDATA checkObjectHeap(J9JavaVM *javaVM, J9MM_IterateObjectDescriptor *objectDesc, J9MM_IterateRegionDescriptor *regionDesc);
 	UDATA checkSlotObjectHeap(J9JavaVM *javaVM, J9Object *objectPtr, fj9object_t *objectIndirect, J9MM_IterateRegionDescriptor *regionDesc, J9Object *objectIndirectBase);
@@ -161,6 +175,23 @@ public:
 	void startCheckCycle(J9JavaVM *javaVM, GC_CheckCycle *checkCycle);
 	void endCheckCycle(J9JavaVM *javaVM);
 	void startNewCheck(GC_Check *check);	
+
+	/**
+	 * Prepare an engine for each GC worker thread which takes part in a parallel check.
+	 * @param check the check which is about to run in parallel
+	 * @param workerCount the number of GC worker threads
+	 * @return true on success, false if the check must run on the calling thread alone
+	 */
+	bool startWorkerEngines(GC_Check *check, UDATA workerCount);
+
+	/**
+	 * Output the errors found by the GC worker threads, one thread after the other, and
+	 * fold their counts into this engine.
+	 */
+	void endWorkerEngines();
+
+	MMINLINE GC_CheckEngine *getWorkerEngine(UDATA workerID) { return _workerEngines[workerID]; };
+
 	bool isStackDumpAlwaysDisplayed();
 	void copyRegionDescription(J9MM_IterateRegionDescriptor* from, J9MM_IterateRegionDescriptor* to);
 	void clearRegionDescription(J9MM_IterateRegionDescriptor* toClear);
@@ -184,6 +215,10 @@ public:
 		, _lastHeapObject3()
 		, _ownableSynchronizerObjectCountOnList(UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER)
 		, _ownableSynchronizerObjectCountOnHeap(UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER)
+		, _workerEngines(NULL)
+		, _workerReporters(NULL)
+		, _workerEngineCount(0)
+		, _workerErrorCountBase(0)
 #if defined(J9VM_GC_MODRON_SCAVENGER)	
 		, _scavengerBackout(false)
 		, _rsOverflowState(false)
@@ -20,8 +20,10 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include "CheckCycle.hpp"
 #include "CheckEngine.hpp"
 #include "CheckObjectHeap.hpp"
+#include "EnvironmentBase.hpp"
 #include "MemorySubSpace.hpp"
 #include "ModronTypes.hpp"
 #include "ScanFormatter.hpp"
@@ -34,6 +36,9 @@
 typedef struct ObjectIteratorCallbackUserData {
 	GC_CheckEngine* engine; /* Input */
 	J9PortLibrary* portLibrary; /* Input */
+	MM_EnvironmentBase* env; /* Input - the GC worker thread claiming regions, or NULL when the walk is not parallel */
+	UDATA regionFlags; /* Input - flags passed to j9mm_iterate_regions */
+	UDATA regionIndex; /* Temp - index of the next region found by the region iterator */
 	J9MM_IterateRegionDescriptor* regionDesc; /* Temp - used internally by iterator functions */
 } ObjectIteratorCallbackUserData;
 
@@ -67,10 +72,35 @@ GC_CheckObjectHeap::kill()
 void
 GC_CheckObjectHeap::check()
 {
-	/* Check by using the HeapIteratorAPI */
+	/* The regions are divided amongst the GC worker threads, when possible */
+	if (!checkInParallel()) {
+		/* Check by using the HeapIteratorAPI */
+		ObjectIteratorCallbackUserData userData;
+		userData.engine = _engine;
+		userData.portLibrary = _portLibrary;
+		userData.env = NULL;
+		userData.regionFlags = 0;
+		userData.regionIndex = 0;
+		userData.regionDesc = NULL;
+		_javaVM->memoryManagerFunctions->j9mm_iterate_heaps(_javaVM, _portLibrary, 0, check_heapIteratorCallback, &userData);
+	}
+
+	if (J9MODRON_GCCHK_MISC_INCREMENTAL == (_engine->getCycle()->getMiscFlags() & J9MODRON_GCCHK_MISC_INCREMENTAL)) {
+		/* Only some of the regions were verified, so the heap count of ownable synchronizers can't be compared with the lists */
+		_engine->invalidateOwnableSynchronizerCountOnHeap();
+	}
+}
+
+void
+GC_CheckObjectHeap::checkWorkUnits(MM_EnvironmentBase *env, GC_CheckEngine *engine)
+{
 	ObjectIteratorCallbackUserData userData;
-	userData.engine = _engine;
+	userData.engine = engine;
 	userData.portLibrary = _portLibrary;
+	userData.env = env;
+	/* checkInParallel() has flushed the caches, and the worker threads must not do it concurrently */
+	userData.regionFlags = j9mm_iterator_flag_regions_read_only;
+	userData.regionIndex = 0;
 	userData.regionDesc = NULL;
 	_javaVM->memoryManagerFunctions->j9mm_iterate_heaps(_javaVM, _portLibrary, 0, check_heapIteratorCallback, &userData);
 }
@@ -94,7 +124,7 @@ static jvmtiIterationControl
 check_spaceIteratorCallback(J9JavaVM* vm, J9MM_IterateSpaceDescriptor* spaceDesc, void* userData)
 {
 	ObjectIteratorCallbackUserData* castUserData = (ObjectIteratorCallbackUserData*)userData;
-	vm->memoryManagerFunctions->j9mm_iterate_regions(vm, castUserData->portLibrary, spaceDesc, 0, check_regionIteratorCallback, castUserData);
+	vm->memoryManagerFunctions->j9mm_iterate_regions(vm, castUserData->portLibrary, spaceDesc, castUserData->regionFlags, check_regionIteratorCallback, castUserData);
 	return JVMTI_ITERATION_CONTINUE;
 }
 
@@ -102,8 +132,16 @@ static jvmtiIterationControl
 check_regionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDesc, void* userData)
 {
 	ObjectIteratorCallbackUserData* castUserData = (ObjectIteratorCallbackUserData*)userData;
-	castUserData->regionDesc = regionDesc;
-	vm->memoryManagerFunctions->j9mm_iterate_region_objects(vm, castUserData->portLibrary, regionDesc, j9mm_iterator_flag_include_holes, check_objectIteratorCallback, castUserData);
+	UDATA regionIndex = castUserData->regionIndex;
+	castUserData->regionIndex += 1;
+
+	/* Every worker thread finds the regions in the same order, so a region is claimed by exactly one of them */
+	if (castUserData->engine->getCycle()->isRegionSelected(regionIndex)
+		&& ((NULL == castUserData->env) || J9MODRON_HANDLE_NEXT_WORK_UNIT(castUserData->env))
+	) {
+		castUserData->regionDesc = regionDesc;
+		vm->memoryManagerFunctions->j9mm_iterate_region_objects(vm, castUserData->portLibrary, regionDesc, j9mm_iterator_flag_include_holes, check_objectIteratorCallback, castUserData);
+	}
 	return JVMTI_ITERATION_CONTINUE;
 }
 
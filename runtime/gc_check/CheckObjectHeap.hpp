@@ -48,6 +48,8 @@ public:
 
 	virtual const char *getCheckName() { return "HEAP"; };
 
+	virtual void checkWorkUnits(MM_EnvironmentBase *env, GC_CheckEngine *engine);
+
 	GC_CheckObjectHeap(J9JavaVM *javaVM, GC_CheckEngine *engine) :
 		GC_Check(javaVM, engine)
 	{}
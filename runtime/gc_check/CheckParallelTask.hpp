@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Check
+ */
+
+#if !defined(CHECKPARALLELTASK_HPP_)
+#define CHECKPARALLELTASK_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#include "ParallelTask.hpp"
+
+class GC_Check;
+class GC_CheckEngine;
+
+/**
+ * Run a check on the GC worker threads. Each worker passes its own engine to
+ * GC_Check::checkWorkUnits, which verifies the units of work the worker claims.
+ * @ingroup GC_Check
+ */
+class GC_CheckParallelTask : public MM_ParallelTask
+{
+private:
+	GC_Check *_check; /**< the check being run */
+	GC_CheckEngine *_engine; /**< the engine of the thread which dispatched the task */
+
+public:
+	virtual UDATA getVMStateID() { return J9VMSTATE_GC; }
+	virtual void run(MM_EnvironmentBase *env);
+
+	GC_CheckParallelTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, GC_Check *check, GC_CheckEngine *engine)
+		: MM_ParallelTask(env, dispatcher)
+		, _check(check)
+		, _engine(engine)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* CHECKPARALLELTASK_HPP_ */
@@ -22,6 +22,7 @@
 
 #include "CheckEngine.hpp"
 #include "CheckRememberedSet.hpp"
+#include "EnvironmentBase.hpp"
 #include "ModronTypes.hpp"
 #include "ScanFormatter.hpp"
 
@@ -58,6 +59,11 @@ GC_CheckRememberedSet::check()
 		return;
 	}
 
+	/* the puddles are divided amongst the GC worker threads, when possible */
+	if (checkInParallel()) {
+		return;
+	}
+
 	while((puddle = remSetIterator.nextList()) != NULL) {
 		GC_RememberedSetSlotIterator remSetSlotIterator(puddle);
 
@@ -69,6 +75,26 @@ GC_CheckRememberedSet::check()
 	}
 }
 
+void
+GC_CheckRememberedSet::checkWorkUnits(MM_EnvironmentBase *env, GC_CheckEngine *engine)
+{
+	J9Object **slotPtr;
+	MM_SublistPuddle *puddle;
+	GC_RememberedSetIterator remSetIterator(&_extensions->rememberedSet);
+
+	while((puddle = remSetIterator.nextList()) != NULL) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			GC_RememberedSetSlotIterator remSetSlotIterator(puddle);
+
+			while((slotPtr = (J9Object **)remSetSlotIterator.nextSlot()) != NULL) {
+				if (engine->checkSlotRememberedSet(_javaVM, slotPtr, puddle) != J9MODRON_SLOT_ITERATOR_OK ){
+					return;
+				}
+			}
+		}
+	}
+}
+
 void
 GC_CheckRememberedSet::print()
 {
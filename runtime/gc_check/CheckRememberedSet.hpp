@@ -50,6 +50,8 @@ public:
 
 	virtual const char *getCheckName() { return "REMEMBERED SET"; };
 
+	virtual void checkWorkUnits(MM_EnvironmentBase *env, GC_CheckEngine *engine);
+
 	GC_CheckRememberedSet(J9JavaVM *javaVM, GC_CheckEngine *engine) :
 		GC_Check(javaVM, engine)
 	{}
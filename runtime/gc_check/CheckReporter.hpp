@@ -106,6 +106,7 @@ public:
 		GC_CheckElement previousObjectPtr3) = 0;
 
 	void setMaxErrorsToReport(UDATA count) { _maxErrorsToReport = count; }
+	UDATA getMaxErrorsToReport() { return _maxErrorsToReport; }
 	bool shouldReport(GC_CheckError *error) { 
 		return (_maxErrorsToReport == 0) || (error->_errorNumber <= _maxErrorsToReport);
 	}
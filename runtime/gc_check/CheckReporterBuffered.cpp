@@ -0,0 +1,215 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Check
+ */
+
+#include <string.h>
+
+#include "CheckReporterBuffered.hpp"
+
+#include "CheckError.hpp"
+#include "GCExtensions.hpp"
+
+#define INITIAL_REPORT_CAPACITY 16
+
+/**
+ * Create a new instance of the buffered reporter.
+ */
+GC_CheckReporterBuffered *
+GC_CheckReporterBuffered::newInstance(J9JavaVM *javaVM)
+{
+	MM_Forge *forge = MM_GCExtensions::getExtensions(javaVM)->getForge();
+
+	GC_CheckReporterBuffered *reporter = (GC_CheckReporterBuffered *)forge->allocate(sizeof(GC_CheckReporterBuffered), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL != reporter) {
+		reporter = new(reporter) GC_CheckReporterBuffered(javaVM);
+	}
+	return reporter;
+}
+
+/**
+ * Destroy the instance of the reporter.
+ */
+void
+GC_CheckReporterBuffered::kill()
+{
+	MM_Forge *forge = MM_GCExtensions::getExtensions(_javaVM)->getForge();
+	if (NULL != _reports) {
+		forge->free(_reports);
+	}
+	forge->free(this);
+}
+
+/**
+ * Make room for one more entry.
+ * @return true if there is room, false if the buffer could not be grown
+ */
+bool
+GC_CheckReporterBuffered::ensureCapacity()
+{
+	if (_reportCount == _reportCapacity) {
+		MM_Forge *forge = MM_GCExtensions::getExtensions(_javaVM)->getForge();
+		UDATA newCapacity = (0 == _reportCapacity) ? INITIAL_REPORT_CAPACITY : (_reportCapacity * 2);
+		Report *newReports = (Report *)forge->allocate(newCapacity * sizeof(Report), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+		if (NULL == newReports) {
+			return false;
+		}
+		if (NULL != _reports) {
+			memcpy(newReports, _reports, _reportCount * sizeof(Report));
+			forge->free(_reports);
+		}
+		_reports = newReports;
+		_reportCapacity = newCapacity;
+	}
+	return true;
+}
+
+/**
+ * Allocate an entry for a report.
+ * Once as many errors have been recorded as can ever be reported, further errors are dropped,
+ * along with the reports which elaborate on them.
+ * @return the entry, or NULL if the report is dropped
+ */
+GC_CheckReporterBuffered::Report *
+GC_CheckReporterBuffered::newReport(ReportType type, GC_CheckError *error)
+{
+	if (error->_errorNumber != _lastErrorNumber) {
+		_lastErrorNumber = error->_errorNumber;
+		_lastErrorRecorded = false;
+		if ((0 != _maxErrorsToReport) && (_errorCount >= _maxErrorsToReport)) {
+			/* errors after the first _maxErrorsToReport of this thread can't be among the first _maxErrorsToReport of the cycle */
+			_unreportedErrorCount += 1;
+			return NULL;
+		}
+		if (!ensureCapacity()) {
+			_droppedErrorCount += 1;
+			return NULL;
+		}
+		_errorCount += 1;
+		_lastErrorRecorded = true;
+	} else if (!_lastErrorRecorded || !ensureCapacity()) {
+		return NULL;
+	}
+
+	Report *entry = &_reports[_reportCount];
+	_reportCount += 1;
+	memset(entry, 0, sizeof(Report));
+	entry->type = type;
+	new(&entry->error) GC_CheckError(*error);
+	return entry;
+}
+
+void
+GC_CheckReporterBuffered::report(GC_CheckError *error)
+{
+	newReport(report_error, error);
+}
+
+void
+GC_CheckReporterBuffered::reportObjectHeader(GC_CheckError *error, J9Object *objectPtr, const char *prefix)
+{
+	Report *entry = newReport(report_object_header, error);
+	if (NULL != entry) {
+		entry->objectPtr = objectPtr;
+		entry->prefix = prefix;
+	}
+}
+
+void
+GC_CheckReporterBuffered::reportClass(GC_CheckError *error, J9Class *clazz, const char *prefix)
+{
+	Report *entry = newReport(report_class, error);
+	if (NULL != entry) {
+		entry->clazz = clazz;
+		entry->prefix = prefix;
+	}
+}
+
+void
+GC_CheckReporterBuffered::reportFatalError(GC_CheckError *error)
+{
+	newReport(report_fatal_error, error);
+}
+
+void
+GC_CheckReporterBuffered::reportHeapWalkError(GC_CheckError *error, GC_CheckElement previousObjectPtr1, GC_CheckElement previousObjectPtr2, GC_CheckElement previousObjectPtr3)
+{
+	Report *entry = newReport(report_heap_walk_error, error);
+	if (NULL != entry) {
+		entry->previous[0] = previousObjectPtr1;
+		entry->previous[1] = previousObjectPtr2;
+		entry->previous[2] = previousObjectPtr3;
+	}
+}
+
+void
+GC_CheckReporterBuffered::replay(GC_CheckReporter *reporter, UDATA *errorCount)
+{
+	UDATA lastErrorNumber = 0;
+
+	for (UDATA i = 0; i < _reportCount; i++) {
+		Report *entry = &_reports[i];
+		GC_CheckError error(entry->error);
+
+		if (error._errorNumber != lastErrorNumber) {
+			lastErrorNumber = error._errorNumber;
+			*errorCount += 1;
+		}
+		error._errorNumber = *errorCount;
+
+		switch (entry->type) {
+		case report_error:
+			reporter->report(&error);
+			break;
+		case report_object_header:
+			reporter->reportObjectHeader(&error, entry->objectPtr, entry->prefix);
+			break;
+		case report_class:
+			reporter->reportClass(&error, entry->clazz, entry->prefix);
+			break;
+		case report_fatal_error:
+			reporter->reportFatalError(&error);
+			break;
+		case report_heap_walk_error:
+			reporter->reportHeapWalkError(&error, entry->previous[0], entry->previous[1], entry->previous[2]);
+			break;
+		default:
+			break;
+		}
+	}
+
+	if (0 != _droppedErrorCount) {
+		PORT_ACCESS_FROM_PORT(_portLibrary);
+		j9tty_printf(PORTLIB, "  <gc check: %zu errors found by a GC worker thread could not be recorded>\n", _droppedErrorCount);
+	}
+	*errorCount += _droppedErrorCount + _unreportedErrorCount;
+
+	_reportCount = 0;
+	_errorCount = 0;
+	_lastErrorNumber = 0;
+	_lastErrorRecorded = false;
+	_droppedErrorCount = 0;
+	_unreportedErrorCount = 0;
+}
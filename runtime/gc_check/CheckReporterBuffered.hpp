@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Check
+ */
+
+#if !defined(CHECKREPORTERBUFFERED_HPP_)
+#define CHECKREPORTERBUFFERED_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#include "CheckReporter.hpp"
+
+class GC_CheckError;
+
+/**
+ * Record reports in memory so that they can be replayed to another reporter later.
+ * Used by the engines of GC worker threads during a parallel check, so that the
+ * reports of each thread are printed together, in the order they were found.
+ * @ingroup GC_Check
+ */
+class GC_CheckReporterBuffered : public GC_CheckReporter
+{
+private:
+	enum ReportType {
+		report_error = 0,
+		report_object_header,
+		report_class,
+		report_fatal_error,
+		report_heap_walk_error
+	};
+
+	struct Report {
+		ReportType type;
+		GC_CheckError error;
+		J9Object *objectPtr; /**< object of report_object_header */
+		J9Class *clazz; /**< class of report_class */
+		const char *prefix; /**< prefix of report_object_header and report_class */
+		GC_CheckElement previous[3]; /**< previous objects of report_heap_walk_error */
+	};
+
+	Report *_reports;
+	UDATA _reportCount; /**< number of entries of _reports in use */
+	UDATA _reportCapacity; /**< number of entries allocated for _reports */
+	UDATA _errorCount; /**< number of distinct errors recorded */
+	UDATA _lastErrorNumber; /**< number of the last error reported */
+	bool _lastErrorRecorded; /**< false if the last error reported was dropped */
+	UDATA _droppedErrorCount; /**< number of errors which could not be recorded */
+	UDATA _unreportedErrorCount; /**< number of errors beyond the report limit, which are not recorded */
+
+	bool ensureCapacity();
+	Report *newReport(ReportType type, GC_CheckError *error);
+
+public:
+	static GC_CheckReporterBuffered *newInstance(J9JavaVM *javaVM);
+	virtual void kill();
+	virtual void report(GC_CheckError *error);
+	virtual void reportObjectHeader(GC_CheckError *error, J9Object *objectPtr, const char *prefix);
+	virtual void reportClass(GC_CheckError *error, J9Class *clazz, const char *prefix);
+	virtual void reportFatalError(GC_CheckError *error);
+	virtual void reportHeapWalkError(GC_CheckError *error, GC_CheckElement previousObjectPtr1, GC_CheckElement previousObjectPtr2, GC_CheckElement previousObjectPtr3);
+
+	/**
+	 * Pass the recorded reports on to another reporter and forget them.
+	 * Errors are renumbered in the order they are replayed. Errors which were not recorded
+	 * are counted after the replayed ones.
+	 * @param reporter the reporter which outputs the reports
+	 * @param errorCount[in/out] the number of errors found so far in this cycle
+	 */
+	void replay(GC_CheckReporter *reporter, UDATA *errorCount);
+
+	GC_CheckReporterBuffered(J9JavaVM *javaVM)
+		: GC_CheckReporter(javaVM)
+		, _reports(NULL)
+		, _reportCount(0)
+		, _reportCapacity(0)
+		, _errorCount(0)
+		, _lastErrorNumber(0)
+		, _lastErrorRecorded(false)
+		, _droppedErrorCount(0)
+		, _unreportedErrorCount(0)
+	{}
+};
+
+#endif /* CHECKREPORTERBUFFERED_HPP_ */
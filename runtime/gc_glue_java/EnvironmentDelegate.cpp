@@ -33,6 +33,9 @@
 #include "ReferenceObjectBufferRealtime.hpp"
 #include "ReferenceObjectBufferStandard.hpp"
 #include "ReferenceObjectBufferVLHGC.hpp"
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+#include "ScavengerPretenuring.hpp"
+#endif /* J9VM_GC_MODRON_SCAVENGER */
 #include "SublistFragment.hpp"
 #include "UnfinalizedObjectBufferRealtime.hpp"
 #include "UnfinalizedObjectBufferStandard.hpp"
@@ -150,6 +153,13 @@ MM_EnvironmentDelegate::flushNonAllocationCaches()
 #endif /* J9VM_GC_FINALIZATION */
 
 	_gcEnv._ownableSynchronizerObjectBuffer->flush(_env);
+
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+	MM_ScavengerPretenuring *pretenuring = MM_GCExtensions::getExtensions(_env)->scavengerPretenuring;
+	if (NULL != pretenuring) {
+		pretenuring->flushAllocationBytes(&_gcEnv);
+	}
+#endif /* J9VM_GC_MODRON_SCAVENGER */
 }
 
 void
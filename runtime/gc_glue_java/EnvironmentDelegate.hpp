@@ -36,6 +36,21 @@ class MM_OwnableSynchronizerObjectBuffer;
 class MM_ReferenceObjectBuffer;
 class MM_UnfinalizedObjectBuffer;
 
+#define STRING_DEDUPLICATION_THREAD_BUFFER_SIZE 32
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+#define SCAVENGER_PRETENURE_ALLOCATION_CACHE_SIZE 8 /* must be a power of two */
+
+/**
+ * Bytes allocated by a mutator thread for one pretenured class, before they are added to the pretenuring statistics.
+ */
+struct GC_PretenuredAllocationBytes {
+	J9Class *clazz; /**< the class, or NULL if the entry is free */
+	uintptr_t sampledBytes; /**< bytes allocated in the nursery as a sample */
+	uintptr_t pretenuredBytes; /**< bytes allocated in tenure space */
+};
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
 class GC_Environment
 {
 	/* Data members */
@@ -51,6 +66,12 @@ public:
 	MM_ReferenceObjectBuffer *_referenceObjectBuffer; /**< The thread-specific buffer of recently discovered reference objects */
 	MM_UnfinalizedObjectBuffer *_unfinalizedObjectBuffer; /**< The thread-specific buffer of recently allocated unfinalized objects */
 	MM_OwnableSynchronizerObjectBuffer *_ownableSynchronizerObjectBuffer; /**< The thread-specific buffer of recently allocated ownable synchronizer objects */
+	omrobjectptr_t _stringDeduplicationCandidates[STRING_DEDUPLICATION_THREAD_BUFFER_SIZE]; /**< The thread-specific buffer of Strings copied by the current collection which are to be deduplicated */
+	uintptr_t _stringDeduplicationCandidateCount; /**< The number of Strings in _stringDeduplicationCandidates */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	GC_PretenuredAllocationBytes _pretenuredAllocationBytes[SCAVENGER_PRETENURE_ALLOCATION_CACHE_SIZE]; /**< The thread-specific bytes allocated for recently seen pretenured classes */
+	uintptr_t _pretenuredAllocationCount; /**< The thread-specific count of pretenured allocations, which picks the allocations sampled in the nursery */
+#endif /* OMR_GC_MODRON_SCAVENGER */
 
 	/* Function members */
 private:
@@ -60,7 +81,19 @@ public:
 		:_referenceObjectBuffer(NULL)
 		,_unfinalizedObjectBuffer(NULL)
 		,_ownableSynchronizerObjectBuffer(NULL)
-	{}
+		,_stringDeduplicationCandidateCount(0)
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		,_pretenuredAllocationCount(0)
+#endif /* OMR_GC_MODRON_SCAVENGER */
+	{
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		for (uintptr_t i = 0; i < SCAVENGER_PRETENURE_ALLOCATION_CACHE_SIZE; i++) {
+			_pretenuredAllocationBytes[i].clazz = NULL;
+			_pretenuredAllocationBytes[i].sampledBytes = 0;
+			_pretenuredAllocationBytes[i].pretenuredBytes = 0;
+		}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+	}
 };
 
 class MM_EnvironmentDelegate
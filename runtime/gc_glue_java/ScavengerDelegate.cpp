@@ -98,9 +98,11 @@
 #include "Scavenger.hpp"
 #include "ScavengerStats.hpp"
 #include "ScavengerBackOutScanner.hpp"
+#include "ScavengerPretenuring.hpp"
 #include "SlotObject.hpp"
 #include "StandardAccessBarrier.hpp"
 #include "SublistFragment.hpp"
+#include "StringDeduplicator.hpp"
 #include "StringTable.hpp"
 #include "Task.hpp"
 #include "UnfinalizedObjectBuffer.hpp"
@@ -139,6 +141,16 @@ MM_ScavengerDelegate::initialize(MM_EnvironmentBase *env)
 	}
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
+	/* Objects copied by the concurrent scavenger are not all scanned while the world is stopped, so they are not attributed to their class */
+	if (_extensions->scavengerPretenure && !_extensions->isConcurrentScavengerEnabled()) {
+		_extensions->scavengerPretenuring = MM_ScavengerPretenuring::newInstance(env);
+		if (NULL == _extensions->scavengerPretenuring) {
+			return false;
+		}
+		/* Record in the VM so inline allocates check for pretenured classes only when pretenuring is enabled */
+		_javaVM->pretenuredAllocationEnabled = 1;
+	}
+
 	return true;
 }
 
@@ -148,6 +160,10 @@ MM_ScavengerDelegate::initialize(MM_EnvironmentBase *env)
 void
 MM_ScavengerDelegate::tearDown(MM_EnvironmentBase *env)
 {
+	if (NULL != _extensions->scavengerPretenuring) {
+		_extensions->scavengerPretenuring->kill(env);
+		_extensions->scavengerPretenuring = NULL;
+	}
 }
 
 void
@@ -169,6 +185,10 @@ MM_ScavengerDelegate::masterSetupForGC(MM_EnvironmentBase * envBase)
 	/* set the candidates of ownableSynchronizerObject for gc verbose report */
 	_extensions->scavengerJavaStats._ownableSynchronizerCandidates = ownableSynchronizerCandidates;
 
+	if (NULL != _extensions->stringDeduplicator) {
+		_extensions->stringDeduplicator->gcStart();
+	}
+
 	/* correspondent lists will be build this scavenge */
 	_shouldScavengeSoftReferenceObjects = false;
 	_shouldScavengeWeakReferenceObjects = false;
@@ -203,6 +223,12 @@ MM_ScavengerDelegate::reportScavengeEnd(MM_EnvironmentBase * envBase, bool scave
 
 		_extensions->scavengerJavaStats._ownableSynchronizerNurserySurvived = _extensions->scavengerJavaStats._ownableSynchronizerCandidates;
 	}
+	if (NULL != _extensions->scavengerPretenuring) {
+		_extensions->scavengerPretenuring->scavengeEnd(envBase, scavengeSuccessful);
+	}
+	if (NULL != _extensions->stringDeduplicator) {
+		_extensions->stringDeduplicator->gcEnd(envBase, scavengeSuccessful);
+	}
 }
 
 void
@@ -224,6 +250,13 @@ MM_ScavengerDelegate::mergeGCStats_mergeLangStats(MM_EnvironmentBase * envBase)
 	finalGCJavaStats->_softReferenceStats.merge(&scavJavaStats->_softReferenceStats);
 	finalGCJavaStats->_phantomReferenceStats.merge(&scavJavaStats->_phantomReferenceStats);
 
+	if (NULL != _extensions->scavengerPretenuring) {
+		_extensions->scavengerPretenuring->flushCopyBytes(scavJavaStats);
+	}
+	if (NULL != _extensions->stringDeduplicator) {
+		_extensions->stringDeduplicator->flushCandidates(env);
+	}
+
 	scavJavaStats->clear();
 }
 
@@ -289,6 +322,33 @@ MM_ScavengerDelegate::getObjectScanner(MM_EnvironmentStandard *env, omrobjectptr
 	GC_ObjectScanner *objectScanner = NULL;
 	J9Class *clazzPtr = J9GC_J9OBJECT_CLAZZ(objectPtr, env);
 
+	MM_ScavengerPretenuring *pretenuring = _extensions->scavengerPretenuring;
+	if ((NULL != pretenuring) && GC_ObjectScanner::isHeapScan(flags)) {
+		/* objects are heap scanned once, after they have been copied */
+		bool tenured = !_extensions->scavenger->isObjectInNewSpace(objectPtr);
+		UDATA objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+		pretenuring->recordCopy(&env->getGCEnvironment()->_scavengerJavaStats, clazzPtr, objectSize, tenured, _extensions->objectModel.getObjectAge(objectPtr));
+	}
+
+	MM_StringDeduplicator *stringDeduplicator = _extensions->stringDeduplicator;
+	if ((NULL != stringDeduplicator) && GC_ObjectScanner::isHeapScan(flags) && stringDeduplicator->isString(clazzPtr)) {
+		bool queue = false;
+		if (_extensions->scavenger->isObjectInNewSpace(objectPtr)) {
+			/* new space objects are only heap scanned once they have been copied to survivor space, with their new age */
+			queue = (_extensions->stringDeduplicationAge == _extensions->objectModel.getObjectAge(objectPtr));
+		} else {
+			/*
+			 * Objects are not aged once they are tenured, so Strings are also queued as they are tenured. Tenured objects
+			 * are heap scanned again in each scavenge while they are in the remembered set; those tenured by this scavenge
+			 * are not remembered until they have been scanned.
+			 */
+			queue = !_extensions->objectModel.isRemembered(objectPtr);
+		}
+		if (queue) {
+			stringDeduplicator->addCandidate(env, objectPtr);
+		}
+	}
+
 	switch(_extensions->objectModel.getScanType(clazzPtr)) {
 	case GC_ObjectModel::SCAN_MIXED_OBJECT_LINKED:
 		_extensions->scavenger->deepScan(env, objectPtr, clazzPtr->selfReferencingField1, clazzPtr->selfReferencingField2);
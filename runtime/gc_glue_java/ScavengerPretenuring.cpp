@@ -0,0 +1,288 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+#include "j9protos.h"
+#include "j9consts.h"
+#include "vmhook_internal.h"
+#include "ModronAssertions.h"
+
+#include "ScavengerPretenuring.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
+
+extern "C" {
+
+void
+scavengerPretenuringClassesUnloadHook(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	((MM_ScavengerPretenuring *)userData)->purgeDyingClasses();
+}
+
+} /* extern "C" */
+
+MM_ScavengerPretenuring *
+MM_ScavengerPretenuring::newInstance(MM_EnvironmentBase *env)
+{
+	MM_ScavengerPretenuring *pretenuring = (MM_ScavengerPretenuring *)env->getForge()->allocate(sizeof(MM_ScavengerPretenuring), MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL != pretenuring) {
+		new(pretenuring) MM_ScavengerPretenuring(env);
+		if (!pretenuring->initialize(env)) {
+			pretenuring->kill(env);
+			pretenuring = NULL;
+		}
+	}
+	return pretenuring;
+}
+
+void
+MM_ScavengerPretenuring::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_ScavengerPretenuring::initialize(MM_EnvironmentBase *env)
+{
+	UDATA tableBytes = sizeof(ClassEntry) * SCAVENGER_PRETENURE_TABLE_SIZE;
+	_table = (ClassEntry *)env->getForge()->allocate(tableBytes, MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL == _table) {
+		return false;
+	}
+	memset(_table, 0, tableBytes);
+
+	J9HookInterface **vmHookInterface = _javaVM->internalVMFunctions->getVMHookInterface(_javaVM);
+	if ((NULL == vmHookInterface) || (0 != (*vmHookInterface)->J9HookRegisterWithCallSite(vmHookInterface, J9HOOK_VM_CLASSES_UNLOAD, scavengerPretenuringClassesUnloadHook, OMR_GET_CALLSITE(), this))) {
+		return false;
+	}
+	return true;
+}
+
+void
+MM_ScavengerPretenuring::tearDown(MM_EnvironmentBase *env)
+{
+	J9HookInterface **vmHookInterface = _javaVM->internalVMFunctions->getVMHookInterface(_javaVM);
+	if (NULL != vmHookInterface) {
+		(*vmHookInterface)->J9HookUnregister(vmHookInterface, J9HOOK_VM_CLASSES_UNLOAD, scavengerPretenuringClassesUnloadHook, this);
+	}
+
+	if (NULL != _table) {
+		env->getForge()->free(_table);
+		_table = NULL;
+	}
+}
+
+MM_ScavengerPretenuring::ClassEntry *
+MM_ScavengerPretenuring::findEntry(J9Class *clazz, bool add)
+{
+	UDATA index = hashClass(clazz);
+	for (UDATA probes = 0; probes < SCAVENGER_PRETENURE_MAX_PROBES; probes++) {
+		ClassEntry *entry = &_table[index & (SCAVENGER_PRETENURE_TABLE_SIZE - 1)];
+		J9Class *entryClass = entry->clazz;
+		if (clazz == entryClass) {
+			return entry;
+		}
+		if (NULL == entryClass) {
+			if (!add) {
+				/* entries are never removed while the table is in use, so the class has none */
+				break;
+			}
+			/* other GC threads may be adding the same class */
+			entryClass = (J9Class *)MM_AtomicOperations::lockCompareExchange((volatile UDATA *)&entry->clazz, (UDATA)NULL, (UDATA)clazz);
+			if ((NULL == entryClass) || (clazz == entryClass)) {
+				return entry;
+			}
+		}
+		index += 1;
+	}
+	return NULL;
+}
+
+void
+MM_ScavengerPretenuring::clearScavengeCounts(ClassEntry *entry)
+{
+	entry->firstCopyBytes = 0;
+	entry->survivorCopyBytes = 0;
+	entry->tenuredBytes = 0;
+	entry->sampledBytes = 0;
+	entry->pretenuredBytes = 0;
+}
+
+void
+MM_ScavengerPretenuring::flushCopyBytes(MM_ScavengerJavaStats::ClassCopyBytes *cached)
+{
+	if (NULL != cached->clazz) {
+		ClassEntry *entry = findEntry(cached->clazz, true);
+		if (NULL != entry) {
+			if (0 != cached->firstCopyBytes) {
+				MM_AtomicOperations::add(&entry->firstCopyBytes, cached->firstCopyBytes);
+			}
+			if (0 != cached->survivorCopyBytes) {
+				MM_AtomicOperations::add(&entry->survivorCopyBytes, cached->survivorCopyBytes);
+			}
+			if (0 != cached->tenuredBytes) {
+				MM_AtomicOperations::add(&entry->tenuredBytes, cached->tenuredBytes);
+			}
+		}
+		cached->clazz = NULL;
+		cached->firstCopyBytes = 0;
+		cached->survivorCopyBytes = 0;
+		cached->tenuredBytes = 0;
+	}
+}
+
+void
+MM_ScavengerPretenuring::flushCopyBytes(MM_ScavengerJavaStats *stats)
+{
+	for (UDATA i = 0; i < SCAVENGER_JAVA_STATS_CLASS_CACHE_SIZE; i++) {
+		flushCopyBytes(&stats->_classCopyBytes[i]);
+	}
+}
+
+void
+MM_ScavengerPretenuring::scavengeEnd(MM_EnvironmentBase *env, bool successful)
+{
+	MM_ScavengerJavaStats *scavengerJavaStats = &_extensions->scavengerJavaStats;
+	UDATA minimumBytes = _extensions->scavengerPretenureThreshold;
+
+	for (UDATA i = 0; i < SCAVENGER_PRETENURE_TABLE_SIZE; i++) {
+		ClassEntry *entry = &_table[i];
+		J9Class *clazz = entry->clazz;
+		if (NULL == clazz) {
+			continue;
+		}
+
+		if (successful) {
+			switch (entry->state) {
+			case state_candidate:
+			{
+				/* bytes which were in the survivor space and were copied again, within the survivor space or into tenure space */
+				UDATA survivedBytes = entry->survivorCopyBytes + entry->tenuredBytes;
+				/* compare the percentages by dividing, since multiplying could overflow */
+				if ((0 != entry->residentBytes) && (entry->residentBytes >= minimumBytes)
+					&& ((survivedBytes / SCAVENGER_PRETENURE_SURVIVAL_PERCENT) >= (entry->residentBytes / 100))
+				) {
+					entry->stableScavenges += 1;
+				} else {
+					entry->stableScavenges = 0;
+				}
+				/* instances of a non-array class are all the same size, too small ones would never be pretenured */
+				if ((SCAVENGER_PRETENURE_STABLE_SCAVENGES <= entry->stableScavenges)
+					&& (J9ROMCLASS_IS_ARRAY(clazz->romClass) || isPretenuredSize(clazz->totalInstanceSize))
+				) {
+					entry->state = state_pretenured;
+					clazz->classFlags |= J9ClassPretenured;
+					scavengerJavaStats->_pretenuredClassesAdded += 1;
+				}
+				break;
+			}
+			case state_pretenured:
+				scavengerJavaStats->_pretenuredBytes += entry->pretenuredBytes;
+				if ((entry->sampledBytes >= (minimumBytes / SCAVENGER_PRETENURE_SAMPLE_INTERVAL))
+					&& ((entry->firstCopyBytes / SCAVENGER_PRETENURE_SAMPLE_SURVIVAL_PERCENT) < (entry->sampledBytes / 100))
+				) {
+					/* most of the sampled instances died before their first scavenge */
+					entry->state = state_rejected;
+					clazz->classFlags &= ~(U_32)J9ClassPretenured;
+					scavengerJavaStats->_pretenuredClassesRemoved += 1;
+				}
+				break;
+			case state_rejected:
+				break;
+			default:
+				Assert_MM_unreachable();
+			}
+
+			if (state_pretenured == entry->state) {
+				scavengerJavaStats->_pretenuredClasses += 1;
+			}
+			entry->residentBytes = entry->firstCopyBytes + entry->survivorCopyBytes;
+		} else if (state_pretenured == entry->state) {
+			scavengerJavaStats->_pretenuredClasses += 1;
+		}
+
+		clearScavengeCounts(entry);
+	}
+}
+
+void
+MM_ScavengerPretenuring::flushAllocationBytes(GC_PretenuredAllocationBytes *cached)
+{
+	if (NULL != cached->clazz) {
+		ClassEntry *entry = findEntry(cached->clazz, false);
+		if (NULL != entry) {
+			if (0 != cached->sampledBytes) {
+				MM_AtomicOperations::add(&entry->sampledBytes, cached->sampledBytes);
+			}
+			if (0 != cached->pretenuredBytes) {
+				MM_AtomicOperations::add(&entry->pretenuredBytes, cached->pretenuredBytes);
+			}
+		}
+		cached->clazz = NULL;
+		cached->sampledBytes = 0;
+		cached->pretenuredBytes = 0;
+	}
+}
+
+void
+MM_ScavengerPretenuring::flushAllocationBytes(GC_Environment *gcEnv)
+{
+	for (UDATA i = 0; i < SCAVENGER_PRETENURE_ALLOCATION_CACHE_SIZE; i++) {
+		flushAllocationBytes(&gcEnv->_pretenuredAllocationBytes[i]);
+	}
+}
+
+void
+MM_ScavengerPretenuring::purgeDyingClasses()
+{
+	/* rebuild the table without the dying classes, so that the probe sequences of the remaining classes stay unbroken */
+	for (UDATA i = 0; i < SCAVENGER_PRETENURE_TABLE_SIZE; i++) {
+		ClassEntry *entry = &_table[i];
+		if ((NULL != entry->clazz) && J9_ARE_ANY_BITS_SET(entry->clazz->classDepthAndFlags, J9AccClassDying)) {
+			entry->clazz = NULL;
+		}
+	}
+	for (UDATA i = 0; i < SCAVENGER_PRETENURE_TABLE_SIZE; i++) {
+		ClassEntry *entry = &_table[i];
+		if (NULL != entry->clazz) {
+			ClassEntry saved = *entry;
+			entry->clazz = NULL;
+			ClassEntry *newEntry = findEntry(saved.clazz, true);
+			if (NULL != newEntry) {
+				*newEntry = saved;
+			} else if (state_pretenured == saved.state) {
+				/* without an entry the allocations could not be sampled */
+				saved.clazz->classFlags &= ~(U_32)J9ClassPretenured;
+			}
+		}
+	}
+}
+
+#endif /* J9VM_GC_MODRON_SCAVENGER */
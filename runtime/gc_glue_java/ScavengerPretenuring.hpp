@@ -0,0 +1,226 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(SCAVENGERPRETENURING_HPP_)
+#define SCAVENGERPRETENURING_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+
+#include "BaseNonVirtual.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
+#include "ScavengerJavaStats.hpp"
+
+#define SCAVENGER_PRETENURE_TABLE_SIZE 2048 /* must be a power of two */
+#define SCAVENGER_PRETENURE_MAX_PROBES 32
+#define SCAVENGER_PRETENURE_SURVIVAL_PERCENT 90 /* bytes in the survivor space which must survive the next scavenge */
+#define SCAVENGER_PRETENURE_STABLE_SCAVENGES 3 /* consecutive scavenges which must meet the survival rate */
+#define SCAVENGER_PRETENURE_SAMPLE_INTERVAL 16 /* one in this many allocations of a pretenured class stays in the nursery */
+#define SCAVENGER_PRETENURE_SAMPLE_SURVIVAL_PERCENT 50 /* sampled bytes which must survive their first scavenge */
+
+extern "C" {
+/**
+ * Hook "J9HOOK_VM_CLASSES_UNLOAD" callback function
+ * Forgets the statistics of classes which are being unloaded
+ */
+void scavengerPretenuringClassesUnloadHook(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+}
+
+/**
+ * Decides which classes are allocated directly in tenure space.
+ *
+ * Each scavenge attributes the bytes it copies to the class of the copied objects. A class whose bytes in the
+ * survivor space almost all survive the following scavenge, several scavenges in a row, is marked J9ClassPretenured:
+ * the allocation slow path then allocates its instances in tenure space, and the inline allocation paths defer to it.
+ * A sample of the allocations stays in the nursery, and the class goes back to nursery allocation for good if the
+ * sampled instances mostly die young. Tenure space has no TLH, so only allocations of at least
+ * -Xgc:scvPretenureMinimumSize= bytes, which amortize the cost of a locked tenure allocation, are pretenured.
+ *
+ * Entries are added by GC threads while a scavenge is in progress and are only ever removed while classes are
+ * being unloaded, so mutators can read the table without locking.
+ */
+class MM_ScavengerPretenuring : public MM_BaseNonVirtual
+{
+private:
+	enum ClassState {
+		state_candidate = 0, /**< instances are allocated in the nursery */
+		state_pretenured, /**< instances are allocated in tenure space, except for a sample */
+		state_rejected /**< sampled instances died young, so instances will always be allocated in the nursery */
+	};
+
+	struct ClassEntry {
+		J9Class * volatile clazz; /**< the class, or NULL if the entry is free */
+		volatile UDATA firstCopyBytes; /**< bytes copied into the survivor space for the first time by this scavenge */
+		volatile UDATA survivorCopyBytes; /**< bytes copied within the survivor space again by this scavenge */
+		volatile UDATA tenuredBytes; /**< bytes copied into tenure space by this scavenge */
+		UDATA residentBytes; /**< bytes left in the survivor space by the previous scavenge */
+		UDATA stableScavenges; /**< consecutive scavenges which met the survival rate */
+		volatile UDATA sampledBytes; /**< bytes of a pretenured class allocated in the nursery since the previous scavenge */
+		volatile UDATA pretenuredBytes; /**< bytes of a pretenured class allocated in tenure space since the previous scavenge */
+		ClassState state;
+	};
+
+	J9JavaVM *_javaVM;
+	MM_GCExtensions *_extensions;
+	ClassEntry *_table;
+
+	MMINLINE static UDATA
+	hashClass(J9Class *clazz)
+	{
+		UDATA key = (UDATA)clazz >> J9_REQUIRED_CLASS_SHIFT;
+		return key ^ (key >> 11);
+	}
+
+	/**
+	 * Find the entry for a class.
+	 * @param add true to claim a free entry if the class has none
+	 * @return the entry, or NULL if the class has none and one could not be added
+	 */
+	ClassEntry *findEntry(J9Class *clazz, bool add);
+
+	/**
+	 * Clear the statistics gathered by the current scavenge.
+	 */
+	void clearScavengeCounts(ClassEntry *entry);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_ScavengerPretenuring *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Attribute an object copied by the current scavenge to its class, in the thread local stats of a GC thread.
+	 * @param stats[in] thread local scavenger stats
+	 * @param clazz[in] class of the copied object
+	 * @param bytes[in] size of the copied object
+	 * @param tenured[in] true if the object was copied into tenure space
+	 * @param age[in] age of the object after it was copied
+	 */
+	MMINLINE void
+	recordCopy(MM_ScavengerJavaStats *stats, J9Class *clazz, UDATA bytes, bool tenured, UDATA age)
+	{
+		MM_ScavengerJavaStats::ClassCopyBytes *cached = &stats->_classCopyBytes[hashClass(clazz) & (SCAVENGER_JAVA_STATS_CLASS_CACHE_SIZE - 1)];
+		if (clazz != cached->clazz) {
+			flushCopyBytes(cached);
+			cached->clazz = clazz;
+		}
+		if (tenured) {
+			cached->tenuredBytes += bytes;
+		} else if (age <= 1) {
+			cached->firstCopyBytes += bytes;
+		} else {
+			cached->survivorCopyBytes += bytes;
+		}
+	}
+
+	/**
+	 * Add the bytes cached for one class by a GC thread to the table, and clear the cached entry.
+	 */
+	void flushCopyBytes(MM_ScavengerJavaStats::ClassCopyBytes *cached);
+
+	/**
+	 * Add all of the bytes cached by a GC thread to the table. Called as each GC thread merges its stats.
+	 */
+	void flushCopyBytes(MM_ScavengerJavaStats *stats);
+
+	/**
+	 * Update the state of every class from the statistics of a completed scavenge, and report the
+	 * allocations which were not copied in the global scavenger stats.
+	 * @param successful[in] false if the scavenge backed out, in which case its statistics are discarded
+	 */
+	void scavengeEnd(MM_EnvironmentBase *env, bool successful);
+
+	/**
+	 * Decide whether an allocation of a class marked J9ClassPretenured is large enough to be pretenured.
+	 * @param bytes[in] size of the instance data
+	 */
+	MMINLINE bool
+	isPretenuredSize(UDATA bytes)
+	{
+		return bytes >= _extensions->scavengerPretenureMinimumSize;
+	}
+
+	/**
+	 * Decide where a pretenured allocation is made. One allocation in SCAVENGER_PRETENURE_SAMPLE_INTERVAL, counted
+	 * per thread, stays in the nursery as a sample.
+	 * @return true if the instance should be allocated in tenure space
+	 */
+	MMINLINE bool
+	shouldAllocateTenured(MM_EnvironmentBase *env)
+	{
+		GC_Environment *gcEnv = env->getGCEnvironment();
+		gcEnv->_pretenuredAllocationCount += 1;
+		return 0 != (gcEnv->_pretenuredAllocationCount % SCAVENGER_PRETENURE_SAMPLE_INTERVAL);
+	}
+
+	/**
+	 * Record a pretenured allocation in the thread local cache of the allocating thread.
+	 * @param tenured[in] the value returned by shouldAllocateTenured() for this allocation
+	 */
+	MMINLINE void
+	recordAllocation(MM_EnvironmentBase *env, J9Class *clazz, UDATA bytes, bool tenured)
+	{
+		GC_PretenuredAllocationBytes *cached = &env->getGCEnvironment()->_pretenuredAllocationBytes[hashClass(clazz) & (SCAVENGER_PRETENURE_ALLOCATION_CACHE_SIZE - 1)];
+		if (clazz != cached->clazz) {
+			flushAllocationBytes(cached);
+			cached->clazz = clazz;
+		}
+		if (tenured) {
+			cached->pretenuredBytes += bytes;
+		} else {
+			cached->sampledBytes += bytes;
+		}
+	}
+
+	/**
+	 * Add the bytes cached for one class by an allocating thread to the table, and clear the cached entry.
+	 */
+	void flushAllocationBytes(GC_PretenuredAllocationBytes *cached);
+
+	/**
+	 * Add all of the bytes cached by an allocating thread to the table. Called as the thread flushes its caches for a GC.
+	 */
+	void flushAllocationBytes(GC_Environment *gcEnv);
+
+	/**
+	 * Remove the entries of classes which are being unloaded. Caller must hold exclusive VM access.
+	 */
+	void purgeDyingClasses();
+
+	MM_ScavengerPretenuring(MM_EnvironmentBase *env)
+		: MM_BaseNonVirtual()
+		, _javaVM((J9JavaVM *)env->getOmrVM()->_language_vm)
+		, _extensions(MM_GCExtensions::getExtensions(env))
+		, _table(NULL)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* J9VM_GC_MODRON_SCAVENGER */
+#endif /* SCAVENGERPRETENURING_HPP_ */
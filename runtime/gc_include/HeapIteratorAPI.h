@@ -262,6 +262,25 @@ j9mm_initialize_object_descriptor(J9JavaVM *javaVM, J9MM_IterateObjectDescriptor
 jvmtiIterationControl
 j9mm_iterate_all_objects(J9JavaVM *vn, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *userData), void *userData);
 
+/**
+ * Walk all objects of the heap using the GC worker threads, call user provided function.
+ * The function is called concurrently from several threads, each passing its own worker ID.
+ * The caller must have exclusive VM access and the heap must be walkable.
+ * @param flags The flags describing the walk (0 or j9mm_iterator_flag_include_holes)
+ * @param func The function to call on each object descriptor.
+ * @param userData Pointer to storage for userData.
+ * @return JVMTI_ITERATION_ABORT if a call to func aborted the walk, JVMTI_ITERATION_CONTINUE otherwise
+ */
+jvmtiIterationControl
+j9mm_iterate_all_objects_parallel(J9VMThread *vmThread, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, UDATA workerID, void *userData), void *userData);
+
+/**
+ * Answer the number of threads which may call back concurrently from
+ * j9mm_iterate_all_objects_parallel. Worker IDs are smaller than this count.
+ */
+UDATA
+j9mm_get_parallel_iteration_thread_count(J9JavaVM *vm);
+
 /**
  * Walk all ownable synchronizer object, call user provided function.
  * @param flags The flags describing the walk (unused currently)
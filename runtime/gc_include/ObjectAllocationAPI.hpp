@@ -43,6 +43,9 @@ private:
 	const UDATA _initializeSlotsOnTLHAllocate;
 #endif /* J9VM_GC_BATCH_CLEAR_TLH */
 	const UDATA _objectAlignmentInBytes;
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+	const UDATA _pretenuredAllocationEnabled;
+#endif /* J9VM_GC_MODRON_SCAVENGER */
 
 #if defined (J9VM_GC_SEGREGATED_HEAP)
 	const J9VMGCSizeClasses *_sizeClasses;
@@ -61,6 +64,13 @@ private:
 	{
 		j9object_t instance = NULL;
 
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+		if ((0 != _pretenuredAllocationEnabled) && J9_ARE_ANY_BITS_SET(arrayClass->classFlags, J9ClassPretenured)) {
+			/* Leave the choice between nursery and tenure space to the out of line allocator */
+			return NULL;
+		}
+#endif /* J9VM_GC_MODRON_SCAVENGER */
+
 #if defined(J9VM_GC_THREAD_LOCAL_HEAP) || defined(J9VM_GC_SEGREGATED_HEAP)
 		if (0 != size) {
 			/* Contiguous Array */
@@ -253,6 +263,9 @@ public:
 		, _initializeSlotsOnTLHAllocate(currentThread->javaVM->initializeSlotsOnTLHAllocate)
 #endif /* J9VM_GC_BATCH_CLEAR_TLH */
 		, _objectAlignmentInBytes(currentThread->omrVMThread->_vm->_objectAlignmentInBytes)
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+		, _pretenuredAllocationEnabled(currentThread->javaVM->pretenuredAllocationEnabled)
+#endif /* J9VM_GC_MODRON_SCAVENGER */
 #if defined (J9VM_GC_SEGREGATED_HEAP)
 		, _sizeClasses(currentThread->javaVM->realtimeSizeClasses)
 #endif /* J9VM_GC_SEGREGATED_HEAP */
@@ -262,6 +275,12 @@ public:
 	inlineAllocateObject(J9VMThread *currentThread, J9Class *clazz, bool initializeSlots = true, bool memoryBarrier = true)
 	{
 		j9object_t instance = NULL;
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+		if ((0 != _pretenuredAllocationEnabled) && J9_ARE_ANY_BITS_SET(clazz->classFlags, J9ClassPretenured)) {
+			/* Leave the choice between nursery and tenure space to the out of line allocator */
+			return NULL;
+		}
+#endif /* J9VM_GC_MODRON_SCAVENGER */
 #if defined(J9VM_GC_THREAD_LOCAL_HEAP) || defined(J9VM_GC_SEGREGATED_HEAP)
 		/* Calculate the size of the object */
 		UDATA const headerSize = J9VMTHREAD_OBJECT_HEADER_SIZE(currentThread);
@@ -50,6 +50,9 @@
 #include "ObjectAllocationInterface.hpp"
 #include "ObjectModel.hpp"
 #include "ObjectMonitor.hpp"
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+#include "ScavengerPretenuring.hpp"
+#endif /* J9VM_GC_MODRON_SCAVENGER */
 #if defined (J9VM_GC_REALTIME)
 #include "Scheduler.hpp"
 #endif /* J9VM_GC_REALTIME */
@@ -96,6 +99,13 @@ J9AllocateObjectNoGC(J9VMThread *vmThread, J9Class *clazz, uintptr_t allocateFla
 	}
 #endif /* J9VM_GC_THREAD_LOCAL_HEAP */
 
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+	if (J9_ARE_ANY_BITS_SET(clazz->classFlags, J9ClassPretenured)) {
+		/* The allocation may belong in tenure space, which is not a NoGC allocation */
+		return NULL;
+	}
+#endif /* J9VM_GC_MODRON_SCAVENGER */
+
 	Assert_MM_true(allocateFlags & OMR_GC_ALLOCATE_OBJECT_INSTRUMENTABLE);
 	// TODO: respect or reject tenured flag?
 	Assert_MM_false(allocateFlags & OMR_GC_ALLOCATE_OBJECT_TENURED);
@@ -309,6 +319,13 @@ J9AllocateIndexableObjectNoGC(J9VMThread *vmThread, J9Class *clazz, uint32_t num
 	}
 #endif /* J9VM_GC_THREAD_LOCAL_HEAP */
 
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+	if (J9_ARE_ANY_BITS_SET(clazz->classFlags, J9ClassPretenured)) {
+		/* The allocation may belong in tenure space, which is not a NoGC allocation */
+		return NULL;
+	}
+#endif /* J9VM_GC_MODRON_SCAVENGER */
+
 	Assert_MM_true(allocateFlags & OMR_GC_ALLOCATE_OBJECT_INSTRUMENTABLE);
 	// TODO: respect or reject tenured flag?
 	Assert_MM_false(allocateFlags & OMR_GC_ALLOCATE_OBJECT_TENURED);
@@ -376,6 +393,19 @@ J9AllocateObject(J9VMThread *vmThread, J9Class *clazz, uintptr_t allocateFlags)
 	 * with a replaced class, update to the current version and allocate that.
 	 */
 	clazz = J9_CURRENT_CLASS(clazz);
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+	/* Classes whose instances are repeatedly copied by the scavenger are allocated in tenure space, except for a sample */
+	MM_ScavengerPretenuring *pretenuring = MM_GCExtensions::getExtensions(env)->scavengerPretenuring;
+	bool pretenured = J9_ARE_ANY_BITS_SET(clazz->classFlags, J9ClassPretenured)
+		&& (NULL != pretenuring) && pretenuring->isPretenuredSize(clazz->totalInstanceSize);
+	bool allocateTenured = false;
+	if (pretenured) {
+		allocateTenured = pretenuring->shouldAllocateTenured(env);
+		if (allocateTenured) {
+			allocateFlags |= OMR_GC_ALLOCATE_OBJECT_TENURED;
+		}
+	}
+#endif /* J9VM_GC_MODRON_SCAVENGER */
 	MM_MixedObjectAllocationModel mixedOAM(env, clazz, allocateFlags);
 	if (mixedOAM.initializeAllocateDescription(env)) {
 		objectPtr = OMR_GC_AllocateObject(vmThread->omrVMThread, &mixedOAM);
@@ -458,6 +488,11 @@ J9AllocateObject(J9VMThread *vmThread, J9Class *clazz, uintptr_t allocateFlags)
 		TRIGGER_J9HOOK_MM_PRIVATE_OUT_OF_MEMORY(extensions->privateHookInterface, vmThread->omrVMThread, j9time_hires_clock(), J9HOOK_MM_PRIVATE_OUT_OF_MEMORY, memorySpace, memorySpace->getName());
 	} else {
 		objectPtr = traceAllocateObject(vmThread, objectPtr, clazz, sizeInBytesRequired);
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+		if (pretenured) {
+			pretenuring->recordAllocation(env, clazz, sizeInBytesRequired, allocateTenured);
+		}
+#endif /* J9VM_GC_MODRON_SCAVENGER */
 		if (extensions->isStandardGC()) {
 			if (OMR_GC_ALLOCATE_OBJECT_TENURED == (allocateFlags & OMR_GC_ALLOCATE_OBJECT_TENURED)) {
 				/* Object must be allocated in Tenure if it is requested */
@@ -517,6 +552,19 @@ J9AllocateIndexableObject(J9VMThread *vmThread, J9Class *clazz, uint32_t numberO
 
 	J9Object *objectPtr = NULL;
 	uintptr_t sizeInBytesRequired = 0;
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+	/* Classes whose instances are repeatedly copied by the scavenger are allocated in tenure space, except for a sample */
+	MM_ScavengerPretenuring *pretenuring = extensions->scavengerPretenuring;
+	bool pretenured = J9_ARE_ANY_BITS_SET(clazz->classFlags, J9ClassPretenured)
+		&& (NULL != pretenuring) && pretenuring->isPretenuredSize((UDATA)numberOfIndexedFields * J9ARRAYCLASS_GET_STRIDE(clazz));
+	bool allocateTenured = false;
+	if (pretenured) {
+		allocateTenured = pretenuring->shouldAllocateTenured(env);
+		if (allocateTenured) {
+			allocateFlags |= OMR_GC_ALLOCATE_OBJECT_TENURED;
+		}
+	}
+#endif /* J9VM_GC_MODRON_SCAVENGER */
 	MM_IndexableObjectAllocationModel indexableOAM(env, clazz, numberOfIndexedFields, allocateFlags);
 	if (indexableOAM.initializeAllocateDescription(env)) {
 		objectPtr = OMR_GC_AllocateObject(vmThread->omrVMThread, &indexableOAM);
@@ -585,6 +633,11 @@ J9AllocateIndexableObject(J9VMThread *vmThread, J9Class *clazz, uint32_t numberO
 		}
 		
 		objectPtr = traceAllocateObject(vmThread, objectPtr, clazz, sizeInBytesRequired, (uintptr_t)numberOfIndexedFields);
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+		if (pretenured) {
+			pretenuring->recordAllocation(env, clazz, sizeInBytesRequired, allocateTenured);
+		}
+#endif /* J9VM_GC_MODRON_SCAVENGER */
 		if (extensions->isStandardGC()) {
 			if (OMR_GC_ALLOCATE_OBJECT_TENURED == (allocateFlags & OMR_GC_ALLOCATE_OBJECT_TENURED)) {
 				/* Object must be allocated in Tenure if it is requested */
@@ -77,6 +77,9 @@
 #if defined(J9VM_GC_FINALIZATION)
 #include "FinalizeListManager.hpp"
 #endif /* J9VM_GC_FINALIZATION */
+#if defined(J9VM_GC_VLHGC)
+#include "FreeRegionZeroer.hpp"
+#endif /* J9VM_GC_VLHGC */
 #include "GCExtensions.hpp"
 #include "GlobalAllocationManager.hpp"
 #include "GlobalCollector.hpp"
@@ -102,6 +105,7 @@
 #include "RememberedSetSATB.hpp"
 #endif /* J9VM_GC_REALTIME */
 #include "Scavenger.hpp"
+#include "StringDeduplicator.hpp"
 #include "StringTable.hpp"
 #include "Validator.hpp"
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
@@ -493,6 +497,30 @@ j9gc_initialize_heap(J9JavaVM *vm, IDATA *memoryParameterTable, UDATA heapBytesR
 	}
 #endif
 
+	if (extensions->stringDeduplication) {
+		/* Only the scavenger and copy-forward find candidates */
+		bool findsCandidates = extensions->isVLHGC();
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+		/* the concurrent scavenger copies objects while the deduplication thread runs */
+		findsCandidates = findsCandidates || (extensions->scavengerEnabled && !extensions->isConcurrentScavengerEnabled());
+#endif /* J9VM_GC_MODRON_SCAVENGER */
+		if (findsCandidates) {
+			extensions->stringDeduplicator = MM_StringDeduplicator::newInstance(&env);
+			if (NULL == extensions->stringDeduplicator) {
+				goto error_no_memory;
+			}
+		}
+	}
+
+#if defined(J9VM_GC_VLHGC)
+	if (extensions->tarokEnableFreeRegionZeroing && extensions->isVLHGC()) {
+		extensions->freeRegionZeroer = MM_FreeRegionZeroer::newInstance(&env);
+		if (NULL == extensions->freeRegionZeroer) {
+			goto error_no_memory;
+		}
+	}
+#endif /* J9VM_GC_VLHGC */
+
 	return JNI_OK;
 
 error_no_memory:
@@ -586,6 +614,27 @@ gcStartupHeapManagement(J9JavaVM *javaVM)
 		result = JNI_ENOMEM;
 	}
 
+	if ((JNI_OK == result) && (NULL != extensions->stringDeduplicator)) {
+		MM_EnvironmentBase env(javaVM->omrVM);
+		if (!extensions->stringDeduplicator->startThread(&env)) {
+			extensions->dispatcher->shutDownThreads();
+			result = JNI_ENOMEM;
+		}
+	}
+
+#if defined(J9VM_GC_VLHGC)
+	if ((JNI_OK == result) && (NULL != extensions->freeRegionZeroer)) {
+		MM_EnvironmentBase env(javaVM->omrVM);
+		if (!extensions->freeRegionZeroer->startThread(&env)) {
+			if (NULL != extensions->stringDeduplicator) {
+				extensions->stringDeduplicator->stopThread(&env);
+			}
+			extensions->dispatcher->shutDownThreads();
+			result = JNI_ENOMEM;
+		}
+	}
+#endif /* J9VM_GC_VLHGC */
+
 	if (JNI_OK != result) {
 		PORT_ACCESS_FROM_JAVAVM(javaVM);
 		extensions->getGlobalCollector()->collectorShutdown(extensions);
@@ -709,6 +758,18 @@ gcShutdownHeapManagement(J9JavaVM *javaVM)
 	j9gc_finalizer_shutdown(javaVM);
 #endif /* J9VM_GC_FINALIZATION */
 
+	if (NULL != extensions->stringDeduplicator) {
+		MM_EnvironmentBase env(javaVM->omrVM);
+		extensions->stringDeduplicator->stopThread(&env);
+	}
+
+#if defined(J9VM_GC_VLHGC)
+	if (NULL != extensions->freeRegionZeroer) {
+		MM_EnvironmentBase env(javaVM->omrVM);
+		extensions->freeRegionZeroer->stopThread(&env);
+	}
+#endif /* J9VM_GC_VLHGC */
+
 	/* Kickoff shutdown of global collector */
 	if (NULL != globalCollector) {
 		globalCollector->collectorShutdown(extensions);
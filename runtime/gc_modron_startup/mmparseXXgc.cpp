@@ -639,6 +639,65 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			continue;
 		}
 
+		if (try_scan(&scan_start, "tarokEnableFreeRegionZeroing")) {
+			extensions->tarokEnableFreeRegionZeroing = true;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "tarokDisableFreeRegionZeroing")) {
+			extensions->tarokEnableFreeRegionZeroing = false;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "tarokZeroedFreeRegionTarget=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->tarokZeroedFreeRegionTarget, "tarokZeroedFreeRegionTarget=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(0 == extensions->tarokZeroedFreeRegionTarget) {
+				j9nls_printf(PORTLIB,J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "-XXgc:tarokZeroedFreeRegionTarget", (UDATA)0);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "tarokEnableNumaOwnerPlacement")) {
+			extensions->tarokEnableNumaOwnerPlacement = true;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "tarokDisableNumaOwnerPlacement")) {
+			extensions->tarokEnableNumaOwnerPlacement = false;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "tarokNumaPlacementInterval=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->tarokNumaPlacementInterval, "tarokNumaPlacementInterval=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(0 == extensions->tarokNumaPlacementInterval) {
+				j9nls_printf(PORTLIB,J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "-XXgc:tarokNumaPlacementInterval", (UDATA)0);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "tarokNumaPlacementMigrationPercent=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->tarokNumaPlacementMigrationPercent, "tarokNumaPlacementMigrationPercent=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if((extensions->tarokNumaPlacementMigrationPercent < 1) || (extensions->tarokNumaPlacementMigrationPercent > 100)) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "-XXgc:tarokNumaPlacementMigrationPercent=", (UDATA)1, (UDATA)100);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
 #endif /* defined (J9VM_GC_VLHGC) */
 
 		if(try_scan(&scan_start, "packetListLockSplit=")) {
@@ -950,6 +1009,18 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			extensions->verboseNewFormat = false;
 			continue;
 		}
+		if (try_scan(&scan_start, "verboseBinary")) {
+			extensions->verboseBinary = true;
+			continue;
+		}
+		if (try_scan(&scan_start, "noVerboseBinary")) {
+			extensions->verboseBinary = false;
+			continue;
+		}
+		if (try_scan(&scan_start, "fvtest_verboseBinaryTextCopy")) {
+			extensions->fvtest_verboseBinaryTextCopy = true;
+			continue;
+		}
 
 		if (try_scan(&scan_start, "heapSizeStartupHintConservativeFactor=")) {
 			UDATA percentage = 0;
@@ -1009,6 +1080,38 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 		}
 #endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+		if (try_scan(&scan_start, "gcOnIdleGradual")) {
+			extensions->gcOnIdleGradual = true;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "noGcOnIdleGradual")) {
+			extensions->gcOnIdleGradual = false;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "gcOnIdleReleaseStepSize=")) {
+			if(!scan_udata_memory_size_helper(vm, &scan_start, &(extensions->gcOnIdleReleaseStepSize), "gcOnIdleReleaseStepSize=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(0 == extensions->gcOnIdleReleaseStepSize) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "gcOnIdleReleaseInterval=")) {
+			if(!scan_udata_helper(vm, &scan_start, &(extensions->gcOnIdleReleaseInterval), "gcOnIdleReleaseInterval=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
+
 #if defined (J9VM_GC_VLHGC)
 		if (try_scan(&scan_start, "fvtest_tarokSimulateNUMA=")) {
 			UDATA simulatedNodeCount = 0;
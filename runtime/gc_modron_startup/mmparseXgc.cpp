@@ -346,6 +346,30 @@ j9gc_initialize_parse_gc_colon(J9JavaVM *javaVM, char **scan_start)
 		goto _exit;
 	}
 	
+	if(try_scan(scan_start, "scvPretenureThreshold=")) {
+		if(!scan_udata_memory_size_helper(javaVM, scan_start, &extensions->scavengerPretenureThreshold, "scvPretenureThreshold=")) {
+			goto _error;
+		}
+		goto _exit;
+	}
+
+	if(try_scan(scan_start, "scvPretenureMinimumSize=")) {
+		if(!scan_udata_memory_size_helper(javaVM, scan_start, &extensions->scavengerPretenureMinimumSize, "scvPretenureMinimumSize=")) {
+			goto _error;
+		}
+		goto _exit;
+	}
+
+	if(try_scan(scan_start, "scvPretenure")) {
+		extensions->scavengerPretenure = true;
+		goto _exit;
+	}
+
+	if(try_scan(scan_start, "noScvPretenure")) {
+		extensions->scavengerPretenure = false;
+		goto _exit;
+	}
+
 	if (try_scan(scan_start, "scvTenureStrategy=")) {
 		/* Reset all tenure strategies because we will be setting them explicitly now. */
 		extensions->scvTenureStrategyFixed = false;
@@ -991,6 +1015,27 @@ j9gc_initialize_parse_gc_colon(J9JavaVM *javaVM, char **scan_start)
 	}
 #endif /* J9VM_GC_CONCURRENT_SWEEP */
 
+	if(try_scan(scan_start, "stringDeduplicationAge=")) {
+		if(!scan_udata_helper(javaVM, scan_start, &extensions->stringDeduplicationAge, "stringDeduplicationAge=")) {
+			goto _error;
+		}
+		if(0 == extensions->stringDeduplicationAge) {
+			j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "stringDeduplicationAge=", (UDATA)0);
+			goto _error;
+		}
+		goto _exit;
+	}
+
+	if(try_scan(scan_start, "stringDeduplication")) {
+		extensions->stringDeduplication = true;
+		goto _exit;
+	}
+
+	if(try_scan(scan_start, "noStringDeduplication")) {
+		extensions->stringDeduplication = false;
+		goto _exit;
+	}
+
 	/* Additional -Xgc:fvtest options */
 	if(try_scan(scan_start, "fvtest=")) {
 #if defined(J9VM_GC_MODRON_SCAVENGER) || defined(J9VM_GC_VLHGC)
@@ -32,7 +32,12 @@ MM_ScavengerJavaStats::MM_ScavengerJavaStats() :
 	,_weakReferenceStats()
 	,_softReferenceStats()
 	,_phantomReferenceStats()
+	,_pretenuredClasses(0)
+	,_pretenuredClassesAdded(0)
+	,_pretenuredClassesRemoved(0)
+	,_pretenuredBytes(0)
 {
+	clearClassCopyBytes();
 }
 
 void 
@@ -48,8 +53,25 @@ MM_ScavengerJavaStats::clear()
 	_weakReferenceStats.clear();
 	_softReferenceStats.clear();
 	_phantomReferenceStats.clear();
+
+	clearClassCopyBytes();
+	_pretenuredClasses = 0;
+	_pretenuredClassesAdded = 0;
+	_pretenuredClassesRemoved = 0;
+	_pretenuredBytes = 0;
 };
 
+void
+MM_ScavengerJavaStats::clearClassCopyBytes()
+{
+	for (UDATA i = 0; i < SCAVENGER_JAVA_STATS_CLASS_CACHE_SIZE; i++) {
+		_classCopyBytes[i].clazz = NULL;
+		_classCopyBytes[i].firstCopyBytes = 0;
+		_classCopyBytes[i].survivorCopyBytes = 0;
+		_classCopyBytes[i].tenuredBytes = 0;
+	}
+}
+
 
 void
 MM_ScavengerJavaStats::clearOwnableSynchronizerCounts()
@@ -39,6 +39,8 @@
 #include "Base.hpp"
 #include "ReferenceStats.hpp"
 
+#define SCAVENGER_JAVA_STATS_CLASS_CACHE_SIZE 32 /* must be a power of two */
+
 /**
  * Storage for statistics relevant to a scavenging (semi-space copying) collector.
  * @ingroup GC_Stats
@@ -46,6 +48,15 @@
 class MM_ScavengerJavaStats
 {
 public:
+	/**
+	 * Bytes copied by a GC thread for one class, before they are added to the pretenuring statistics.
+	 */
+	struct ClassCopyBytes {
+		J9Class *clazz; /**< the class, or NULL if the entry is free */
+		UDATA firstCopyBytes; /**< bytes copied into the survivor space for the first time */
+		UDATA survivorCopyBytes; /**< bytes copied within the survivor space again */
+		UDATA tenuredBytes; /**< bytes copied into tenure space */
+	};
 
 	UDATA _unfinalizedCandidates;  /**< unfinalized objects that are candidates to be finalized visited this cycle */
 	UDATA _unfinalizedEnqueued;  /**< unfinalized objects that are enqueued during this cycle (MUST be less than or equal _unfinalizedCandidates) */
@@ -58,6 +69,12 @@ public:
 	MM_ReferenceStats _softReferenceStats;  /**< Soft reference stats for the cycle */
 	MM_ReferenceStats _phantomReferenceStats;  /**< Phantom reference stats for the cycle */
 
+	ClassCopyBytes _classCopyBytes[SCAVENGER_JAVA_STATS_CLASS_CACHE_SIZE]; /**< bytes copied for recently seen classes (thread local stats only) */
+	UDATA _pretenuredClasses; /**< number of classes allocated in tenure space after this cycle */
+	UDATA _pretenuredClassesAdded; /**< number of classes which this cycle moved to tenure space allocation */
+	UDATA _pretenuredClassesRemoved; /**< number of classes which this cycle moved back to nursery allocation */
+	UDATA _pretenuredBytes; /**< bytes allocated in tenure space since the previous cycle, which this cycle did not have to copy */
+
 protected:
 
 private:
@@ -65,6 +82,8 @@ private:
 public:
 
 	void clear();
+	/* clear only the bytes copied for recently seen classes */
+	void clearClassCopyBytes();
 	/* clear only OwnableSynchronizerObject related data */
 	void clearOwnableSynchronizerCounts();
 	/* merge only OwnableSynchronizerObject related data */
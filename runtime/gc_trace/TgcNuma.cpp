@@ -28,8 +28,10 @@
 #include "mmhook.h"
 
 #if defined(J9VM_GC_VLHGC)
+#include "AllocationContextTarok.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensions.hpp"
+#include "GlobalAllocationManagerTarok.hpp"
 #include "Heap.hpp"
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionDescriptor.hpp"
@@ -117,6 +119,31 @@ tgcHookReportNumaStatistics(J9HookInterface** hook, UDATA eventNum, void* eventD
 	}
 }
 
+/**
+ * Report how the objects copied by a copy-forward were reached across NUMA nodes
+ */
+static void
+tgcHookReportNumaCopyForwardTraffic(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	MM_CopyForwardEndEvent* event = (MM_CopyForwardEndEvent*)eventData;
+	J9VMThread* vmThread = (J9VMThread*)event->currentThread->_language_vmthread;
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vmThread->javaVM);
+	MM_TgcExtensions *tgcExtensions = MM_TgcExtensions::getExtensions(extensions);
+	MM_GlobalAllocationManagerTarok *allocationManager = (MM_GlobalAllocationManagerTarok *)extensions->globalAllocationManager;
+
+	UDATA contextCount = allocationManager->getManagedAllocationContextCount();
+	if (1 < contextCount) {
+		for (UDATA i = 0; i < contextCount; i++) {
+			MM_AllocationContextTarok *context = allocationManager->getAllocationContextByIndex(i);
+			tgcExtensions->printf(
+					"NUMA node %zu copy-forward reached %zu bytes from the same node, %zu bytes from other nodes (copying to node %zu)\n",
+					context->getNumaNode(),
+					context->getCopyForwardLocalBytes(),
+					context->getCopyForwardRemoteBytes(),
+					context->getCopyForwardDestination()->getNumaNode());
+		}
+	}
+}
 
 /**
  * Initialize NUMA tgc tracing.
@@ -137,6 +164,11 @@ tgcNumaInitialize(J9JavaVM *javaVM)
 	(*hooks)->J9HookRegisterWithCallSite(hooks, J9HOOK_MM_OMR_LOCAL_GC_START, tgcHookReportNumaStatistics, OMR_GET_CALLSITE(), NULL);
 	(*hooks)->J9HookRegisterWithCallSite(hooks, J9HOOK_MM_OMR_LOCAL_GC_END, tgcHookReportNumaStatistics, OMR_GET_CALLSITE(), NULL);
 
+	/* copy-forward only counts the traffic it reports when asked to */
+	extensions->tarokRecordNumaTraffic = true;
+	J9HookInterface** privateHooks = J9_HOOK_INTERFACE(extensions->privateHookInterface);
+	(*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_COPY_FORWARD_END, tgcHookReportNumaCopyForwardTraffic, OMR_GET_CALLSITE(), NULL);
+
 	return result;
 }
 
@@ -41,6 +41,9 @@
 static void verboseHandlerClassUnloadingEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 static void verboseHandlerSlowExclusive(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+static void verboseHandlerIdleHeapReleaseStep(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 
 MM_VerboseHandlerOutput *
 MM_VerboseHandlerOutputStandardJava::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
@@ -90,6 +93,9 @@ MM_VerboseHandlerOutputStandardJava::enableVerbose()
 	(*_mmHooks)->J9HookRegisterWithCallSite(_mmHooks, J9HOOK_MM_CLASS_UNLOADING_END, verboseHandlerClassUnloadingEnd, OMR_GET_CALLSITE(), (void *)this);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 	(*_vmHooks)->J9HookRegisterWithCallSite(_vmHooks, J9HOOK_VM_SLOW_EXCLUSIVE, verboseHandlerSlowExclusive, OMR_GET_CALLSITE(), (void *)this);
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	(*_mmHooks)->J9HookRegisterWithCallSite(_mmHooks, J9HOOK_MM_IDLE_HEAP_RELEASE_STEP, verboseHandlerIdleHeapReleaseStep, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 
 }
 
@@ -102,6 +108,9 @@ MM_VerboseHandlerOutputStandardJava::disableVerbose()
 	(*_mmHooks)->J9HookUnregister(_mmHooks, J9HOOK_MM_CLASS_UNLOADING_END, verboseHandlerClassUnloadingEnd, NULL);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 	(*_vmHooks)->J9HookUnregister(_vmHooks, J9HOOK_VM_SLOW_EXCLUSIVE, verboseHandlerSlowExclusive, NULL);
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	(*_mmHooks)->J9HookUnregister(_mmHooks, J9HOOK_MM_IDLE_HEAP_RELEASE_STEP, verboseHandlerIdleHeapReleaseStep, NULL);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 
 }
 
@@ -188,6 +197,31 @@ MM_VerboseHandlerOutputStandardJava::handleSlowExclusive(J9HookInterface **hook,
 
 }
 
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+void
+MM_VerboseHandlerOutputStandardJava::handleIdleHeapReleaseStep(J9HookInterface **hook, UDATA eventNum, void *eventData)
+{
+	MM_IdleHeapReleaseStepEvent *event = (MM_IdleHeapReleaseStepEvent *) eventData;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread->omrVMThread);
+	MM_VerboseManager *manager = getManager();
+	MM_VerboseWriterChain *writer = manager->getWriterChain();
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+	U_64 duration = j9time_hires_delta(0, event->duration, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+	UDATA unreleasablePercent = 0;
+
+	if (0 != event->freeBytes) {
+		unreleasablePercent = (UDATA)(((U_64)(event->freeBytes - event->releasableBytes) * 100) / event->freeBytes);
+	}
+
+	enterAtomicReportingBlock();
+	writer->formatAndOutput(env, 0, "<idle-heap-release step=\"%zu\" releasedbytes=\"%zu\" totalreleasedbytes=\"%zu\" freebytes=\"%zu\" unreleasable=\"%zu%%\" timems=\"%llu.%03.3llu\" complete=\"%s\" />",
+			event->step, event->releasedBytes, event->totalReleasedBytes, event->freeBytes, unreleasablePercent,
+			duration / 1000, duration % 1000, (0 != event->complete) ? "true" : "false");
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
+
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 void
 MM_VerboseHandlerOutputStandardJava::handleClassUnloadEnd(J9HookInterface** hook, UDATA eventNum, void* eventData)
@@ -227,6 +261,13 @@ MM_VerboseHandlerOutputStandardJava::handleClassUnloadEnd(J9HookInterface** hook
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 
 #if defined(J9VM_GC_MODRON_SCAVENGER)
+void
+MM_VerboseHandlerOutputStandardJava::outputPretenuredInfo(MM_EnvironmentBase *env, UDATA indent, MM_ScavengerJavaStats *scavengerJavaStats)
+{
+	_manager->getWriterChain()->formatAndOutput(env, indent, "<pretenured classes=\"%zu\" added=\"%zu\" removed=\"%zu\" bytesNotCopied=\"%zu\" />",
+		scavengerJavaStats->_pretenuredClasses, scavengerJavaStats->_pretenuredClassesAdded, scavengerJavaStats->_pretenuredClassesRemoved, scavengerJavaStats->_pretenuredBytes);
+}
+
 void
 MM_VerboseHandlerOutputStandardJava::handleScavengeEndInternal(MM_EnvironmentBase* env, void *eventData)
 {
@@ -243,6 +284,11 @@ MM_VerboseHandlerOutputStandardJava::handleScavengeEndInternal(MM_EnvironmentBas
 		outputReferenceInfo(env, 1, "soft", &scavengerJavaStats->_softReferenceStats, extensions->getDynamicMaxSoftReferenceAge(), extensions->getMaxSoftReferenceAge());
 		outputReferenceInfo(env, 1, "weak", &scavengerJavaStats->_weakReferenceStats, 0, 0);
 		outputReferenceInfo(env, 1, "phantom", &scavengerJavaStats->_phantomReferenceStats, 0, 0);
+
+		if (NULL != extensions->scavengerPretenuring) {
+			outputPretenuredInfo(env, 1, scavengerJavaStats);
+		}
+		MM_VerboseHandlerJava::outputStringDeduplicationInfo(_manager, env, 1);
 	}
 }
 #endif /*defined(J9VM_GC_MODRON_SCAVENGER) */
@@ -326,3 +372,11 @@ verboseHandlerSlowExclusive(J9HookInterface **hook, UDATA eventNum, void *eventD
 {
 	((MM_VerboseHandlerOutputStandardJava *)userData)->handleSlowExclusive(hook, eventNum, eventData);
 }
+
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+void
+verboseHandlerIdleHeapReleaseStep(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	((MM_VerboseHandlerOutputStandardJava *)userData)->handleIdleHeapReleaseStep(hook, eventNum, eventData);
+}
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
@@ -28,6 +28,8 @@
 
 #include "VerboseHandlerOutputStandard.hpp"
 
+class MM_ScavengerJavaStats;
+
 class MM_VerboseHandlerOutputStandardJava : public MM_VerboseHandlerOutputStandard
 {
 private:
@@ -66,6 +68,16 @@ private:
 	 */
 	void outputReferenceInfo(MM_EnvironmentBase *env, UDATA indent, const char *referenceType, MM_ReferenceStats *referenceStats, UDATA dynamicThreshold, UDATA maxThreshold);
 
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+	/**
+	 * Output pretenuring summary.
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 * @param scavengerJavaStats stats of the scavenge which just completed.
+	 */
+	void outputPretenuredInfo(MM_EnvironmentBase *env, UDATA indent, MM_ScavengerJavaStats *scavengerJavaStats);
+#endif /* defined(J9VM_GC_MODRON_SCAVENGER) */
+
 protected:
 
 	virtual bool initialize(MM_EnvironmentBase *env, MM_VerboseManager *manager);
@@ -116,6 +128,16 @@ public:
 	 * @param eventData hook specific event data.
 	 */
 	void handleSlowExclusive(J9HookInterface **hook, UDATA eventNum, void *eventData);
+
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	/**
+	 * Write verbose stanza for an increment of the gradual idle heap release.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleIdleHeapReleaseStep(J9HookInterface **hook, UDATA eventNum, void *eventData);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 };
 
 #endif /* VERBOSEHANDLEROUTPUTSTANDARDJAVA_HPP_ */
@@ -332,6 +332,16 @@ MM_VerboseHandlerOutputVLHGC::outputMemoryInfoInnerStanza(MM_EnvironmentBase *en
 				stats->_arrayletUnknownObjects, stats->_arrayletUnknownLeaves);
 	}
 
+#if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+	if (extensions->indexableObjectModel.isDoubleMappingEnabled()) {
+		UDATA mapTime = extensions->arrayletDoubleMapTime;
+		writer->formatAndOutput(env, indent, "<arraylet-doublemap mapped=\"%zu\" failed=\"%zu\" bytes=\"%zu\" timems=\"%zu.%03zu\" />",
+				extensions->arrayletDoubleMapCount, extensions->arrayletDoubleMapFailedCount, extensions->arrayletDoubleMapBytes,
+				mapTime / 1000, mapTime % 1000);
+	}
+#endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+
 	if (0 != stats->_numaNodes) {
 		UDATA total = stats->_commonNumaNodeBytes + stats->_localNumaNodeBytes + stats->_nonLocalNumaNodeBytes;
 		UDATA nonLocalPercent = 0;
@@ -360,6 +370,14 @@ MM_VerboseHandlerOutputVLHGC::outputRememberedSetClearedInfo(MM_EnvironmentBase
 			irrsStats->_clearFromRegionReferencesTimesus / 1000, irrsStats->_clearFromRegionReferencesTimesus % 1000);
 }
 
+void
+MM_VerboseHandlerOutputVLHGC::outputDoubleMappedArrayletInfo(MM_EnvironmentBase *env, UDATA indent, UDATA candidates, UDATA cleared)
+{
+	if (0 != candidates) {
+		_manager->getWriterChain()->formatAndOutput(env, indent, "<arraylet-doublemap-cleared candidates=\"%zu\" cleared=\"%zu\" />", candidates, cleared);
+	}
+}
+
 void
 MM_VerboseHandlerOutputVLHGC::handleCopyForwardStart(J9HookInterface** hook, UDATA eventNum, void* eventData)
 {
@@ -418,6 +436,10 @@ MM_VerboseHandlerOutputVLHGC::handleCopyForwardEnd(J9HookInterface** hook, UDATA
 	outputReferenceInfo(env, 1, "phantom", &copyForwardStats->_phantomReferenceStats, 0, 0);
 
 	outputStringConstantInfo(env, 1, copyForwardStats->_stringConstantsCandidates, copyForwardStats->_stringConstantsCleared);
+#if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
+	outputDoubleMappedArrayletInfo(env, 1, copyForwardStats->_doubleMappedArrayletsCandidates, copyForwardStats->_doubleMappedArrayletsCleared);
+#endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+	MM_VerboseHandlerJava::outputStringDeduplicationInfo(_manager, env, 1);
 
 	if(0 != copyForwardStats->_heapExpandedCount) {
 		U_64 expansionMicros = j9time_hires_delta(0, copyForwardStats->_heapExpandedTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
@@ -574,6 +596,9 @@ MM_VerboseHandlerOutputVLHGC::outputMarkSummary(MM_EnvironmentBase *env, const c
 	outputReferenceInfo(env, 1, "phantom", &markStats->_phantomReferenceStats, 0, 0);
 
 	outputStringConstantInfo(env, 1, markStats->_stringConstantsCandidates, markStats->_stringConstantsCleared);
+#if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
+	outputDoubleMappedArrayletInfo(env, 1, markStats->_doubleMappedArrayletsCandidates, markStats->_doubleMappedArrayletsCleared);
+#endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
 
 	switch (env->_cycleState->_reasonForMarkCompactPGC) {
 	case MM_CycleState::reason_not_exceptional:
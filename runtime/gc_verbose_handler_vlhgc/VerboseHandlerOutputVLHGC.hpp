@@ -91,6 +91,15 @@ private:
 	 */
 	void outputRememberedSetClearedInfo(MM_EnvironmentBase *env, MM_InterRegionRememberedSetStats *irrsStats);
 
+	/**
+	 * Output info on the contiguous views of arraylets which were visited and released by a collection
+	 * @param env GC thread performing output.
+	 * @param indent Indentation level of the stanza.
+	 * @param candidates Number of double mapped arraylets visited.
+	 * @param cleared Number of double mapped arraylets whose contiguous view was released.
+	 */
+	void outputDoubleMappedArrayletInfo(MM_EnvironmentBase *env, UDATA indent, UDATA candidates, UDATA cleared);
+
 
 protected:
 	virtual void handleInitializedInnerStanzas(J9HookInterface** hook, UDATA eventNum, void* eventData);
@@ -33,6 +33,7 @@
 #include "VerboseWriterChain.hpp"
 #include "GCExtensions.hpp"
 #include "FinalizeListManager.hpp"
+#include "StringDeduplicator.hpp"
 
 void
 MM_VerboseHandlerJava::outputFinalizableInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent)
@@ -50,6 +51,18 @@ MM_VerboseHandlerJava::outputFinalizableInfo(MM_VerboseManager *manager, MM_Envi
 	}
 }
 
+void
+MM_VerboseHandlerJava::outputStringDeduplicationInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent)
+{
+	MM_StringDeduplicator *stringDeduplicator = MM_GCExtensions::getExtensions(env)->stringDeduplicator;
+
+	if (NULL != stringDeduplicator) {
+		MM_StringDeduplicator::Stats *stats = stringDeduplicator->getStats();
+		manager->getWriterChain()->formatAndOutput(env, indent, "<string-deduplication candidates=\"%zu\" dropped=\"%zu\" deduplicated=\"%zu\" bytesSaved=\"%zu\" />",
+			stats->_candidates, stats->_dropped, stats->_deduplicated, stats->_bytesSaved);
+	}
+}
+
 bool
 MM_VerboseHandlerJava::getThreadName(char *buf, UDATA bufLen, OMR_VMThread *omrThread)
 {
@@ -42,6 +42,14 @@ public:
 	 */
 	static void outputFinalizableInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent);
 
+	/**
+	 * Output string deduplication summary, if deduplication is enabled.
+	 * @param manager
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 */
+	static void outputStringDeduplicationInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent);
+
 	/**
 	 * Output the name of the thread into the buffer.
 	 * @return Whether the thread name was truncated.
@@ -43,6 +43,7 @@
 #endif /* defined(J9VM_GC_VLHGC) */
 #include "VerboseWriter.hpp"
 #include "VerboseWriterChain.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
 #include "VerboseWriterFileLoggingBuffered.hpp"
 #include "VerboseWriterFileLoggingSynchronous.hpp"
 #include "VerboseWriterHook.hpp"
@@ -138,7 +139,11 @@ MM_VerboseManagerJava::createWriter(MM_EnvironmentBase *env, WriterType type, ch
 		break;
 
 	case VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS:
-		writer = MM_VerboseWriterFileLoggingSynchronous::newInstance(env, this, filename, fileCount, iterations);
+		if (MM_GCExtensions::getExtensions(env)->verboseBinary) {
+			writer = MM_VerboseWriterFileLoggingBinary::newInstance(env, type, filename, fileCount, iterations);
+		} else {
+			writer = MM_VerboseWriterFileLoggingSynchronous::newInstance(env, this, filename, fileCount, iterations);
+		}
 		if (NULL == writer) {
 			writer = findWriterInChain(VERBOSE_WRITER_STANDARD_STREAM);
 			if (NULL != writer) {
@@ -151,7 +156,11 @@ MM_VerboseManagerJava::createWriter(MM_EnvironmentBase *env, WriterType type, ch
 		break;
 
 	case VERBOSE_WRITER_FILE_LOGGING_BUFFERED:
-		writer = MM_VerboseWriterFileLoggingBuffered::newInstance(env, this, filename, fileCount, iterations);
+		if (MM_GCExtensions::getExtensions(env)->verboseBinary) {
+			writer = MM_VerboseWriterFileLoggingBinary::newInstance(env, type, filename, fileCount, iterations);
+		} else {
+			writer = MM_VerboseWriterFileLoggingBuffered::newInstance(env, this, filename, fileCount, iterations);
+		}
 		if (NULL == writer) {
 			writer = findWriterInChain(VERBOSE_WRITER_STANDARD_STREAM);
 			if (NULL != writer) {
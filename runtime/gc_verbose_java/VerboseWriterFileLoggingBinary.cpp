@@ -0,0 +1,642 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "j9cfg.h"
+#include "gcutils.h"
+#include "modronnls.h"
+
+#include <string.h>
+
+#include "VerboseWriterFileLoggingBinary.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
+#include "Math.hpp"
+
+/* The same header and footer as the text file loggers write */
+#define BINARY_VERBOSEGC_HEADER "<?xml version=\"1.0\" ?>\n\n<verbosegc xmlns=\"http://www.ibm.com/j9/verbosegc\" version=\"%s\">\n\n"
+#define BINARY_VERBOSEGC_FOOTER "</verbosegc>\n"
+
+/* Time a producer waits for the drain thread before looking for free space again */
+#define PRODUCER_WAIT_MILLIS 10
+
+#define RECORD_SIZE(length) (sizeof(J9VerboseBinaryRecordHeader) + MM_Math::roundToCeiling(J9VERBOSEBINARY_RECORD_ALIGNMENT, (length)))
+#define MAX_TEXT_RECORD_PAYLOAD (J9VERBOSEBINARY_BUFFER_SIZE / 4)
+
+MM_VerboseWriterFileLoggingBinary::MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, WriterType type)
+	: MM_VerboseWriter(type)
+	, _javaVM((J9JavaVM *)env->getLanguageVM())
+	, _logFileDescriptor(-1)
+	, _textCopyFileDescriptor(-1)
+	, _sequence(0)
+	, _drainMonitor(NULL)
+	, _drainThreadState(drain_thread_not_started)
+	, _drainRequested(false)
+	, _hooksRegistered(false)
+{
+	memset(_buffers, 0, sizeof(_buffers));
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingBinary instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingBinary, or NULL if rotation was requested or the file could not be opened.
+ */
+MM_VerboseWriterFileLoggingBinary *
+MM_VerboseWriterFileLoggingBinary::newInstance(MM_EnvironmentBase *env, WriterType type, const char *filename, UDATA fileCount, UDATA iterations)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
+
+	if (!checkNoRotation(env, fileCount, iterations)) {
+		return NULL;
+	}
+
+	MM_VerboseWriterFileLoggingBinary *agent = (MM_VerboseWriterFileLoggingBinary *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingBinary), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL != agent) {
+		new(agent) MM_VerboseWriterFileLoggingBinary(env, type);
+		if (!agent->initialize(env, filename)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingBinary instance.
+ * Allocates the ring buffers, opens the file, starts the drain thread and hooks the GC cycle events.
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::initialize(MM_EnvironmentBase *env, const char *filename)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
+
+	if (!MM_VerboseWriter::initialize(env)) {
+		return false;
+	}
+
+	U_8 *data = (U_8 *)extensions->getForge()->allocate(J9VERBOSEBINARY_BUFFER_COUNT * J9VERBOSEBINARY_BUFFER_SIZE, MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL == data) {
+		return false;
+	}
+	for (UDATA i = 0; i < J9VERBOSEBINARY_BUFFER_COUNT; i++) {
+		_buffers[i].data = data + (i * J9VERBOSEBINARY_BUFFER_SIZE);
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_drainMonitor, 0, "MM_VerboseWriterFileLoggingBinary::_drainMonitor")) {
+		return false;
+	}
+
+	if (!openFile(env, filename)) {
+		return false;
+	}
+
+	if (!startDrainThread(env)) {
+		return false;
+	}
+
+	J9HookInterface **mmOmrHooks = J9_HOOK_INTERFACE(extensions->omrHookInterface);
+	if ((0 != (*mmOmrHooks)->J9HookRegisterWithCallSite(mmOmrHooks, J9HOOK_MM_OMR_GC_CYCLE_START, hookCycleStart, OMR_GET_CALLSITE(), (void *)this))
+	|| (0 != (*mmOmrHooks)->J9HookRegisterWithCallSite(mmOmrHooks, J9HOOK_MM_OMR_GC_CYCLE_END, hookCycleEnd, OMR_GET_CALLSITE(), (void *)this))
+	) {
+		return false;
+	}
+	_hooksRegistered = true;
+
+	return true;
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingBinary.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
+
+	if (_hooksRegistered) {
+		J9HookInterface **mmOmrHooks = J9_HOOK_INTERFACE(extensions->omrHookInterface);
+		(*mmOmrHooks)->J9HookUnregister(mmOmrHooks, J9HOOK_MM_OMR_GC_CYCLE_START, hookCycleStart, (void *)this);
+		(*mmOmrHooks)->J9HookUnregister(mmOmrHooks, J9HOOK_MM_OMR_GC_CYCLE_END, hookCycleEnd, (void *)this);
+		_hooksRegistered = false;
+	}
+
+	stopDrainThread(env);
+	closeFile(env);
+
+	if (NULL != _drainMonitor) {
+		omrthread_monitor_destroy(_drainMonitor);
+		_drainMonitor = NULL;
+	}
+	if (NULL != _buffers[0].data) {
+		extensions->getForge()->free(_buffers[0].data);
+		memset(_buffers, 0, sizeof(_buffers));
+	}
+
+	MM_VerboseWriter::tearDown(env);
+}
+
+/**
+ * Expand the %pid, %p and other tokens in filename.
+ * @return the expanded name, to be freed by the caller, or NULL on failure
+ */
+char *
+MM_VerboseWriterFileLoggingBinary::expandFilename(MM_EnvironmentBase *env, const char *filename)
+{
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
+	char *expanded = NULL;
+	char pidBuffer[64];
+
+	J9StringTokens *tokens = j9str_create_tokens(j9time_current_time_millis());
+	if (NULL == tokens) {
+		return NULL;
+	}
+
+	/* for backwards compatibility with Sovereign, alias %p to be the same as %pid */
+	if ((sizeof(pidBuffer) >= j9str_subst_tokens(pidBuffer, sizeof(pidBuffer), "%pid", tokens))
+	&& (0 == j9str_set_token(PORTLIB, tokens, "p", "%s", pidBuffer))
+	) {
+		UDATA length = j9str_subst_tokens(NULL, 0, filename, tokens);
+		expanded = (char *)extensions->getForge()->allocate(length, MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+		if (NULL != expanded) {
+			j9str_subst_tokens(expanded, length, filename, tokens);
+		}
+	}
+
+	j9str_free_tokens(tokens);
+	return expanded;
+}
+
+/**
+ * Opens the file, writes the binary file header and queues the verbosegc header text as the first text record.
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::openFile(MM_EnvironmentBase *env, const char *filename)
+{
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
+	const char *version = _javaVM->memoryManagerFunctions->omrgc_get_version(env->getOmrVM());
+
+	char *filenameToOpen = expandFilename(env, filename);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileDescriptor = j9file_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == _logFileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while (NULL != (cursor = strchr(++cursor, DIR_SEPARATOR))) {
+			*cursor = '\0';
+			j9file_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileDescriptor = j9file_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == _logFileDescriptor) {
+			j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_UNABLE_TO_OPEN_FILE, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	if (extensions->fvtest_verboseBinaryTextCopy) {
+		openTextCopy(env, filenameToOpen);
+	}
+	extensions->getForge()->free(filenameToOpen);
+
+	J9VerboseBinaryFileHeader fileHeader;
+	memset(&fileHeader, 0, sizeof(fileHeader));
+	memcpy(fileHeader.eyecatcher, J9VERBOSEBINARY_EYECATCHER, sizeof(fileHeader.eyecatcher));
+	fileHeader.byteOrderMark = J9VERBOSEBINARY_BYTE_ORDER_MARK;
+	fileHeader.version = J9VERBOSEBINARY_VERSION;
+	fileHeader.headerSize = sizeof(J9VerboseBinaryFileHeader);
+	fileHeader.recordHeaderSize = sizeof(J9VerboseBinaryRecordHeader);
+	fileHeader.hiresFrequency = j9time_hires_frequency();
+	if ((IDATA)sizeof(fileHeader) != j9file_write(_logFileDescriptor, &fileHeader, sizeof(fileHeader))) {
+		j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_UNABLE_TO_OPEN_FILE, filename);
+		closeFile(env);
+		return false;
+	}
+
+	/* The length is -2 for the "%s" in the header and +1 for '\0' */
+	UDATA headerLength = strlen(version) + strlen(BINARY_VERBOSEGC_HEADER) - 1;
+	char *headerText = (char *)extensions->getForge()->allocate(headerLength, MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL != headerText) {
+		j9str_printf(PORTLIB, headerText, headerLength, BINARY_VERBOSEGC_HEADER, version);
+		outputString(env, headerText);
+		extensions->getForge()->free(headerText);
+	}
+
+	return true;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::openTextCopy(MM_EnvironmentBase *env, const char *filename)
+{
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
+	UDATA length = strlen(filename) + sizeof(".txt");
+	char *textFilename = (char *)extensions->getForge()->allocate(length, MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+
+	if (NULL != textFilename) {
+		j9str_printf(PORTLIB, textFilename, length, "%s.txt", filename);
+		_textCopyFileDescriptor = j9file_open(textFilename, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == _textCopyFileDescriptor) {
+			j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_UNABLE_TO_OPEN_FILE, textFilename);
+		}
+		extensions->getForge()->free(textFilename);
+	}
+}
+
+/**
+ * Closes the file being logged to. All records must already have been drained.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::closeFile(MM_EnvironmentBase *env)
+{
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	if (-1 != _logFileDescriptor) {
+		j9file_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+	if (-1 != _textCopyFileDescriptor) {
+		j9file_close(_textCopyFileDescriptor);
+		_textCopyFileDescriptor = -1;
+	}
+}
+
+/**
+ * Start the drain thread and wait for it to begin running.
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::startDrainThread(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_drainMonitor);
+	_drainThreadState = drain_thread_not_started;
+
+	IDATA result = _javaVM->internalVMFunctions->createThreadWithCategory(
+						NULL,
+						_javaVM->defaultOSStackSize,
+						J9THREAD_PRIORITY_NORMAL,
+						0,
+						&drainThreadProc,
+						this,
+						J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+
+	if (0 != result) {
+		omrthread_monitor_exit(_drainMonitor);
+		return false;
+	}
+
+	while (drain_thread_not_started == _drainThreadState) {
+		omrthread_monitor_wait(_drainMonitor);
+	}
+	omrthread_monitor_exit(_drainMonitor);
+
+	return true;
+}
+
+/**
+ * Ask the drain thread to write out whatever remains in the buffers and wait for it to exit.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::stopDrainThread(MM_EnvironmentBase *env)
+{
+	if (NULL != _drainMonitor) {
+		omrthread_monitor_enter(_drainMonitor);
+		if (drain_thread_running == _drainThreadState) {
+			_drainThreadState = drain_thread_stopping;
+			omrthread_monitor_notify_all(_drainMonitor);
+			while (drain_thread_stopped != _drainThreadState) {
+				omrthread_monitor_wait(_drainMonitor);
+			}
+		}
+		/* The drain thread is gone, so anything appended since its last pass can be written from here.
+		 * Producers which find the buffers full also drain them under the monitor.
+		 */
+		drainBuffers();
+		omrthread_monitor_exit(_drainMonitor);
+	} else {
+		drainBuffers();
+	}
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingBinary::drainThreadProc(void *writer)
+{
+	((MM_VerboseWriterFileLoggingBinary *)writer)->drainThreadLoop();
+	/* not reached */
+	return 0;
+}
+
+/**
+ * Main loop of the drain thread. Wakes up periodically, or when asked to, and writes the buffers to the file.
+ * Producers waiting for space are notified after every pass.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::drainThreadLoop()
+{
+	omrthread_set_name(omrthread_self(), "Verbose GC binary writer");
+
+	omrthread_monitor_enter(_drainMonitor);
+	_drainThreadState = drain_thread_running;
+	omrthread_monitor_notify_all(_drainMonitor);
+
+	while (drain_thread_running == _drainThreadState) {
+		if (!_drainRequested) {
+			omrthread_monitor_wait_timed(_drainMonitor, J9VERBOSEBINARY_DRAIN_INTERVAL_MILLIS, 0);
+		}
+		_drainRequested = false;
+		omrthread_monitor_exit(_drainMonitor);
+
+		drainBuffers();
+
+		omrthread_monitor_enter(_drainMonitor);
+		omrthread_monitor_notify_all(_drainMonitor);
+	}
+
+	_drainThreadState = drain_thread_stopped;
+	omrthread_monitor_notify_all(_drainMonitor);
+	omrthread_exit(_drainMonitor);
+}
+
+/**
+ * Copy length bytes into the ring at the logical position, wrapping at the end of the buffer.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::copyToBuffer(RecordBuffer *buffer, UDATA position, const void *source, UDATA length)
+{
+	UDATA offset = position & (J9VERBOSEBINARY_BUFFER_SIZE - 1);
+	UDATA firstLength = OMR_MIN(length, J9VERBOSEBINARY_BUFFER_SIZE - offset);
+
+	if (NULL == source) {
+		memset(buffer->data + offset, 0, firstLength);
+		memset(buffer->data, 0, length - firstLength);
+	} else {
+		memcpy(buffer->data + offset, source, firstLength);
+		memcpy(buffer->data, (const U_8 *)source + firstLength, length - firstLength);
+	}
+}
+
+/**
+ * Try to claim the buffer and append a record to it.
+ * @return true if the record was appended, false if the buffer is in use or does not have enough space
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::tryAppendRecord(RecordBuffer *buffer, U_32 type, const void *payload, UDATA length)
+{
+	bool appended = false;
+
+	if ((0 == buffer->inUse) && (0 == MM_AtomicOperations::lockCompareExchange(&buffer->inUse, 0, 1))) {
+		UDATA head = buffer->head;
+		UDATA recordSize = RECORD_SIZE(length);
+
+		MM_AtomicOperations::readBarrier();
+		if ((J9VERBOSEBINARY_BUFFER_SIZE - (head - buffer->tail)) >= recordSize) {
+			PORT_ACCESS_FROM_JAVAVM(_javaVM);
+			J9VerboseBinaryRecordHeader recordHeader;
+			UDATA headerSize = sizeof(J9VerboseBinaryRecordHeader);
+
+			recordHeader.sequence = (U_64)(MM_AtomicOperations::add(&_sequence, 1) - 1);
+			recordHeader.timestamp = (U_64)j9time_current_time_millis();
+			recordHeader.type = type;
+			recordHeader.length = (U_32)length;
+
+			copyToBuffer(buffer, head, &recordHeader, headerSize);
+			copyToBuffer(buffer, head + headerSize, payload, length);
+			copyToBuffer(buffer, head + headerSize + length, NULL, recordSize - headerSize - length);
+
+			/* the record must be visible before the drain thread sees the new head */
+			MM_AtomicOperations::writeBarrier();
+			buffer->head = head + recordSize;
+			appended = true;
+		}
+
+		MM_AtomicOperations::storeSync();
+		buffer->inUse = 0;
+	}
+
+	return appended;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::appendRecord(MM_EnvironmentBase *env, U_32 type, const void *payload, UDATA length)
+{
+	/* spread threads across the buffers so that concurrent producers rarely contend for the same one */
+	UDATA start = ((UDATA)env->getLanguageVMThread() >> 8) % J9VERBOSEBINARY_BUFFER_COUNT;
+
+	for (;;) {
+		for (UDATA i = 0; i < J9VERBOSEBINARY_BUFFER_COUNT; i++) {
+			if (tryAppendRecord(&_buffers[(start + i) % J9VERBOSEBINARY_BUFFER_COUNT], type, payload, length)) {
+				return;
+			}
+		}
+
+		/* every buffer is busy or full: have the drain thread make room */
+		omrthread_monitor_enter(_drainMonitor);
+		if (drain_thread_running == _drainThreadState) {
+			_drainRequested = true;
+			omrthread_monitor_notify_all(_drainMonitor);
+			omrthread_monitor_wait_timed(_drainMonitor, PRODUCER_WAIT_MILLIS, 0);
+		} else if (drain_thread_stopping == _drainThreadState) {
+			omrthread_monitor_wait_timed(_drainMonitor, PRODUCER_WAIT_MILLIS, 0);
+		} else {
+			/* there is no drain thread to race with */
+			drainBuffers();
+		}
+		omrthread_monitor_exit(_drainMonitor);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::drainBuffers()
+{
+	PORT_ACCESS_FROM_JAVAVM(_javaVM);
+
+	for (UDATA i = 0; i < J9VERBOSEBINARY_BUFFER_COUNT; i++) {
+		RecordBuffer *buffer = &_buffers[i];
+		UDATA head = buffer->head;
+		UDATA tail = buffer->tail;
+
+		/* the records up to head must be read after head itself */
+		MM_AtomicOperations::readBarrier();
+		while (tail != head) {
+			UDATA offset = tail & (J9VERBOSEBINARY_BUFFER_SIZE - 1);
+			UDATA length = OMR_MIN(head - tail, J9VERBOSEBINARY_BUFFER_SIZE - offset);
+			if (-1 != _logFileDescriptor) {
+				j9file_write(_logFileDescriptor, buffer->data + offset, length);
+			}
+			tail += length;
+		}
+
+		/* the space must not be reused until it has been written */
+		MM_AtomicOperations::storeSync();
+		buffer->tail = tail;
+	}
+}
+
+bool
+MM_VerboseWriterFileLoggingBinary::checkNoRotation(MM_EnvironmentBase *env, UDATA fileCount, UDATA iterations)
+{
+	if ((0 != fileCount) || (0 != iterations)) {
+		PORT_ACCESS_FROM_ENVIRONMENT(env);
+		j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_VERBOSE_BINARY_ROTATION_NOT_SUPPORTED);
+		return false;
+	}
+	return true;
+}
+
+bool
+MM_VerboseWriterFileLoggingBinary::reconfigure(MM_EnvironmentBase *env, const char *filename, UDATA fileCount, UDATA iterations)
+{
+	if (!checkNoRotation(env, fileCount, iterations)) {
+		return false;
+	}
+
+	/* the old file is complete: a new one starts with its own header */
+	outputString(env, BINARY_VERBOSEGC_FOOTER);
+	stopDrainThread(env);
+
+	/* producers which find every buffer full while the drain thread is stopped drain them under the monitor, so hold it while the file changes */
+	omrthread_monitor_enter(_drainMonitor);
+	drainBuffers();
+	closeFile(env);
+	bool result = openFile(env, filename);
+	omrthread_monitor_exit(_drainMonitor);
+
+	return startDrainThread(env) && result;
+}
+
+/**
+ * Wake the drain thread so that the cycle reaches the file promptly.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::endOfCycle(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_drainMonitor);
+	_drainRequested = true;
+	omrthread_monitor_notify_all(_drainMonitor);
+	omrthread_monitor_exit(_drainMonitor);
+}
+
+/**
+ * Appends the footer, writes out all outstanding records and closes the file.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::closeStream(MM_EnvironmentBase *env)
+{
+	if (-1 != _logFileDescriptor) {
+		outputString(env, BINARY_VERBOSEGC_FOOTER);
+		stopDrainThread(env);
+		closeFile(env);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	UDATA remaining = strlen(string);
+
+	if (-1 != _textCopyFileDescriptor) {
+		PORT_ACCESS_FROM_ENVIRONMENT(env);
+		j9file_write_text(_textCopyFileDescriptor, string, remaining);
+	}
+
+	while (0 != remaining) {
+		UDATA length = OMR_MIN(remaining, (UDATA)MAX_TEXT_RECORD_PAYLOAD);
+		appendRecord(env, J9VERBOSEBINARY_RECORD_TEXT, string, length);
+		string += length;
+		remaining -= length;
+	}
+}
+
+U_32
+MM_VerboseWriterFileLoggingBinary::getBinaryCycleType(UDATA cycleType)
+{
+	U_32 binaryCycleType = J9VERBOSEBINARY_CYCLE_UNKNOWN;
+
+	switch (cycleType) {
+	case OMR_GC_CYCLE_TYPE_GLOBAL:
+		binaryCycleType = J9VERBOSEBINARY_CYCLE_GLOBAL;
+		break;
+	case OMR_GC_CYCLE_TYPE_SCAVENGE:
+		binaryCycleType = J9VERBOSEBINARY_CYCLE_SCAVENGE;
+		break;
+	case OMR_GC_CYCLE_TYPE_VLHGC_PARTIAL_GARBAGE_COLLECT:
+		binaryCycleType = J9VERBOSEBINARY_CYCLE_PARTIAL_GC;
+		break;
+	case OMR_GC_CYCLE_TYPE_VLHGC_GLOBAL_MARK_PHASE:
+		binaryCycleType = J9VERBOSEBINARY_CYCLE_GLOBAL_MARK_PHASE;
+		break;
+	case OMR_GC_CYCLE_TYPE_VLHGC_GLOBAL_GARBAGE_COLLECT:
+		binaryCycleType = J9VERBOSEBINARY_CYCLE_GLOBAL_GARBAGE_COLLECT;
+		break;
+	default:
+		break;
+	}
+
+	return binaryCycleType;
+}
+
+/**
+ * Queue a cycle record. No I/O is done on the calling thread unless every buffer is full.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::appendCycleRecord(MM_EnvironmentBase *env, U_32 recordType, U_64 hiresTimestamp, MM_CommonGCData *commonData, UDATA cycleType)
+{
+	if (isActive()) {
+		J9VerboseBinaryCycleRecord record;
+		memset(&record, 0, sizeof(record));
+		record.hiresTimestamp = hiresTimestamp;
+		record.nurseryFreeBytes = commonData->nurseryFreeBytes;
+		record.nurseryTotalBytes = commonData->nurseryTotalBytes;
+		record.tenureFreeBytes = commonData->tenureFreeBytes;
+		record.tenureTotalBytes = commonData->tenureTotalBytes;
+		record.cycleType = getBinaryCycleType(cycleType);
+		appendRecord(env, recordType, &record, sizeof(record));
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::hookCycleStart(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	MM_GCCycleStartEvent *event = (MM_GCCycleStartEvent *)eventData;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->omrVMThread);
+
+	((MM_VerboseWriterFileLoggingBinary *)userData)->appendCycleRecord(env, J9VERBOSEBINARY_RECORD_CYCLE_START, event->timestamp, event->commonData, event->cycleType);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::hookCycleEnd(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	MM_GCCycleEndEvent *event = (MM_GCCycleEndEvent *)eventData;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->omrVMThread);
+
+	((MM_VerboseWriterFileLoggingBinary *)userData)->appendCycleRecord(env, J9VERBOSEBINARY_RECORD_CYCLE_END, event->timestamp, event->commonData, event->cycleType);
+}
@@ -0,0 +1,197 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGBINARY_HPP_)
+#define VERBOSEWRITERFILELOGGINGBINARY_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "mmomrhook.h"
+
+#include "VerboseWriter.hpp"
+
+/*
+ * Layout of a binary verbose GC log (formatted by com.ibm.jvm.format.VerboseGCFormat):
+ *
+ * J9VerboseBinaryFileHeader, followed by records. Each record is a J9VerboseBinaryRecordHeader followed
+ * by a payload whose layout is fixed by the record type, padded to a multiple of J9VERBOSEBINARY_RECORD_ALIGNMENT.
+ * Text records hold the verbose GC output, including the header and footer of the log: concatenated in
+ * sequence order they are the text log the same JVM would have written. Cycle records summarize each GC cycle.
+ * Readers skip records of types they do not know by using the length. All fields are in the byte order of the
+ * JVM which wrote the file, identified by byteOrderMark.
+ *
+ * Records are written in batches from several buffers, so they are not in file order: sorting them
+ * by sequence number restores the order in which the events occurred.
+ */
+#define J9VERBOSEBINARY_EYECATCHER "J9VGCBIN"
+#define J9VERBOSEBINARY_VERSION 3
+#define J9VERBOSEBINARY_BYTE_ORDER_MARK 0x01020304
+#define J9VERBOSEBINARY_RECORD_ALIGNMENT 8
+
+#define J9VERBOSEBINARY_BUFFER_COUNT 4
+#define J9VERBOSEBINARY_BUFFER_SIZE (256 * 1024) /* must be a power of two */
+#define J9VERBOSEBINARY_DRAIN_INTERVAL_MILLIS 1000
+
+/* Values for J9VerboseBinaryRecordHeader.type */
+#define J9VERBOSEBINARY_RECORD_CYCLE_START 1 /* payload is a J9VerboseBinaryCycleRecord */
+#define J9VERBOSEBINARY_RECORD_CYCLE_END 2 /* payload is a J9VerboseBinaryCycleRecord */
+#define J9VERBOSEBINARY_RECORD_TEXT 3 /* payload is verbose GC output text, not NUL terminated */
+
+/* Values for J9VerboseBinaryCycleRecord.cycleType, independent of the collector's own numbering */
+#define J9VERBOSEBINARY_CYCLE_UNKNOWN 0
+#define J9VERBOSEBINARY_CYCLE_GLOBAL 1
+#define J9VERBOSEBINARY_CYCLE_SCAVENGE 2
+#define J9VERBOSEBINARY_CYCLE_PARTIAL_GC 3
+#define J9VERBOSEBINARY_CYCLE_GLOBAL_MARK_PHASE 4
+#define J9VERBOSEBINARY_CYCLE_GLOBAL_GARBAGE_COLLECT 5
+
+typedef struct J9VerboseBinaryFileHeader {
+	char eyecatcher[8];
+	U_32 byteOrderMark;
+	U_32 version;
+	U_32 headerSize;
+	U_32 recordHeaderSize;
+	U_64 hiresFrequency; /**< ticks per second of the hires timestamps in the records */
+} J9VerboseBinaryFileHeader;
+
+typedef struct J9VerboseBinaryRecordHeader {
+	U_64 sequence; /**< order in which the record was produced */
+	U_64 timestamp; /**< time in milliseconds at which the record was produced */
+	U_32 type; /**< one of the J9VERBOSEBINARY_RECORD_* values */
+	U_32 length; /**< number of payload bytes, excluding padding */
+} J9VerboseBinaryRecordHeader;
+
+typedef struct J9VerboseBinaryCycleRecord {
+	U_64 hiresTimestamp; /**< hires clock value reported with the event */
+	U_64 nurseryFreeBytes;
+	U_64 nurseryTotalBytes;
+	U_64 tenureFreeBytes;
+	U_64 tenureTotalBytes;
+	U_32 cycleType; /**< one of the J9VERBOSEBINARY_CYCLE_* values */
+	U_32 reserved;
+} J9VerboseBinaryCycleRecord;
+
+/**
+ * Output agent which directs verbosegc output to a binary log file.
+ *
+ * The stanzas produced by the verbose handlers are logged as text records. The writer also hooks the start
+ * and end of every GC cycle and records each as a fixed-layout record. Records are appended to in-memory
+ * ring buffers without taking locks or doing any I/O. A background thread drains the buffers to the file
+ * when a cycle ends, when a buffer fills, and periodically.
+ *
+ * Log rotation is not supported: a request for several files or a cycle count is rejected.
+ */
+class MM_VerboseWriterFileLoggingBinary : public MM_VerboseWriter
+{
+private:
+	/**
+	 * A single producer, single consumer ring of records. A producer owns the buffer while inUse is set.
+	 */
+	struct RecordBuffer {
+		volatile UDATA inUse; /**< non-zero while a thread is appending to the buffer */
+		volatile UDATA head; /**< number of bytes ever appended */
+		volatile UDATA tail; /**< number of bytes ever written to the file */
+		U_8 *data;
+	};
+
+	enum DrainThreadState {
+		drain_thread_not_started = 0,
+		drain_thread_running,
+		drain_thread_stopping,
+		drain_thread_stopped
+	};
+
+	J9JavaVM *_javaVM;
+	IDATA _logFileDescriptor; /**< the log file, or -1 if it is not open */
+	IDATA _textCopyFileDescriptor; /**< the text copy of the log written for -Xgc:fvtest_verboseBinaryTextCopy, or -1 */
+	RecordBuffer _buffers[J9VERBOSEBINARY_BUFFER_COUNT];
+	volatile UDATA _sequence; /**< sequence number of the next record */
+	omrthread_monitor_t _drainMonitor; /**< protects the drain thread state and is used to wake up the drain thread and waiting producers */
+	volatile DrainThreadState _drainThreadState;
+	bool _drainRequested; /**< set when a producer or the end of a cycle wants the buffers drained promptly */
+	bool _hooksRegistered;
+
+protected:
+	MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, WriterType type);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+private:
+	char *expandFilename(MM_EnvironmentBase *env, const char *filename);
+	bool openFile(MM_EnvironmentBase *env, const char *filename);
+	/**
+	 * Open <filename>.txt, which receives the same text as the text records, unbuffered.
+	 */
+	void openTextCopy(MM_EnvironmentBase *env, const char *filename);
+	void closeFile(MM_EnvironmentBase *env);
+	bool startDrainThread(MM_EnvironmentBase *env);
+	void stopDrainThread(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if fileCount and iterations ask only for a single file, reporting an error otherwise
+	 */
+	static bool checkNoRotation(MM_EnvironmentBase *env, UDATA fileCount, UDATA iterations);
+
+	static U_32 getBinaryCycleType(UDATA cycleType);
+	void appendCycleRecord(MM_EnvironmentBase *env, U_32 recordType, U_64 hiresTimestamp, MM_CommonGCData *commonData, UDATA cycleType);
+
+	static void hookCycleStart(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+	static void hookCycleEnd(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+
+	/**
+	 * Append a record to one of the ring buffers, waiting for the drain thread only if all of them are full.
+	 */
+	void appendRecord(MM_EnvironmentBase *env, U_32 type, const void *payload, UDATA length);
+	bool tryAppendRecord(RecordBuffer *buffer, U_32 type, const void *payload, UDATA length);
+	void copyToBuffer(RecordBuffer *buffer, UDATA position, const void *source, UDATA length);
+
+	/**
+	 * Write the contents of every ring buffer to the file. Called only by the drain thread, or once it has stopped.
+	 */
+	void drainBuffers();
+
+	static int J9THREAD_PROC drainThreadProc(void *writer);
+	void drainThreadLoop();
+
+public:
+	/**
+	 * @param type the file logging type which was requested, so that the writer is found again when verbose GC is reconfigured
+	 */
+	static MM_VerboseWriterFileLoggingBinary *newInstance(MM_EnvironmentBase *env, WriterType type, const char *filename, UDATA fileCount, UDATA iterations);
+
+	/**
+	 * Switch to logging to filename. Rotation is rejected, leaving the current file in use.
+	 */
+	virtual bool reconfigure(MM_EnvironmentBase *env, const char *filename, UDATA fileCount, UDATA iterations);
+
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+
+	virtual void closeStream(MM_EnvironmentBase *env);
+
+	/**
+	 * Queue the text as one or more text records. No I/O is done on the calling thread unless every buffer is full.
+	 */
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGBINARY_HPP_ */
@@ -35,6 +35,8 @@
 #include "CardTable.hpp"
 #include "EnvironmentBase.hpp"
 #include "EnvironmentVLHGC.hpp"
+#include "FreeRegionZeroer.hpp"
+#include "GCExtensions.hpp"
 #include "HeapRegionDescriptorVLHGC.hpp"
 #include "HeapRegionManager.hpp"
 #include "MemoryPoolBumpPointer.hpp"
@@ -326,8 +328,19 @@ MM_AllocationContextBalanced::allocateArrayletLeaf(MM_EnvironmentBase *env, MM_A
 		result = _subspace->replenishAllocationContextFailed(env, _subspace, this, NULL, allocateDescription, MM_MemorySubSpace::ALLOCATION_TYPE_LEAF);
 	}
 	if (NULL != result) {
-		/* zero the leaf here since we are not under any of the context or exclusive locks */
-		OMRZeroMemory(result, _heapRegionManager->getRegionSize());
+		MM_HeapRegionDescriptorVLHGC *leafRegion = (MM_HeapRegionDescriptorVLHGC *)_heapRegionManager->tableDescriptorForAddress(result);
+		if (leafRegion->_allocateData._zeroed) {
+			/* the free region zeroer has already cleared this region */
+			leafRegion->_allocateData._zeroed = false;
+		} else {
+			/* zero the leaf here since we are not under any of the context or exclusive locks */
+			OMRZeroMemory(result, _heapRegionManager->getRegionSize());
+		}
+		MM_FreeRegionZeroer *zeroer = MM_GCExtensions::getExtensions(env)->freeRegionZeroer;
+		if (NULL != zeroer) {
+			/* a zeroed region was consumed or none was available, so ask for more */
+			zeroer->notifyRegionsNeeded();
+		}
 	}
 	return result;
 }
@@ -599,6 +612,9 @@ MM_AllocationContextBalanced::getLargestFreeEntry()
 	if (NULL == free) {
 		free = _freeRegions.peekFirstRegion();
 	}
+	if (NULL == free) {
+		free = _zeroedFreeRegions.peekFirstRegion();
+	}
 	if (NULL != free) {
 		largest = free->getSize();
 	} else {
@@ -727,6 +743,12 @@ MM_AllocationContextBalanced::acquireMPBPRegionFromContext(MM_EnvironmentBase *e
 		region = _freeRegions.peekFirstRegion();
 		if (NULL != region) {
 			_freeRegions.removeRegion(region);
+		} else {
+			/* zeroed regions are kept for arraylet leaves but they are as good as any other free region */
+			region = _zeroedFreeRegions.peekFirstRegion();
+			if (NULL != region) {
+				_zeroedFreeRegions.removeRegion(region);
+			}
 		}
 	}
 	_freeListLock.release();
@@ -790,14 +812,20 @@ MM_HeapRegionDescriptorVLHGC *
 MM_AllocationContextBalanced::acquireFreeRegionFromContext(MM_EnvironmentBase *env)
 {
 	_freeListLock.acquire();
-	MM_HeapRegionDescriptorVLHGC *region = _freeRegions.peekFirstRegion();
+	/* the caller will use the region as an arraylet leaf, so prefer one which needs no zeroing */
+	MM_HeapRegionDescriptorVLHGC *region = _zeroedFreeRegions.peekFirstRegion();
 	if (NULL != region) {
-		_freeRegions.removeRegion(region);
+		_zeroedFreeRegions.removeRegion(region);
 	} else {
-		region = _idleMPBPRegions.peekFirstRegion();
+		region = _freeRegions.peekFirstRegion();
 		if (NULL != region) {
-			_idleMPBPRegions.removeRegion(region);
-			region->_allocateData.taskAsFreePool(env);
+			_freeRegions.removeRegion(region);
+		} else {
+			region = _idleMPBPRegions.peekFirstRegion();
+			if (NULL != region) {
+				_idleMPBPRegions.removeRegion(region);
+				region->_allocateData.taskAsFreePool(env);
+			}
 		}
 	}
 	_freeListLock.release();
@@ -808,6 +836,49 @@ MM_AllocationContextBalanced::acquireFreeRegionFromContext(MM_EnvironmentBase *e
 	
 }
 
+MM_HeapRegionDescriptorVLHGC *
+MM_AllocationContextBalanced::acquireFreeRegionToZero(MM_EnvironmentBase *env)
+{
+	MM_HeapRegionDescriptorVLHGC *region = NULL;
+	UDATA target = MM_GCExtensions::getExtensions(env)->tarokZeroedFreeRegionTarget;
+
+	_freeListLock.acquire();
+	/* leave a region on the free list so that allocation never fails because the zeroer is holding the last one */
+	if ((_zeroedFreeRegions.listSize() < target) && (_freeRegions.listSize() > 1)) {
+		region = _freeRegions.peekFirstRegion();
+		_freeRegions.removeRegion(region);
+	}
+	_freeListLock.release();
+
+	if (NULL != region) {
+		Assert_MM_true(MM_HeapRegionDescriptor::FREE == region->getRegionType());
+		Assert_MM_false(region->_allocateData._zeroed);
+	}
+	return region;
+}
+
+void
+MM_AllocationContextBalanced::addZeroedRegionToFreeList(MM_EnvironmentBase *env, MM_HeapRegionDescriptorVLHGC *region)
+{
+	Assert_MM_true(MM_HeapRegionDescriptor::FREE == region->getRegionType());
+	Assert_MM_true(getNumaNode() == region->getNumaNode());
+	Assert_MM_true(NULL == region->_allocateData._originalOwningContext);
+	region->_allocateData._zeroed = true;
+	_freeListLock.acquire();
+	_zeroedFreeRegions.insertRegion(region);
+	_freeListLock.release();
+}
+
+void
+MM_AllocationContextBalanced::returnUnzeroedRegionToFreeList(MM_EnvironmentBase *env, MM_HeapRegionDescriptorVLHGC *region)
+{
+	Assert_MM_true(MM_HeapRegionDescriptor::FREE == region->getRegionType());
+	Assert_MM_false(region->_allocateData._zeroed);
+	_freeListLock.acquire();
+	_freeRegions.insertRegion(region);
+	_freeListLock.release();
+}
+
 void
 MM_AllocationContextBalanced::lockCommon()
 {
@@ -830,7 +901,7 @@ MM_AllocationContextBalanced::getFreeMemorySize()
 UDATA
 MM_AllocationContextBalanced::getFreeRegionCount()
 {
-	return _idleMPBPRegions.listSize() + _freeRegions.listSize();
+	return _idleMPBPRegions.listSize() + _freeRegions.listSize() + _zeroedFreeRegions.listSize();
 }
 
 void
@@ -1018,6 +1089,7 @@ MM_AllocationContextBalanced::getRegionCount(UDATA *localCount, UDATA *foreignCo
 	countRegionsInList(&_discardRegionList, localCount, foreignCount);
 	countRegionsInList(&_flushedRegions, localCount, foreignCount);
 	countRegionsInList(&_freeRegions, localCount, foreignCount);
+	countRegionsInList(&_zeroedFreeRegions, localCount, foreignCount);
 	countRegionsInList(&_idleMPBPRegions, localCount, foreignCount);
 }
 
@@ -1038,10 +1110,17 @@ MM_AllocationContextBalanced::selectRegionForContraction(MM_EnvironmentBase *env
 	if (NULL != region) {
 		_freeRegions.removeRegion(region);
 	} else {
-		region = _idleMPBPRegions.peekFirstRegion();
+		region = _zeroedFreeRegions.peekFirstRegion();
 		if (NULL != region) {
-			_idleMPBPRegions.removeRegion(region);
-			region->_allocateData.taskAsFreePool(env);
+			_zeroedFreeRegions.removeRegion(region);
+			/* the memory may not be zero when the heap is expanded into this region again */
+			region->_allocateData._zeroed = false;
+		} else {
+			region = _idleMPBPRegions.peekFirstRegion();
+			if (NULL != region) {
+				_idleMPBPRegions.removeRegion(region);
+				region->_allocateData.taskAsFreePool(env);
+			}
 		}
 	}
 	if (NULL != region) {
@@ -58,6 +58,7 @@ private:
 	MM_RegionListTarok _discardRegionList; /**< The list of MPBP regions currently privately owned by this context but either too full or too fragmented to be used to satisfy allocations.  These regions must be flushed back to the subspace before a collection */
 	MM_RegionListTarok _flushedRegions; /**< The list of MPBP regions which have been flushed from active use, for a GC, and have unknown stats (at any point after the GC, however, these regions could all be migrated to _ownedRegions) */
 	MM_RegionListTarok _freeRegions; /**< The list regions which are owned by this context but currently marked as FREE */
+	MM_RegionListTarok _zeroedFreeRegions; /**< The list of FREE regions owned by this context whose memory has been zeroed by the MM_FreeRegionZeroer.  These are preferred for arraylet leaves and used for other purposes only once _freeRegions is empty */
 	MM_RegionListTarok _idleMPBPRegions; /**< The list regions which are owned by this context, currently marked as BUMP_ALLOCATED_IDLE, but contain no objects (this also implies that they can migrate to other contexts on this node, for free, since the receiver isn't using them) */
 	UDATA _freeMemorySize;	/**< The amount of free memory currently managed by the context in the _ownedRegions list only (note that dark matter and small holes are not considered free memory).  This value is always accurate (that is, there is no time when it becomes out of sync with the actual amount of free memory managed by the context). */
 	UDATA _regionCount[MM_HeapRegionDescriptor::LAST_REGION_TYPE]; /**< Count of regions that are owned by this AC (accurate only for TGC purposes) */
@@ -189,6 +190,28 @@ public:
 	 */
 	virtual UDATA getFreeRegionCount();
 
+	/**
+	 * Remove a FREE region which has not been zeroed from the receiver's free list so that the MM_FreeRegionZeroer can zero it.  A region is only
+	 * handed out while the receiver has fewer than tarokZeroedFreeRegionTarget zeroed regions and has another free region left to allocate from.
+	 * @param env[in] The zeroing thread, which must hold VM access until it returns the region through addZeroedRegionToFreeList()
+	 * @return The region to zero, or NULL if the receiver has no region which needs to be zeroed
+	 */
+	MM_HeapRegionDescriptorVLHGC *acquireFreeRegionToZero(MM_EnvironmentBase *env);
+
+	/**
+	 * Return a region zeroed by the MM_FreeRegionZeroer to the receiver's list of zeroed free regions.
+	 * @param env[in] The zeroing thread
+	 * @param region[in] The region returned by acquireFreeRegionToZero(), which has now been zeroed
+	 */
+	void addZeroedRegionToFreeList(MM_EnvironmentBase *env, MM_HeapRegionDescriptorVLHGC *region);
+
+	/**
+	 * Return a region which the MM_FreeRegionZeroer did not finish zeroing to the receiver's free list.
+	 * @param env[in] The zeroing thread
+	 * @param region[in] The region returned by acquireFreeRegionToZero()
+	 */
+	void returnUnzeroedRegionToFreeList(MM_EnvironmentBase *env, MM_HeapRegionDescriptorVLHGC *region);
+
 	/**
 	 * Sets the downstream sibling in the circularly linked-list of contexts on a given node.
 	 * @param sibling[in] The next downstream neighbour in the list (might be this if there is only one context on the node)
@@ -282,6 +305,7 @@ protected:
 		, _discardRegionList()
 		, _flushedRegions()
 		, _freeRegions()
+		, _zeroedFreeRegions()
 		, _idleMPBPRegions()
 		, _freeMemorySize(0)
 		, _threadCount(0)
@@ -56,6 +56,9 @@ protected:
 private:
 	const UDATA _allocationContextNumber;	/**< A unique 0-indexed number assigned to this context instance (to be used for indexing into meta-data arrays, etc) */
 	const AllocationContextType _allocationContextType; /**< The type of this AC, set during instantiation and used for instanceof checks **/
+	MM_AllocationContextTarok *_copyForwardDestination; /**< The context into whose regions copy-forward copies objects owned by this AC (itself unless its objects are mostly reached from another NUMA node) */
+	UDATA _copyForwardLocalBytes; /**< Bytes owned by this AC which the most recent copy-forward reached from this AC's NUMA node, used by TGC */
+	UDATA _copyForwardRemoteBytes; /**< Bytes owned by this AC which the most recent copy-forward reached from other NUMA nodes, used by TGC */
 
 /* Methods */
 public:
@@ -248,11 +251,39 @@ public:
 	 */
 	virtual bool shouldMigrateRegionToCommonContext(MM_EnvironmentBase *env, MM_HeapRegionDescriptorVLHGC *region);
 
+	/**
+	 * @return The context into whose regions copy-forward copies the objects owned by the receiver, when -XXgc:tarokEnableNumaOwnerPlacement is set
+	 */
+	MMINLINE MM_AllocationContextTarok *getCopyForwardDestination() { return _copyForwardDestination; }
+
+	/**
+	 * Set the context into whose regions copy-forward copies the objects owned by the receiver.
+	 * @param destination[in] The destination context (the receiver, to keep its objects on its own node)
+	 */
+	MMINLINE void setCopyForwardDestination(MM_AllocationContextTarok *destination) { _copyForwardDestination = destination; }
+
+	/**
+	 * Record how the objects owned by the receiver were reached during the most recent copy-forward, used by TGC.
+	 * @param localBytes[in] Bytes reached from the receiver's NUMA node
+	 * @param remoteBytes[in] Bytes reached from other NUMA nodes
+	 */
+	MMINLINE void setCopyForwardTraffic(UDATA localBytes, UDATA remoteBytes)
+	{
+		_copyForwardLocalBytes = localBytes;
+		_copyForwardRemoteBytes = remoteBytes;
+	}
+
+	MMINLINE UDATA getCopyForwardLocalBytes() { return _copyForwardLocalBytes; }
+	MMINLINE UDATA getCopyForwardRemoteBytes() { return _copyForwardRemoteBytes; }
+
 protected:
 	MM_AllocationContextTarok(UDATA allocationContextNumber, AllocationContextType allocationContextType)
 		: MM_AllocationContext()
 		, _allocationContextNumber(allocationContextNumber)
 		, _allocationContextType(allocationContextType)
+		, _copyForwardDestination(this)
+		, _copyForwardLocalBytes(0)
+		, _copyForwardRemoteBytes(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -65,6 +65,7 @@
 #include "FinalizableReferenceBuffer.hpp"
 #include "FinalizeListManager.hpp"
 #include "GlobalAllocationManager.hpp"
+#include "GlobalAllocationManagerTarok.hpp"
 #include "Heap.hpp"
 #include "HeapMapIterator.hpp"
 #include "HeapMapWordIterator.hpp"
@@ -90,6 +91,7 @@
 #include "ScavengerForwardedHeader.hpp"
 #include "SlotObject.hpp"
 #include "StackSlotValidator.hpp"
+#include "StringDeduplicator.hpp"
 #include "SublistFragment.hpp"
 #include "SublistIterator.hpp"
 #include "SublistPool.hpp"
@@ -158,10 +160,16 @@ MM_CopyForwardScheme::MM_CopyForwardScheme(MM_EnvironmentVLHGC *env, MM_HeapRegi
 	, _dynamicClassUnloadingEnabled(false)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 	, _collectStringConstantsEnabled(false)
+	, _stringDeduplicationAge(0)
 	, _tracingEnabled(false)
 	, _cacheTracingEnabled(false)
 	, _commonContext(NULL)
 	, _compactGroupBlock(NULL)
+	, _managedContextCount(0)
+	, _numaTrafficBlock(NULL)
+	, _numaTraffic(NULL)
+	, _numaPlacementTraffic(NULL)
+	, _numaPlacementCollections(0)
 	, _arraySplitSize(0)
 	, _regionSublistContentionThreshold(0)
 	, _failedToExpand(false)
@@ -303,6 +311,21 @@ MM_CopyForwardScheme::initialize(MM_EnvironmentVLHGC *env)
 	if (NULL == _compactGroupBlock) {
 		return false;
 	}
+
+	/* allocate the NUMA traffic tables, which are only meaningful if objects can be copied between contexts and only used for placement or TGC */
+	_managedContextCount = MM_GlobalAllocationManagerTarok::calculateIdealManagedContextCount(_extensions);
+	if ((1 < _managedContextCount) && (_extensions->tarokEnableNumaOwnerPlacement || _extensions->tarokRecordNumaTraffic)) {
+		UDATA tableSize = _managedContextCount * _managedContextCount;
+		UDATA trafficSize = sizeof(UDATA) * tableSize * (_extensions->gcThreadCount + 2);
+		_numaTrafficBlock = (UDATA *)_extensions->getForge()->allocate(trafficSize, MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+		if (NULL == _numaTrafficBlock) {
+			return false;
+		}
+		memset(_numaTrafficBlock, 0, trafficSize);
+		/* the shared tables follow the per-thread tables */
+		_numaTraffic = &_numaTrafficBlock[tableSize * _extensions->gcThreadCount];
+		_numaPlacementTraffic = &_numaTraffic[tableSize];
+	}
 	
 	return true;
 }
@@ -340,19 +363,104 @@ MM_CopyForwardScheme::tearDown(MM_EnvironmentVLHGC *env)
 		env->getForge()->free(_compactGroupBlock);
 		_compactGroupBlock = NULL;
 	}
+
+	if (NULL != _numaTrafficBlock) {
+		env->getForge()->free(_numaTrafficBlock);
+		_numaTrafficBlock = NULL;
+		_numaTraffic = NULL;
+		_numaPlacementTraffic = NULL;
+	}
 }
 
 MM_AllocationContextTarok *
-MM_CopyForwardScheme::getPreferredAllocationContext(MM_AllocationContextTarok *suggestedContext, J9Object *objectPtr)
+MM_CopyForwardScheme::getPreferredAllocationContext(MM_AllocationContextTarok *suggestedContext, J9Object *objectPtr, MM_AllocationContextTarok *owningContext)
 {
 	MM_AllocationContextTarok *preferredContext = suggestedContext;
 
-	if (preferredContext == _commonContext) {
-		preferredContext = getContextForHeapAddress(objectPtr);
+	if (_extensions->tarokEnableNumaOwnerPlacement) {
+		if (NULL == owningContext) {
+			owningContext = getContextForHeapAddress(objectPtr);
+		}
+		/* objects owned by the common context are not bound to a node, so they still follow the context which reached them */
+		if ((preferredContext == _commonContext) || (owningContext != _commonContext)) {
+			preferredContext = owningContext->getCopyForwardDestination();
+		}
+	} else if (preferredContext == _commonContext) {
+		preferredContext = (NULL != owningContext) ? owningContext : getContextForHeapAddress(objectPtr);
 	} /* no code beyond this point without modifying else statement below */
 	return preferredContext;
 }
 
+MMINLINE void
+MM_CopyForwardScheme::recordNumaTraffic(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *owningContext, MM_AllocationContextTarok *reachingContext, UDATA objectSizeInBytes)
+{
+	/* the common context is not bound to a node, so reaching an object from it says nothing about where the object is used */
+	if (reachingContext != _commonContext) {
+		UDATA owner = owningContext->getAllocationContextNumber();
+		UDATA reacher = reachingContext->getAllocationContextNumber();
+		UDATA *threadTraffic = &_numaTrafficBlock[env->getSlaveID() * _managedContextCount * _managedContextCount];
+		threadTraffic[(owner * _managedContextCount) + reacher] += objectSizeInBytes;
+	}
+}
+
+void
+MM_CopyForwardScheme::updateNumaPlacement(MM_EnvironmentVLHGC *env)
+{
+	MM_GlobalAllocationManagerTarok *allocationManager = (MM_GlobalAllocationManagerTarok *)_extensions->globalAllocationManager;
+	UDATA contextCount = _managedContextCount;
+
+	_numaPlacementCollections += 1;
+	bool reconsiderPlacement = _extensions->tarokEnableNumaOwnerPlacement && (_numaPlacementCollections >= _extensions->tarokNumaPlacementInterval);
+
+	for (UDATA owner = 0; owner < contextCount; owner++) {
+		MM_AllocationContextTarok *owningContext = allocationManager->getAllocationContextByIndex(owner);
+		UDATA owningNode = owningContext->getNumaNode();
+		UDATA *traffic = &_numaTraffic[owner * contextCount];
+		UDATA *placementTraffic = &_numaPlacementTraffic[owner * contextCount];
+		UDATA localBytes = 0;
+		UDATA remoteBytes = 0;
+		UDATA totalBytes = 0;
+		MM_AllocationContextTarok *busiestContext = owningContext;
+		UDATA busiestBytes = 0;
+
+		for (UDATA reacher = 0; reacher < contextCount; reacher++) {
+			MM_AllocationContextTarok *reachingContext = allocationManager->getAllocationContextByIndex(reacher);
+			if (reachingContext->getNumaNode() == owningNode) {
+				localBytes += traffic[reacher];
+			} else {
+				remoteBytes += traffic[reacher];
+			}
+			placementTraffic[reacher] += traffic[reacher];
+			traffic[reacher] = 0;
+
+			totalBytes += placementTraffic[reacher];
+			if (placementTraffic[reacher] > busiestBytes) {
+				busiestContext = reachingContext;
+				busiestBytes = placementTraffic[reacher];
+			}
+		}
+		owningContext->setCopyForwardTraffic(localBytes, remoteBytes);
+
+		if (reconsiderPlacement) {
+			if (owningContext != _commonContext) {
+				/* keep the objects on their own node unless one other node has been reaching most of them */
+				MM_AllocationContextTarok *destination = owningContext;
+				if ((busiestContext->getNumaNode() != owningNode)
+					&& (((double)busiestBytes * 100.0) >= ((double)totalBytes * (double)_extensions->tarokNumaPlacementMigrationPercent))
+				) {
+					destination = busiestContext;
+				}
+				owningContext->setCopyForwardDestination(destination);
+			}
+			memset(placementTraffic, 0, sizeof(UDATA) * contextCount);
+		}
+	}
+
+	if (reconsiderPlacement) {
+		_numaPlacementCollections = 0;
+	}
+}
+
 void
 MM_CopyForwardScheme::raiseAbortFlag(MM_EnvironmentVLHGC *env)
 {
@@ -1399,6 +1507,15 @@ MM_CopyForwardScheme::masterCleanupForCopyForward(MM_EnvironmentVLHGC *env)
 	}
 
 	Assert_MM_true(static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats._copyForwardStats._ownableSynchronizerCandidates >= static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats._copyForwardStats._ownableSynchronizerSurvived);
+
+	if (NULL != _extensions->stringDeduplicator) {
+		/* objects which could not be copied after an abort are marked in place, so the copied Strings are all valid */
+		_extensions->stringDeduplicator->gcEnd(env, true);
+	}
+
+	if (NULL != _numaTrafficBlock) {
+		updateNumaPlacement(env);
+	}
 }
 
 /**
@@ -1427,6 +1544,10 @@ MM_CopyForwardScheme::masterSetupForCopyForward(MM_EnvironmentVLHGC *env)
 	_dynamicClassUnloadingEnabled = env->_cycleState->_dynamicClassUnloadingEnabled;
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 	_collectStringConstantsEnabled = _extensions->collectStringConstants;
+	if (NULL != _extensions->stringDeduplicator) {
+		/* objects in regions of the maximum age are copied into regions of the same age, so that is the oldest age a String can reach */
+		_stringDeduplicationAge = OMR_MIN(_extensions->stringDeduplicationAge, _extensions->tarokRegionMaxAge);
+	}
 
 	/* ensure heap base is aligned to region size */
 	UDATA heapBase = (UDATA)_extensions->heap->getHeapBase();
@@ -1470,6 +1591,11 @@ MM_CopyForwardScheme::workerSetupForCopyForward(MM_EnvironmentVLHGC *env)
 		env->_copyForwardCompactGroups[compactGroup].initialize(env);
 	}
 
+	if (NULL != _numaTrafficBlock) {
+		UDATA tableSize = _managedContextCount * _managedContextCount;
+		memset(&_numaTrafficBlock[env->getSlaveID() * tableSize], 0, sizeof(UDATA) * tableSize);
+	}
+
 	Assert_MM_true(NULL == env->_lastOverflowedRsclWithReleasedBuffers);
 }
 
@@ -1541,6 +1667,17 @@ MM_CopyForwardScheme::mergeGCStats(MM_EnvironmentVLHGC *env)
 		}
 	}
 
+	if (NULL != _numaTrafficBlock) {
+		UDATA tableSize = _managedContextCount * _managedContextCount;
+		UDATA *threadTraffic = &_numaTrafficBlock[env->getSlaveID() * tableSize];
+		for (UDATA index = 0; index < tableSize; index++) {
+			/* use an atomic since other threads may be doing this at the same time */
+			if (0 != threadTraffic[index]) {
+				MM_AtomicOperations::add(&_numaTraffic[index], threadTraffic[index]);
+			}
+		}
+	}
+
 	/* Protect the merge with the mutex (this is done by multiple threads in the parallel collector) */
 	omrthread_monitor_enter(_extensions->gcStatsMutex);
 	static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats._copyForwardStats.merge(localStats);
@@ -1916,7 +2053,13 @@ MM_CopyForwardScheme::copy(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *
 		}
 #endif /* J9VM_INTERP_NATIVE_SUPPORT */
 
-		reservingContext = getPreferredAllocationContext(reservingContext, object);
+		MM_AllocationContextTarok *reachingContext = reservingContext;
+		MM_AllocationContextTarok *owningContext = NULL;
+		if (NULL != _numaTrafficBlock) {
+			/* look the owner up once, for both the placement and the traffic tables */
+			owningContext = getContextForHeapAddress(object);
+		}
+		reservingContext = getPreferredAllocationContext(reservingContext, object, owningContext);
 
 		copyCache = reserveMemoryForCopy(env, object, reservingContext, objectReserveSizeInBytes);
 
@@ -2025,6 +2168,15 @@ MM_CopyForwardScheme::copy(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *
 				copyCache->_lowerAgeBound = OMR_MIN(copyCache->_lowerAgeBound, sourceRegion->getLowerAgeBound());
 				copyCache->_upperAgeBound = OMR_MAX(copyCache->_upperAgeBound, sourceRegion->getUpperAgeBound());
 
+				/* only objects which were actually copied count, so an abort or a lost forwarding race leaves nothing to back out */
+				if (NULL != owningContext) {
+					recordNumaTraffic(env, owningContext, reachingContext, objectCopySizeInBytes);
+				}
+
+				if ((_stringDeduplicationAge == (sourceRegion->getLogicalAge() + 1)) && _extensions->stringDeduplicator->isString(J9GC_J9OBJECT_CLAZZ(destinationObjectPtr, env))) {
+					_extensions->stringDeduplicator->addCandidate(env, destinationObjectPtr);
+				}
+
 #if defined(J9VM_GC_LEAF_BITS)
 				if (_extensions->tarokEnableLeafFirstCopying) {
 					copyLeafChildren(env, reservingContext, destinationObjectPtr);
@@ -4159,6 +4311,10 @@ MM_CopyForwardScheme::workThreadGarbageCollect(MM_EnvironmentVLHGC *env)
 	/* flush ownable synchronizer object buffer after rebuild the ownableSynchronizerObjectList during main scan phase */
 	env->getGCEnvironment()->_ownableSynchronizerObjectBuffer->flush(env);
 
+	if (NULL != _extensions->stringDeduplicator) {
+		_extensions->stringDeduplicator->flushCandidates(env);
+	}
+
 	/* No matter what happens, always sum up the gc stats */
 	mergeGCStats(env);
 
@@ -146,11 +146,17 @@ private:
 	bool _dynamicClassUnloadingEnabled;  /**< Local cached value from cycle state for performance reasons (TODO: Reevaluate) */
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 	bool _collectStringConstantsEnabled;  /**< Local cached value which determines whether string constants are roots */
+	UDATA _stringDeduplicationAge; /**< Local cached logical age of the regions into which copied Strings are queued for deduplication (0 if deduplication is disabled) */
 
 	bool _tracingEnabled;  /**< Temporary variable to enable tracing of activity */
 	bool _cacheTracingEnabled;  /**< Temporary variable to enable tracing of activity */
 	MM_AllocationContextTarok *_commonContext;	/**< The common context is used as an opaque token to represent cases where we don't want to relocate objects during NUMA-aware copy-forward since relocating to the common context is currently disabled */
 	MM_CopyForwardCompactGroup *_compactGroupBlock; /**< A block of MM_CopyForwardCompactGroup structs which is subdivided among the GC threads */ 
+	UDATA _managedContextCount; /**< The number of managed allocation contexts, which index the rows and columns of the NUMA traffic tables */
+	UDATA *_numaTrafficBlock; /**< Per-thread tables of bytes copied, indexed by the context owning each object and by the context from which it was reached (NULL if there is only one context, or neither NUMA owner placement nor -Xtgc:numa is enabled) */
+	UDATA *_numaTraffic; /**< Bytes copied by the current collection, indexed like a per-thread table */
+	UDATA *_numaPlacementTraffic; /**< Bytes copied since the placement of each context was last reconsidered, indexed like a per-thread table */
+	UDATA _numaPlacementCollections; /**< The number of collections measured in _numaPlacementTraffic */
 	UDATA _arraySplitSize; /**< The number of elements to be scanned in each array chunk (this determines the degree of parallelization) */
 
 	UDATA _regionSublistContentionThreshold	/**< The number of threads which must be contending on the same region sublist for us to decide that another sublist should be created to alleviate contention (reset at the beginning of every CopyForward task) */;
@@ -908,6 +914,22 @@ private:
 	 */
 	MMINLINE MM_AllocationContextTarok *getContextForHeapAddress(void *address);
 
+	/**
+	 * Record that a copied object was reached from the given context, in the calling thread's NUMA traffic table.
+	 * @param env[in] A GC thread
+	 * @param owningContext[in] The context which owns the region the object was copied from
+	 * @param reachingContext[in] The context suggested for the copy by the object or thread which referenced the object
+	 * @param objectSizeInBytes[in] The size of the object
+	 */
+	MMINLINE void recordNumaTraffic(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *owningContext, MM_AllocationContextTarok *reachingContext, UDATA objectSizeInBytes);
+
+	/**
+	 * Publish the NUMA traffic of the current collection to the allocation contexts and, once every tarokNumaPlacementInterval
+	 * collections, move the copy-forward destination of each context to the NUMA node from which most of its objects were reached.
+	 * @param env[in] The master GC thread
+	 */
+	void updateNumaPlacement(MM_EnvironmentVLHGC *env);
+
 	/**
 	 * Determine the desired copy cache size for the specified compact group for the current thread.
 	 * The size is chosen to balance the opposing problems of fragmentation and contention.
@@ -1056,12 +1078,14 @@ protected:
 	/**
 	 * Checks whether the suggestedContext passed in is a preferred allocation context for
 	 * object relocation. If so the same context is returned if not the object's original context
-	 * is returned.
+	 * is returned.  With -XXgc:tarokEnableNumaOwnerPlacement, objects are instead copied to the
+	 * destination of the context which owns them, unless they are owned by the common context.
 	 * @param[in] suggestedContext The allocation context we intended to copy the object into
 	 * @param[in] objectPtr A pointer to the object being copied
+	 * @param[in] owningContext The context owning the object's region, or NULL if the caller has not looked it up
 	 * @return The reservingContext or the object's owning context if the suggestedContext is not a preferred object relocation context
 	 */
-	MMINLINE MM_AllocationContextTarok *getPreferredAllocationContext(MM_AllocationContextTarok *suggestedContext, J9Object *objectPtr);
+	MMINLINE MM_AllocationContextTarok *getPreferredAllocationContext(MM_AllocationContextTarok *suggestedContext, J9Object *objectPtr, MM_AllocationContextTarok *owningContext);
 
 public:
 
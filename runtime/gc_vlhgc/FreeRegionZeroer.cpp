@@ -0,0 +1,261 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "j9consts.h"
+#include "j9protos.h"
+#include "mmprivatehook.h"
+#include "omrthread.h"
+#include "ModronAssertions.h"
+
+#include "FreeRegionZeroer.hpp"
+
+#include "AllocationContextBalanced.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
+#include "GlobalAllocationManagerTarok.hpp"
+#include "HeapRegionDescriptorVLHGC.hpp"
+
+extern "C" {
+
+void
+freeRegionZeroerGCIncrementEndHook(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	((MM_FreeRegionZeroer *)userData)->notifyRegionsNeeded();
+}
+
+} /* extern "C" */
+
+MM_FreeRegionZeroer *
+MM_FreeRegionZeroer::newInstance(MM_EnvironmentBase *env)
+{
+	MM_FreeRegionZeroer *zeroer = (MM_FreeRegionZeroer *)env->getForge()->allocate(sizeof(MM_FreeRegionZeroer), MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL != zeroer) {
+		new(zeroer) MM_FreeRegionZeroer(env);
+		if (!zeroer->initialize(env)) {
+			zeroer->kill(env);
+			zeroer = NULL;
+		}
+	}
+	return zeroer;
+}
+
+void
+MM_FreeRegionZeroer::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_FreeRegionZeroer::initialize(MM_EnvironmentBase *env)
+{
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_FreeRegionZeroer::monitor")) {
+		return false;
+	}
+
+	J9HookInterface **privateHooks = J9_HOOK_INTERFACE(_extensions->privateHookInterface);
+	if (0 != (*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_END, freeRegionZeroerGCIncrementEndHook, OMR_GET_CALLSITE(), this)) {
+		return false;
+	}
+
+	return true;
+}
+
+void
+MM_FreeRegionZeroer::tearDown(MM_EnvironmentBase *env)
+{
+	J9HookInterface **privateHooks = J9_HOOK_INTERFACE(_extensions->privateHookInterface);
+	(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_END, freeRegionZeroerGCIncrementEndHook, this);
+
+	if (NULL != _monitor) {
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+}
+
+/**
+ * Start the thread which zeroes free regions. It runs at normal priority, since a collection may have to wait for it
+ * to reach the end of a chunk before it can proceed.
+ * @return true if the thread was started, false otherwise
+ */
+bool
+MM_FreeRegionZeroer::startThread(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_monitor);
+
+	IDATA result = _javaVM->internalVMFunctions->createThreadWithCategory(
+						NULL,
+						_javaVM->defaultOSStackSize,
+						J9THREAD_PRIORITY_NORMAL,
+						0,
+						&threadProc,
+						this,
+						J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+
+	if (0 != result) {
+		omrthread_monitor_exit(_monitor);
+		return false;
+	}
+
+	while (thread_not_started == _threadState) {
+		omrthread_monitor_wait(_monitor);
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return thread_running == _threadState;
+}
+
+/**
+ * Ask the thread to exit and wait for it to do so.
+ */
+void
+MM_FreeRegionZeroer::stopThread(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_monitor);
+	if (thread_running == _threadState) {
+		_threadState = thread_stopping;
+		omrthread_monitor_notify_all(_monitor);
+		while (thread_stopped != _threadState) {
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+void
+MM_FreeRegionZeroer::notifyRegionsNeeded()
+{
+	/* the thread clears the flag before it looks for regions, so a request seen as pending will still be served */
+	if (!_workAvailable) {
+		omrthread_monitor_enter(_monitor);
+		_workAvailable = true;
+		omrthread_monitor_notify(_monitor);
+		omrthread_monitor_exit(_monitor);
+	}
+}
+
+int J9THREAD_PROC
+MM_FreeRegionZeroer::threadProc(void *zeroer)
+{
+	((MM_FreeRegionZeroer *)zeroer)->threadLoop();
+	/* not reached */
+	return 0;
+}
+
+/**
+ * Main loop of the thread. Waits to be notified, then zeroes regions until the contexts need no more.
+ */
+void
+MM_FreeRegionZeroer::threadLoop()
+{
+	J9InternalVMFunctions *vmFuncs = _javaVM->internalVMFunctions;
+	J9VMThread *vmThread = NULL;
+
+	IDATA rc = vmFuncs->attachSystemDaemonThread(_javaVM, &vmThread, "Free Region Zeroer");
+
+	omrthread_monitor_enter(_monitor);
+	if (JNI_OK != rc) {
+		_threadState = thread_stopped;
+		omrthread_monitor_notify_all(_monitor);
+		omrthread_exit(_monitor);
+	}
+	_vmThread = vmThread;
+	_threadState = thread_running;
+	omrthread_monitor_notify_all(_monitor);
+
+	while (thread_running == _threadState) {
+		if (!_workAvailable) {
+			omrthread_monitor_wait(_monitor);
+		}
+		_workAvailable = false;
+		omrthread_monitor_exit(_monitor);
+
+		vmFuncs->internalAcquireVMAccess(vmThread);
+		zeroRegions();
+		vmFuncs->internalReleaseVMAccess(vmThread);
+
+		omrthread_monitor_enter(_monitor);
+	}
+	omrthread_monitor_exit(_monitor);
+
+	_vmThread = NULL;
+	vmFuncs->DetachCurrentThread((JavaVM *)_javaVM);
+
+	omrthread_monitor_enter(_monitor);
+	_threadState = thread_stopped;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
+
+void
+MM_FreeRegionZeroer::zeroRegions()
+{
+	J9InternalVMFunctions *vmFuncs = _javaVM->internalVMFunctions;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(_vmThread->omrVMThread);
+	MM_GlobalAllocationManagerTarok *allocationManager = (MM_GlobalAllocationManagerTarok *)_extensions->globalAllocationManager;
+	UDATA contextCount = allocationManager->getManagedAllocationContextCount();
+
+	/* zero one region per context at a time so that every context is replenished evenly */
+	bool zeroedRegion = true;
+	while (zeroedRegion && (thread_running == _threadState)) {
+		zeroedRegion = false;
+		for (UDATA i = 0; (i < contextCount) && (thread_running == _threadState); i++) {
+			MM_AllocationContextBalanced *context = (MM_AllocationContextBalanced *)allocationManager->getAllocationContextByIndex(i);
+			MM_HeapRegionDescriptorVLHGC *region = context->acquireFreeRegionToZero(env);
+			if (NULL != region) {
+				if (zeroRegion(region)) {
+					context->addZeroedRegionToFreeList(env, region);
+					zeroedRegion = true;
+				} else {
+					/* another thread wants VM access, so give the region back as it is rather than make it wait */
+					context->returnUnzeroedRegionToFreeList(env, region);
+				}
+
+				/* the region is back on a list, so a collection may now proceed */
+				if (J9_ARE_ANY_BITS_SET(_vmThread->publicFlags, J9_PUBLIC_FLAGS_HALT_THREAD_ANY)) {
+					vmFuncs->internalReleaseVMAccess(_vmThread);
+					vmFuncs->internalAcquireVMAccess(_vmThread);
+					zeroedRegion = true;
+				}
+			}
+		}
+	}
+}
+
+bool
+MM_FreeRegionZeroer::zeroRegion(MM_HeapRegionDescriptorVLHGC *region)
+{
+	U_8 *chunk = (U_8 *)region->getLowAddress();
+	U_8 *end = (U_8 *)region->getHighAddress();
+
+	while (chunk < end) {
+		if (J9_ARE_ANY_BITS_SET(_vmThread->publicFlags, J9_PUBLIC_FLAGS_HALT_THREAD_ANY)) {
+			return false;
+		}
+		UDATA chunkSize = OMR_MIN((UDATA)FREE_REGION_ZEROING_CHUNK_SIZE, (UDATA)(end - chunk));
+		OMRZeroMemory(chunk, chunkSize);
+		chunk += chunkSize;
+	}
+	return true;
+}
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(FREEREGIONZEROER_HPP_)
+#define FREEREGIONZEROER_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#include "BaseNonVirtual.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
+
+class MM_HeapRegionDescriptorVLHGC;
+
+#define FREE_REGION_ZEROING_CHUNK_SIZE (64 * 1024) /* bytes zeroed between checks for a request to release VM access */
+
+extern "C" {
+/**
+ * Hook "J9HOOK_MM_PRIVATE_GC_INCREMENT_END" callback function
+ * Wakes up the zeroing thread, since the increment may have freed regions
+ */
+void freeRegionZeroerGCIncrementEndHook(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+}
+
+/**
+ * Zeroes free regions ahead of arraylet leaf allocation.
+ *
+ * An arraylet leaf takes a whole FREE region, which the allocating thread would otherwise have to zero before
+ * returning. A background thread keeps up to tarokZeroedFreeRegionTarget zeroed regions in each allocation context,
+ * which prefers them when it hands out a region for a leaf. When no zeroed region is available the allocating thread
+ * zeroes the region itself, as before.
+ *
+ * The thread zeroes each region with VM access, having taken it off the free list of its context, so a collection never
+ * sees a region which is neither in a list nor in use. It zeroes the region a chunk at a time and, if another thread asks
+ * for VM access in the meantime, puts the region back on the free list unfinished before releasing access.
+ */
+class MM_FreeRegionZeroer : public MM_BaseNonVirtual
+{
+private:
+	enum ThreadState {
+		thread_not_started = 0,
+		thread_running,
+		thread_stopping,
+		thread_stopped
+	};
+
+	J9JavaVM *_javaVM;
+	MM_GCExtensions *_extensions;
+	omrthread_monitor_t _monitor; /**< protects the thread state and is used to wake up the thread */
+	volatile ThreadState _threadState;
+	volatile bool _workAvailable; /**< set when regions may have been freed or zeroed regions consumed */
+	J9VMThread *_vmThread; /**< the thread, while it is attached */
+
+	/**
+	 * Zero free regions, visiting the allocation contexts in turn, until each has tarokZeroedFreeRegionTarget zeroed
+	 * regions or no more free regions to spare. Called by the thread with VM access, which is released whenever another
+	 * thread asks for it to be.
+	 */
+	void zeroRegions();
+
+	/**
+	 * Zero a region taken off a free list, FREE_REGION_ZEROING_CHUNK_SIZE bytes at a time.
+	 * @param region[in] The region to zero
+	 * @return true if the whole region was zeroed, false if another thread asked for VM access first
+	 */
+	bool zeroRegion(MM_HeapRegionDescriptorVLHGC *region);
+
+	static int J9THREAD_PROC threadProc(void *zeroer);
+	void threadLoop();
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_FreeRegionZeroer *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	bool startThread(MM_EnvironmentBase *env);
+	void stopThread(MM_EnvironmentBase *env);
+
+	/**
+	 * Wake up the thread to replenish the zeroed regions. Called when an arraylet leaf is allocated and when a
+	 * collection increment ends.
+	 */
+	void notifyRegionsNeeded();
+
+	MM_FreeRegionZeroer(MM_EnvironmentBase *env)
+		: MM_BaseNonVirtual()
+		, _javaVM((J9JavaVM *)env->getOmrVM()->_language_vm)
+		, _extensions(MM_GCExtensions::getExtensions(env))
+		, _monitor(NULL)
+		, _threadState(thread_not_started)
+		, _workAvailable(true)
+		, _vmThread(NULL)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* FREEREGIONZEROER_HPP_ */
@@ -43,6 +43,7 @@ MM_HeapRegionDataForAllocate::MM_HeapRegionDataForAllocate(MM_EnvironmentVLHGC *
 	, _previousInList(NULL)
 	, _owningContext(NULL)
 	, _originalOwningContext(NULL)
+	, _zeroed(false)
 	, _region(NULL)
 	, _nextArrayletLeafRegion(NULL)
 	, _previousArrayletLeafRegion(NULL)
@@ -91,6 +92,8 @@ MM_HeapRegionDataForAllocate::taskAsMemoryPoolBumpPointer(MM_EnvironmentBase *en
 		UDATA minimumFreeEntrySize = MM_GCExtensions::getExtensions(env)->getMinimumFreeEntrySize();
 		new (memoryPool) MM_MemoryPoolBumpPointer(env, minimumFreeEntrySize);
 		if (memoryPool->initialize(env)) {
+			/* objects will be allocated in the region so it will not stay zeroed */
+			_zeroed = false;
 			_region->setMemoryPool(memoryPool);
 			_region->setRegionType(MM_HeapRegionDescriptor::BUMP_ALLOCATED);
 			_region->_allocateData._owningContext = context;
@@ -123,6 +126,7 @@ MM_HeapRegionDataForAllocate::taskAsFreePool(MM_EnvironmentBase *env)
 
 	_region->setRegionType(MM_HeapRegionDescriptor::FREE);
 	_region->_allocateData._owningContext = NULL;
+	_zeroed = false;
 	/* set _projectedLiveBytes to 'uninitialized' value. it will be initialized at the beginning of the first PGC */
 	_region->_projectedLiveBytes = UDATA_MAX;
 	_region->_projectedLiveBytesDeviation = 0;
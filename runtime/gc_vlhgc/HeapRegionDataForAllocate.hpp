@@ -47,6 +47,7 @@ public:
 	MM_HeapRegionDescriptorVLHGC *_previousInList; /**< Used by MM_RegionListTarok to track which descriptors are in the list (previous pointer in linked list) */
 	MM_AllocationContextTarok *_owningContext;	/**< A pointer to the allocation context which currently owns (that is, the only one which can allocate from it) this region.  NULL if unowned */
 	MM_AllocationContextTarok *_originalOwningContext;	/**< A pointer to the allocation context from which this region was stolen.  NULL if not stolen (either unowned or owned by a context on its native node) */
+	bool _zeroed; /**< True if the receiver is FREE and its memory was zeroed by the MM_FreeRegionZeroer, so that it need not be zeroed again when it becomes an arraylet leaf */
 protected:
 private:
 	MM_HeapRegionDescriptorVLHGC *_region;
@@ -36,7 +36,7 @@
 extern "C" {
 #endif
 
-#define J9_RAS_IS_METHOD_TRACED(flags)  (( flags & (J9_RAS_METHOD_TRACING|J9_RAS_METHOD_TRIGGERING) ))
+#define J9_RAS_IS_METHOD_TRACED(flags)  (( flags & (J9_RAS_METHOD_TRACING|J9_RAS_METHOD_TRIGGERING|J9_RAS_METHOD_SAMPLING) ))
 #define UTSINTERFACEFROMVM(vm) ((J9UtServerInterface *)((UtInterface *)((RasGlobalStorage *)vm->j9rasGlobalStorage)->utIntf)->server)
 
 #define UTSI_TRACEMETHODENTER_FROMVM(vm, thr, method, receiverAddress, methodType) \
@@ -525,7 +525,9 @@ jitMethodEnterTracingEnabled(J9VMThread *currentThread, J9Method *method)
 {
 	J9JavaVM *vm = currentThread->javaVM;
 
-	if (vm->extendedRuntimeFlags & J9_EXTENDED_RUNTIME_METHOD_TRACE_ENABLED) {
+	if ((vm->extendedRuntimeFlags & J9_EXTENDED_RUNTIME_METHOD_TRACE_ENABLED)
+		|| (vm->extendedRuntimeFlags2 & J9_EXTENDED_RUNTIME2_METHOD_TRACE_SAMPLING)
+	) {
 		U_8 *pmethodflags = fetchMethodExtendedFlagsPointer(method);
 		if (J9_RAS_IS_METHOD_TRACED(*pmethodflags)) {
 			return TRUE;
@@ -545,7 +547,9 @@ jitMethodExitTracingEnabled(J9VMThread *currentThread, J9Method *method)
 {
 	J9JavaVM *vm = currentThread->javaVM;
 
-	if (vm->extendedRuntimeFlags & J9_EXTENDED_RUNTIME_METHOD_TRACE_ENABLED) {
+	if ((vm->extendedRuntimeFlags & J9_EXTENDED_RUNTIME_METHOD_TRACE_ENABLED)
+		|| (vm->extendedRuntimeFlags2 & J9_EXTENDED_RUNTIME2_METHOD_TRACE_SAMPLING)
+	) {
 		U_8 *pmethodflags = fetchMethodExtendedFlagsPointer(method);
 		if (J9_RAS_IS_METHOD_TRACED(*pmethodflags)) {
 			return TRUE;
@@ -111,6 +111,8 @@ J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved)
 			}
 
 			vm->jniFunctionTable = GLOBAL_TABLE(JNICheckTable);
+			/* Deleted global refs must leave the pools immediately to be reported as invalid */
+			vm->extendedRuntimeFlags2 &= ~J9_EXTENDED_RUNTIME2_JNI_GLOBAL_REF_THREAD_CACHE;
 			if (omrthread_tls_alloc(&jniEntryCountKey)) {
 				return J9VMDLLMAIN_FAILED;
 			}
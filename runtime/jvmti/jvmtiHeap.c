@@ -77,6 +77,20 @@ typedef enum J9JVMTIHeapIterationFlags {
 } J9JVMTIHeapIterationFlags;
  
 
+/* Tag changes made by callbacks running on GC worker threads, applied once the walk completes */
+typedef struct J9JVMTIHeapTagUpdate {
+	j9object_t         object;
+	jlong              tag;            /** 0 to remove the tag */
+} J9JVMTIHeapTagUpdate;
+
+typedef struct J9JVMTIHeapTagBatch {
+	J9JVMTIHeapTagUpdate * updates;
+	UDATA              count;
+	UDATA              capacity;
+} J9JVMTIHeapTagBatch;
+
+#define J9JVMTI_HEAP_TAG_BATCH_INITIAL_CAPACITY 64
+
 typedef struct J9JVMTIHeapData {
 	J9JVMTIEnv       * env;
 	J9VMThread       * currentThread;
@@ -96,6 +110,8 @@ typedef struct J9JVMTIHeapData {
 	jvmtiHeapTags	 tags;
 
 	const jvmtiHeapCallbacks *callbacks;
+
+	J9JVMTIHeapTagBatch * tagBatch;    /** when non-NULL, tag changes are recorded here instead of updating the tag table */
 } J9JVMTIHeapData;
 
 
@@ -104,6 +120,9 @@ typedef struct J9JVMTIHeapData {
 static UDATA copyObjectTags (J9JVMTIObjectTag * entry, J9JVMTIObjectTagMatch * results);
 static UDATA countObjectTags (J9JVMTIObjectTag * entry, J9JVMTIObjectTagMatch * results);
 static jvmtiIterationControl iterateThroughHeapCallback(J9JavaVM * vm, J9MM_IterateObjectDescriptor *objectDesc, void * userData);
+static jvmtiIterationControl iterateThroughHeapParallelCallback(J9JavaVM * vm, J9MM_IterateObjectDescriptor *objectDesc, UDATA workerID, void * userData);
+static jvmtiError iterateThroughHeapParallel(J9JavaVM * vm, J9JVMTIHeapData * iteratorData);
+static jvmtiError applyObjectTagBatch(J9JVMTIEnv * env, J9JVMTIHeapTagBatch * batch);
 
 static jvmtiIterationControl wrap_heapReferenceCallback(J9JavaVM * vm, J9JVMTIHeapData * iteratorData);
 static jvmtiIterationControl wrap_heapIterationCallback(J9JavaVM * vm, J9JVMTIHeapData * iteratorData);
@@ -1308,6 +1327,7 @@ jvmtiError JNICALL jvmtiIterateThroughHeap(jvmtiEnv* env,
 		iteratorData.userData = (void *) user_data;
 		iteratorData.clazz = 0;
 		iteratorData.rc = JVMTI_ERROR_NONE;
+		iteratorData.tagBatch = NULL;
 	     
 		/* Do not report anything if the class filter set by the user is an interface class.  Quote from the spec:
 		 * "If klass is an interface, no objects are reported. This applies to both the object and primitive callbacks." 
@@ -1322,8 +1342,14 @@ jvmtiError JNICALL jvmtiIterateThroughHeap(jvmtiEnv* env,
 		ensureHeapWalkable(currentThread);
 
 		/* Walk the heap */
-		vm->memoryManagerFunctions->j9mm_iterate_all_objects(vm, vm->portLibrary, 0, iterateThroughHeapCallback, &iteratorData);
-		rc = iteratorData.rc;
+		if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_PARALLEL_JVMTI_HEAP_ITERATION)
+			&& (1 < vm->memoryManagerFunctions->j9mm_get_parallel_iteration_thread_count(vm))
+		) {
+			rc = iterateThroughHeapParallel(vm, &iteratorData);
+		} else {
+			vm->memoryManagerFunctions->j9mm_iterate_all_objects(vm, vm->portLibrary, 0, iterateThroughHeapCallback, &iteratorData);
+			rc = iteratorData.rc;
+		}
 
 		vmFuncs->releaseExclusiveVMAccess(currentThread);
 
@@ -1338,6 +1364,119 @@ done:
 
 
 
+/**
+ * \brief      Walk the heap on the GC worker threads
+ * \ingroup    jvmti.heap
+ *
+ * Each worker reports the objects of the regions it claims using its own copy of the
+ * iteration data. The tag table is only read during the walk: tag changes made by the
+ * callbacks are batched per worker and applied by the calling thread afterwards.
+ * The caller must have exclusive VM access.
+ *
+ * @param[in] vm
+ * @param[in] iteratorData   iteration data set up by the caller
+ * @return                   a jvmtiError value
+ */
+static jvmtiError
+iterateThroughHeapParallel(J9JavaVM * vm, J9JVMTIHeapData * iteratorData)
+{
+	UDATA workerCount = vm->memoryManagerFunctions->j9mm_get_parallel_iteration_thread_count(vm);
+	J9JVMTIHeapData * workerData = NULL;
+	J9JVMTIHeapTagBatch * batches = NULL;
+	jvmtiError rc = JVMTI_ERROR_NONE;
+	UDATA i = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	workerData = j9mem_allocate_memory(workerCount * sizeof(J9JVMTIHeapData), J9MEM_CATEGORY_JVMTI);
+	batches = j9mem_allocate_memory(workerCount * sizeof(J9JVMTIHeapTagBatch), J9MEM_CATEGORY_JVMTI);
+	if ((NULL == workerData) || (NULL == batches)) {
+		rc = JVMTI_ERROR_OUT_OF_MEMORY;
+		goto done;
+	}
+
+	memset(batches, 0, workerCount * sizeof(J9JVMTIHeapTagBatch));
+	for (i = 0; i < workerCount; ++i) {
+		workerData[i] = *iteratorData;
+		workerData[i].tagBatch = &batches[i];
+	}
+
+	vm->memoryManagerFunctions->j9mm_iterate_all_objects_parallel(iteratorData->currentThread, 0, iterateThroughHeapParallelCallback, workerData);
+
+	/* Apply the tag changes in worker order, reporting the first error seen */
+	for (i = 0; i < workerCount; ++i) {
+		jvmtiError batchRc = applyObjectTagBatch(iteratorData->env, &batches[i]);
+		if (JVMTI_ERROR_NONE == rc) {
+			rc = workerData[i].rc;
+		}
+		if (JVMTI_ERROR_NONE == rc) {
+			rc = batchRc;
+		}
+		j9mem_free_memory(batches[i].updates);
+	}
+
+done:
+	j9mem_free_memory(batches);
+	j9mem_free_memory(workerData);
+	return rc;
+}
+
+
+
+/**
+ * \brief      Parallel heap iteration callback
+ * \ingroup    jvmti.heap
+ *
+ * @param[in] vm
+ * @param[in] objectDesc  object being iterated over
+ * @param[in] workerID    index of the iteration data of the calling worker thread
+ * @param[in] userData    array of <code>J9JVMTIHeapData</code>, one per worker thread
+ * @return                JVMTI_ITERATION_ABORT to stop every worker, JVMTI_ITERATION_CONTINUE otherwise
+ */
+static jvmtiIterationControl
+iterateThroughHeapParallelCallback(J9JavaVM * vm, J9MM_IterateObjectDescriptor *objectDesc, UDATA workerID, void * userData)
+{
+	J9JVMTIHeapData * workerData = userData;
+	return iterateThroughHeapCallback(vm, objectDesc, &workerData[workerID]);
+}
+
+
+
+/**
+ * \brief      Apply the tag changes recorded during a parallel heap walk
+ * \ingroup    jvmti.heap
+ *
+ * @param[in] env     jvmti environment owning the tag table
+ * @param[in] batch   tag changes, in the order they were made
+ * @return            JVMTI_ERROR_OUT_OF_MEMORY if a tag could not be added, JVMTI_ERROR_NONE otherwise
+ */
+static jvmtiError
+applyObjectTagBatch(J9JVMTIEnv * env, J9JVMTIHeapTagBatch * batch)
+{
+	jvmtiError rc = JVMTI_ERROR_NONE;
+	UDATA i = 0;
+
+	for (i = 0; i < batch->count; ++i) {
+		J9JVMTIObjectTag entry;
+		J9JVMTIObjectTag *resultTag = NULL;
+
+		entry.ref = batch->updates[i].object;
+		entry.tag = batch->updates[i].tag;
+		if (0 == entry.tag) {
+			hashTableRemove(env->objectTagTable, &entry);
+		} else {
+			resultTag = hashTableFind(env->objectTagTable, &entry);
+			if (NULL != resultTag) {
+				resultTag->tag = entry.tag;
+			} else if (NULL == hashTableAdd(env->objectTagTable, &entry)) {
+				rc = JVMTI_ERROR_OUT_OF_MEMORY;
+			}
+		}
+	}
+	return rc;
+}
+
+
+
 /** 
  * \brief      Heap Iteration callback
  * \ingroup    jvmti.heap
@@ -1999,7 +2138,30 @@ updateObjectTag(J9JVMTIHeapData * iteratorData, j9object_t object, jlong *origin
 {
 	J9JVMTIObjectTag entry;
 	J9JVMTIObjectTag *resultTag;
-	
+	J9JVMTIHeapTagBatch *batch = iteratorData->tagBatch;
+
+	if (NULL != batch) {
+		/* Other threads are reading the tag table, record the change for later */
+		if (*originalTag != newTag) {
+			if (batch->count == batch->capacity) {
+				PORT_ACCESS_FROM_JAVAVM(iteratorData->env->vm);
+				UDATA newCapacity = (0 == batch->capacity) ? J9JVMTI_HEAP_TAG_BATCH_INITIAL_CAPACITY : (batch->capacity * 2);
+				J9JVMTIHeapTagUpdate *updates = j9mem_reallocate_memory(batch->updates, newCapacity * sizeof(J9JVMTIHeapTagUpdate), J9MEM_CATEGORY_JVMTI);
+				if (NULL == updates) {
+					iteratorData->rc = JVMTI_ERROR_OUT_OF_MEMORY;
+					return;
+				}
+				batch->updates = updates;
+				batch->capacity = newCapacity;
+			}
+			batch->updates[batch->count].object = object;
+			batch->updates[batch->count].tag = newTag;
+			batch->count += 1;
+			*originalTag = newTag;
+		}
+		return;
+	}
+
 	/* The callback could have added or removed the tag. Modify the hashtable entry to
 	 * account for it */
 	if (*originalTag != 0) {
@@ -1216,7 +1216,9 @@ done:
 	methodBeingTraced(J9JavaVM *vm, J9Method *method)
 	{
 		bool rc = false;
-		if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_METHOD_TRACE_ENABLED)) {
+		if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_METHOD_TRACE_ENABLED)
+		|| J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_METHOD_TRACE_SAMPLING)
+		) {
 			U_8 *pmethodflags = fetchMethodExtendedFlagsPointer(method);
 			if (J9_RAS_IS_METHOD_TRACED(*pmethodflags)) {
 				rc = true;
@@ -1616,6 +1618,61 @@ exit:
 			&& (ramClass->romClass->majorVersion >= 53);
 	}
 
+	/**
+	 * Walk the stack of the current thread to fill in the walkback of a Throwable.
+	 *
+	 * When -XX:StackTraceThrowSiteLimit=<n> is in effect and limitDepth is true, only
+	 * the top J9_THROW_SITE_LIMITED_FRAMES frames are walked at first. The stack is walked
+	 * again completely unless the throw site has already produced n complete traces.
+	 *
+	 * @param currentThread[in] the current J9VMThread
+	 * @param walkState[in] the walk state, with restartException set if exception frames are hidden
+	 * @param walkFlags[in] the flags of the walk
+	 * @param limitDepth[in] true if the walkback may be truncated
+	 * @return the result of the walk, with the PCs in walkState->cache
+	 */
+	static VMINLINE UDATA
+	walkThrowableStackFrames(J9VMThread *currentThread, J9StackWalkState *walkState, UDATA walkFlags, bool limitDepth)
+	{
+		J9JavaVM *vm = currentThread->javaVM;
+		j9object_t restartException = walkState->restartException;
+		UDATA maxFrames = 0;
+		if (limitDepth && (NULL != vm->throwSiteCounters)) {
+			maxFrames = J9_THROW_SITE_LIMITED_FRAMES;
+		}
+retry:
+		walkState->flags = walkFlags;
+		walkState->skipCount = 1;	// skip the INL frame
+		walkState->walkThread = currentThread;
+		walkState->restartException = restartException;
+		if (0 != maxFrames) {
+			walkState->flags |= J9_STACKWALK_COUNT_SPECIFIED;
+			walkState->maxFrames = maxFrames;
+		}
+		UDATA walkRC = vm->walkStackFrames(currentThread, walkState);
+		if ((J9_STACKWALK_RC_NONE == walkRC) && (0 != maxFrames) && (maxFrames == walkState->framesWalked)) {
+			/* The top frames are the constructors of the Throwable, which every throw shares,
+			 * so the site is identified by the PCs of all the frames walked so far.
+			 */
+			UDATA site = 0;
+			for (UDATA i = 0; i < maxFrames; ++i) {
+				site = (site * 31) + walkState->cache[i];
+			}
+			J9ThrowSiteCounter *counter = &vm->throwSiteCounters[((site >> 2) ^ (site >> 12)) & (J9_THROW_SITE_TABLE_SIZE - 1)];
+			if (site != counter->site) {
+				counter->site = site;
+				counter->count = 0;
+			}
+			if (counter->count < vm->stackTraceThrowSiteLimit) {
+				counter->count += 1;
+				vm->internalVMFunctions->freeStackWalkCaches(currentThread, walkState);
+				maxFrames = 0;
+				goto retry;
+			}
+		}
+		return walkRC;
+	}
+
 	/**
 	 * Filter out the initialMethods use to initialize constantpool entries
 	 * as the methods aren't real Java methods and shouldn't be exposed to
@@ -331,6 +331,9 @@ extern "C" {
 #define J9_EXTENDED_RUNTIME2_ENABLE_DEEPSCAN 0x10
 #define J9_EXTENDED_RUNTIME2_ENABLE_CLASS_RELATIONSHIP_VERIFIER 0x20
 #define J9_EXTENDED_RUNTIME2_ENABLE_START_JITSERVER 0x40
+#define J9_EXTENDED_RUNTIME2_JNI_GLOBAL_REF_THREAD_CACHE 0x80
+#define J9_EXTENDED_RUNTIME2_METHOD_TRACE_SAMPLING 0x100
+#define J9_EXTENDED_RUNTIME2_PARALLEL_JVMTI_HEAP_ITERATION 0x200
 
 
 /* TODO: Define this until the JIT removes it */
@@ -668,7 +671,9 @@ extern "C" {
 #define J9_RAS_METHOD_TRACING 0x2
 #define J9_RAS_METHOD_TRACE_ARGS 0x4
 #define J9_RAS_METHOD_TRIGGERING 0x8
-#define J9_RAS_MASK 0xF
+#define J9_RAS_METHOD_SAMPLING 0x10
+#define J9_RAS_METHOD_SAMPLE_NAMED 0x20
+#define J9_RAS_MASK 0x3F
 
 #define J9_JNI_OFFLOAD_SWITCH_CREATE_JAVA_VM 0x1
 #define J9_JNI_OFFLOAD_SWITCH_DEALLOCATE_VM_THREAD 0x2
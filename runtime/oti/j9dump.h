@@ -36,6 +36,9 @@ typedef struct RasDumpGlobalStorage {
 	
 	UDATA noProtect; /* If set, do not take dumps under their own signal handler */
 	UDATA noFailover; /* If set, do not failover to /tmp etc if unable to write dump */
+
+	omrthread_monitor_t deferredJavadumpMutex;
+	UDATA deferredJavadumpCount; /* Javadumps still being formatted by a background thread */
 } RasDumpGlobalStorage;
 
 struct J9RASdumpAgent; /* Forward struct declaration */
@@ -123,6 +126,7 @@ typedef struct J9RASdumpAgent {
 #define J9RAS_DUMP_DO_ATTACH_THREAD  32
 #define J9RAS_DUMP_DO_MULTIPLE_HEAPS  64
 #define J9RAS_DUMP_DO_PREEMPT_THREADS  0x80
+#define J9RAS_DUMP_DO_DEFER_FORMATTING  0x100
 
 typedef struct J9RASdumpContext {
 	struct J9JavaVM* javaVM;
@@ -79,6 +79,7 @@
 #define J9ClassIsExemptFromValidation 0x2000
 #define J9ClassContainsUnflattenedFlattenables 0x4000
 #define J9ClassCanSupportFastSubstitutability 0x8000
+#define J9ClassPretenured 0x10000
 
 /* @ddr_namespace: map_to_type=J9FieldFlags */
 
@@ -2974,6 +2975,7 @@ typedef struct J9Class {
 	struct J9JITExceptionTable* jitMetaDataList;
 	struct J9Class* gcLink;
 	struct J9Class* hostClass;
+	UDATA classNameHash;
 #if defined(J9VM_OPT_VALHALLA_NESTMATES)
 	struct J9Class* nestHost;
 #endif /* defined(J9VM_OPT_VALHALLA_NESTMATES) */
@@ -3047,6 +3049,7 @@ typedef struct J9ArrayClass {
 	struct J9JITExceptionTable* jitMetaDataList;
 	struct J9Class* gcLink;
 	struct J9Class* hostClass;
+	UDATA classNameHash;
 #if defined(J9VM_OPT_VALHALLA_NESTMATES)
 	struct J9Class* nestHost;
 #endif /* defined(J9VM_OPT_VALHALLA_NESTMATES) */
@@ -3401,6 +3404,166 @@ typedef struct J9ITable {
 	struct J9ITable* next;
 } J9ITable;
 
+#define J9_INTERP_CALL_SITE_CACHE_ENTRIES 2
+#define J9_INTERP_CALL_SITE_CACHE_SIZE 2048
+#define J9_INTERP_ITABLE_CACHE_SIZE 1024
+#define J9_INTERP_ITABLE_CACHE_DEPTH 4
+#define J9_INTERP_INLINE_CACHE_BUSY ((UDATA)1)
+
+/* Interpreter inline cache for one invokeinterface call site. The site is identified
+ * by the address of its J9RAMInterfaceMethodRef. Slots are filled once and are only
+ * cleared (with exclusive VM access) when classes are unloaded or redefined.
+ */
+typedef struct J9InterpreterCallSiteCache {
+	UDATA callSite;
+	UDATA receiverClass[J9_INTERP_CALL_SITE_CACHE_ENTRIES];
+	struct J9Method* method[J9_INTERP_CALL_SITE_CACHE_ENTRIES];
+} J9InterpreterCallSiteCache;
+
+/* iTable lookup cache keyed by receiver class and interface class, used for receivers
+ * whose iTable chain is deeper than J9_INTERP_ITABLE_CACHE_DEPTH.
+ */
+typedef struct J9InterpreterITableCacheEntry {
+	UDATA receiverClass;
+	struct J9Class* interfaceClass;
+	struct J9ITable* iTable;
+} J9InterpreterITableCacheEntry;
+
+#define J9_THROW_SITE_TABLE_SIZE 1024
+#define J9_THROW_SITE_LIMITED_FRAMES 8
+
+/* Number of complete stack traces recorded for a throw site, identified by a hash
+ * of the walkback PCs of the top J9_THROW_SITE_LIMITED_FRAMES frames. Updates are
+ * not atomic, the counts only decide how much of the stack is recorded.
+ */
+typedef struct J9ThrowSiteCounter {
+	UDATA site;
+	UDATA count;
+} J9ThrowSiteCounter;
+
+#define J9_JNI_GLOBAL_REF_CACHE_SIZE 32
+#define J9_JNI_GLOBAL_REF_CACHE_BATCH 16
+#define J9_JNI_GLOBAL_REF_CACHE_STRONG 0
+#define J9_JNI_GLOBAL_REF_CACHE_WEAK 1
+
+/* Free JNI global and weak global reference slots owned by a thread. The slots
+ * are allocated from, and returned to, the VM pools in batches under the
+ * jniFrameMutex and hold NULL while they are cached.
+ */
+typedef struct J9JNIGlobalRefCache {
+	UDATA count[2];
+	j9object_t* slots[2][J9_JNI_GLOBAL_REF_CACHE_SIZE];
+} J9JNIGlobalRefCache;
+
+#define J9_STACKMAP_CACHE_SIZE 2048
+#define J9_STACKMAP_CACHE_MAX_SLOTS 64
+#define J9_STACKMAP_CACHE_LOCALS 0
+#define J9_STACKMAP_CACHE_STACK 1
+
+/* Object slot bits computed by the local or stack mapper for one bytecode PC. The
+ * sequence is odd while the entry is being written. Readers treat an odd sequence,
+ * or one which changed while the entry was being copied, as a miss.
+ */
+typedef struct J9StackMapCacheEntry {
+	UDATA sequence;
+	struct J9ROMMethod* romMethod;
+	UDATA offsetPC;
+	UDATA countAndKind;
+	UDATA mapper;
+	U_32 bits[J9_STACKMAP_CACHE_MAX_SLOTS / 32];
+} J9StackMapCacheEntry;
+
+typedef struct J9StackMapCache {
+	J9StackMapCacheEntry entries[J9_STACKMAP_CACHE_SIZE];
+	UDATA collectStats;
+	UDATA hits;
+	UDATA misses;
+	UDATA uncacheable;
+	UDATA flushes;
+} J9StackMapCache;
+
+#define J9_FIELD_RESOLUTION_CACHE_SIZE 1024
+
+/* The field a name and signature resolve to when looked up from a class, including
+ * fields inherited from superclasses and static fields of superinterfaces. Entries
+ * use the same sequence protocol as J9StackMapCacheEntry.
+ */
+typedef struct J9FieldResolutionCacheEntry {
+	UDATA sequence;
+	struct J9Class* clazz;
+	UDATA hash;
+	struct J9ROMFieldShape* field;
+	struct J9Class* definingClass;
+	UDATA offsetOrAddress;
+} J9FieldResolutionCacheEntry;
+
+typedef struct J9FieldResolutionCache {
+	J9FieldResolutionCacheEntry entries[J9_FIELD_RESOLUTION_CACHE_SIZE];
+	UDATA collectStats;
+	UDATA hits;
+	UDATA misses;
+	UDATA inherited;
+	UDATA flushes;
+} J9FieldResolutionCache;
+
+#define J9_ALLOCATION_PROFILER_DEFAULT_INTERVAL (512 * 1024)
+#define J9_ALLOCATION_PROFILER_DEFAULT_DEPTH 64
+#define J9_ALLOCATION_PROFILER_MAX_DEPTH 256
+
+/* A method seen in a sampled allocation stack. The method is cleared when its class
+ * is unloaded; the frame and its name live as long as the profiler.
+ */
+typedef struct J9AllocationProfileFrame {
+	struct J9Method* method;
+	char* name;
+	UDATA id;
+} J9AllocationProfileFrame;
+
+/* A node of the call tree of sampled allocation stacks, keyed by its parent and frame.
+ * The root nodes have a NULL parent. The live counters are only valid while a profile
+ * is being written.
+ */
+typedef struct J9AllocationProfileNode {
+	struct J9AllocationProfileNode* parent;
+	struct J9AllocationProfileFrame* frame;
+	UDATA liveCount;
+	UDATA liveBytes;
+} J9AllocationProfileNode;
+
+/* A sampled object. The weak global reference is cleared by the GC when the object dies. */
+typedef struct J9AllocationProfileSample {
+	jobject weakRef;
+	struct J9AllocationProfileNode* node;
+	UDATA size;
+} J9AllocationProfileSample;
+
+typedef struct J9AllocationProfiler {
+	omrthread_monitor_t mutex;
+	struct J9Pool* framePool;
+	struct J9HashTable* frames;
+	struct J9HashTable* nodes;
+	struct J9AllocationProfileSample* samples;
+	UDATA sampleCount;
+	UDATA sampleCapacity;
+	UDATA interval;
+	UDATA maxDepth;
+	UDATA totalSamples;
+	UDATA totalBytes;
+} J9AllocationProfiler;
+
+typedef struct J9InterpreterInlineCaches {
+	J9InterpreterCallSiteCache callSites[J9_INTERP_CALL_SITE_CACHE_SIZE];
+	J9InterpreterITableCacheEntry iTables[J9_INTERP_ITABLE_CACHE_SIZE];
+	UDATA collectStats;
+	UDATA callSiteHits;
+	UDATA callSiteMisses;
+	UDATA callSiteMegamorphic;
+	UDATA callSiteCollisions;
+	UDATA iTableHits;
+	UDATA iTableMisses;
+	UDATA flushes;
+} J9InterpreterInlineCaches;
+
 typedef struct J9VTableHeader {
 	UDATA size;
 	J9Method* initialVirtualMethod;
@@ -4118,6 +4281,8 @@ typedef struct J9MemoryManagerFunctions {
 	I_32  ( *j9gc_get_jit_string_dedup_policy)(struct J9JavaVM *javaVM) ;
 	UDATA ( *j9gc_stringHashFn)(void *key, void *userData);
 	UDATA ( *j9gc_stringHashEqualFn)(void *leftKey, void *rightKey, void *userData);
+	jvmtiIterationControl  ( *j9mm_iterate_all_objects_parallel)(struct J9VMThread *vmThread, UDATA flags, jvmtiIterationControl (*func)(struct J9JavaVM *vm, struct J9MM_IterateObjectDescriptor *object, UDATA workerID, void *userData), void *userData) ;
+	UDATA  ( *j9mm_get_parallel_iteration_thread_count)(struct J9JavaVM *vm) ;
 } J9MemoryManagerFunctions;
 
 typedef struct J9InternalVMFunctions {
@@ -4464,6 +4629,7 @@ typedef struct J9InternalVMFunctions {
 #endif /* J9VM_OPT_JITSERVER */
 	IDATA ( *createJoinableThreadWithCategory)(omrthread_t* handle, UDATA stacksize, UDATA priority, UDATA suspend, omrthread_entrypoint_t entrypoint, void* entryarg, U_32 category) ;
 	BOOLEAN ( *valueTypeCapableAcmp)(struct J9VMThread *currentThread, j9object_t lhs, j9object_t rhs) ;
+	IDATA ( *dumpAllocationProfile)(struct J9VMThread *currentThread, const char *fileName) ;
 } J9InternalVMFunctions;
 
 /* Jazz 99339: define a new structure to replace JavaVM so as to pass J9NativeLibrary to JVMTIEnv  */
@@ -4665,6 +4831,8 @@ typedef struct J9VMThread {
 #endif /* OMR_GC_COMPRESSED_POINTERS */
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	UDATA safePointCount;
+	struct J9JNIGlobalRefCache* jniGlobalRefCache;
+	UDATA methodTraceSampleCount;
 } J9VMThread;
 
 #define J9VMTHREAD_ALIGNMENT  0x100
@@ -4961,6 +5129,7 @@ typedef struct J9JavaVM {
 	void* doubleJITExitInterpreter;
 	char* sigquitToFileDir;
 	UDATA initializeSlotsOnTLHAllocate;
+	UDATA pretenuredAllocationEnabled;
 	UDATA stackWalkVerboseLevel;
 	UDATA whackedPointerCounter;
 	void* j9rasGlobalStorage;
@@ -5042,6 +5211,12 @@ typedef struct J9JavaVM {
 	struct J9HashTable* fieldIndexTable;
 	UDATA fieldIndexThreshold;
 	omrthread_monitor_t fieldIndexMutex;
+	struct J9FieldResolutionCache* fieldResolutionCache;
+	struct J9InterpreterInlineCaches* interpreterInlineCaches;
+	struct J9StackMapCache* stackMapCache;
+	UDATA stackTraceThrowSiteLimit;
+	struct J9ThrowSiteCounter* throwSiteCounters;
+	struct J9AllocationProfiler* allocationProfiler;
 	IDATA  ( *localMapFunction)(struct J9PortLibrary * portLib, struct J9ROMClass * romClass, struct J9ROMMethod * romMethod, UDATA pc, U_32 * resultArrayBase, void * userData, UDATA * (* getBuffer) (void * userData), void (* releaseBuffer) (void * userData)) ;
 	UDATA realtimeHeapMapBasePageRounded;
 	UDATA* realtimeHeapMapBits;
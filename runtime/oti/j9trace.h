@@ -61,6 +61,7 @@ typedef struct RasGlobalStorage {
 	int     stackdepth;
 	unsigned int    stackCompressionLevel;
 	ConfigureTraceFunction configureTraceEngine;
+	unsigned int    methodSampleRate;
 } RasGlobalStorage;
 
 #define RAS_GLOBAL(x) ((RasGlobalStorage *)thr->javaVM->j9rasGlobalStorage)->x 
@@ -471,6 +471,25 @@ enum INIT_STAGE {
 #define VMOPT_XXFORCE_FULL_HEAP_ADDRESS_RANGE_SEARCH "-XX:+ForceFullHeapAddressRangeSearch"
 #define VMOPT_XXNOFORCE_FULL_HEAP_ADDRESS_RANGE_SEARCH "-XX:-ForceFullHeapAddressRangeSearch"
 
+#define VMOPT_XXINTERPRETERINLINECACHES "-XX:+InterpreterInlineCaches"
+#define VMOPT_XXNOINTERPRETERINLINECACHES "-XX:-InterpreterInlineCaches"
+#define VMOPT_XXPRINTINTERPRETERINLINECACHESTATS "-XX:+PrintInterpreterInlineCacheStats"
+#define VMOPT_XXSTACKMAPCACHE "-XX:+StackMapCache"
+#define VMOPT_XXNOSTACKMAPCACHE "-XX:-StackMapCache"
+#define VMOPT_XXPRINTSTACKMAPCACHESTATS "-XX:+PrintStackMapCacheStats"
+#define VMOPT_XXFIELDRESOLUTIONCACHE "-XX:+FieldResolutionCache"
+#define VMOPT_XXNOFIELDRESOLUTIONCACHE "-XX:-FieldResolutionCache"
+#define VMOPT_XXPRINTFIELDRESOLUTIONCACHESTATS "-XX:+PrintFieldResolutionCacheStats"
+#define VMOPT_XXSTACKTRACETHROWSITELIMIT_EQUALS "-XX:StackTraceThrowSiteLimit="
+#define VMOPT_XXJNIGLOBALREFTHREADCACHE "-XX:+JNIGlobalRefThreadCache"
+#define VMOPT_XXNOJNIGLOBALREFTHREADCACHE "-XX:-JNIGlobalRefThreadCache"
+#define VMOPT_XXALLOCATIONPROFILER "-XX:+AllocationProfiler"
+#define VMOPT_XXNOALLOCATIONPROFILER "-XX:-AllocationProfiler"
+#define VMOPT_XXALLOCATIONPROFILERINTERVAL_EQUALS "-XX:AllocationProfilerInterval="
+#define VMOPT_XXALLOCATIONPROFILERDEPTH_EQUALS "-XX:AllocationProfilerDepth="
+#define VMOPT_XXPARALLELJVMTIHEAPITERATION "-XX:+ParallelJVMTIHeapIteration"
+#define VMOPT_XXNOPARALLELJVMTIHEAPITERATION "-XX:-ParallelJVMTIHeapIteration"
+
 #define VMOPT_XXCLASSRELATIONSHIPVERIFIER "-XX:+ClassRelationshipVerifier"
 #define VMOPT_XXNOCLASSRELATIONSHIPVERIFIER "-XX:-ClassRelationshipVerifier"
 
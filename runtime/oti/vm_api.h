@@ -57,6 +57,20 @@ typedef struct J9CreateJavaVMParams {
 	UDATA flags;
 } J9CreateJavaVMParams;
 
+/* ---------------- AllocationProfiler.cpp ---------------- */
+
+/**
+ * Write the live objects sampled by the allocation profiler, in the legacy Java
+ * heapz format read by pprof. The caller must have exclusive VM access.
+ *
+ * @param[in] currentThread the current J9VMThread
+ * @param[in] fileName the file to write
+ *
+ * @return 0 on success, -1 if the profiler is not enabled or the file could not be written
+ */
+IDATA
+dumpAllocationProfile(J9VMThread *currentThread, const char *fileName);
+
 /* ---------------- FastJNI.cpp ---------------- */
 
 /**
@@ -1731,6 +1745,18 @@ J9Class *
 hashClassTableAtString(J9ClassLoader *classLoader, j9object_t stringObject);
 
 
+/**
+* @brief Hash a class or package name so that it matches the hash of the String
+* holding the same name in external ('.' separated) form. The class table uses
+* this as the hash of J9Class->classNameHash.
+* @param *name the modified UTF8 name
+* @param length the length of the name in bytes
+* @return U_32
+*/
+U_32
+hashClassName(const U_8 *name, UDATA length);
+
+
 /**
 * @brief
 * @param *classLoader
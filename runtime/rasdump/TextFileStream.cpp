@@ -31,6 +31,7 @@
 TextFileStream::TextFileStream(J9PortLibrary* portLibrary) :
 	_Buffer(NULL),
 	_IsOpen(false),
+	_InMemory(false),
 	_BufferPos(0),
 	_BufferSize(16*1024),
 	_PortLibrary(portLibrary),
@@ -70,6 +71,37 @@ TextFileStream::open(const char* fileName, bool cacheWrites)
 	}
 }
 
+/* Method for collecting the text in memory, the buffer grows as required */
+bool
+TextFileStream::openMemory(void)
+{
+	_InMemory = (NULL != _Buffer);
+	return _InMemory;
+}
+
+/* Method for getting the length of the text collected in memory */
+UDATA
+TextFileStream::getMemoryLength(void) const
+{
+	return _InMemory ? _BufferPos : 0;
+}
+
+/* Method for taking ownership of the text collected in memory, the caller frees it with j9mem_free_memory */
+char*
+TextFileStream::detachMemory(void)
+{
+	char *memory = NULL;
+
+	if (_InMemory) {
+		memory = _Buffer;
+		_Buffer = NULL;
+		_BufferPos = 0;
+		_BufferSize = 0;
+		_InMemory = false;
+	}
+	return memory;
+}
+
 /* Method for closing the file */
 void 
 TextFileStream::close(void)
@@ -88,6 +120,7 @@ TextFileStream::close(void)
 
 	_FileHandle = -1;	
 	_Error      = false;
+	_InMemory   = false;
 	if(_Buffer) {
 		j9mem_free_memory(_Buffer);
 		_Buffer = NULL;
@@ -97,7 +130,7 @@ TextFileStream::close(void)
 /* Methods for getting the object's status */
 bool TextFileStream::isOpen(void) const
 {
-	return _FileHandle != -1;
+	return (_FileHandle != -1) || _InMemory;
 }
 
 bool TextFileStream::isError(void) const
@@ -110,6 +143,23 @@ void
 TextFileStream::writeCharacters(const char* data, IDATA length)
 {
 	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	if (_InMemory) {
+		if ((_BufferSize - _BufferPos) < (UDATA) length) {
+			/* grow the buffer to at least twice its size */
+			UDATA newSize = OMR_MAX(_BufferSize * 2, _BufferPos + (UDATA) length);
+			char *newBuffer = (char *) j9mem_reallocate_memory(_Buffer, newSize, OMRMEM_CATEGORY_VM);
+			if (NULL == newBuffer) {
+				_Error = true;
+				return;
+			}
+			_Buffer = newBuffer;
+			_BufferSize = newSize;
+		}
+		memcpy(&_Buffer[_BufferPos], data, length);
+		_BufferPos += length;
+		return;
+	}
+
 	/* deal with the simple no-handle and non-cached cases */
 	if(_FileHandle == -1) {
 		return;
@@ -45,9 +45,16 @@ public :
 	/* Method for opening the file */
 	void open(const char* fileName, bool cacheWrites);
 
+	/* Method for collecting the text in memory instead of writing a file */
+	bool openMemory(void);
+
 	/* Method for closing the file */
 	void close(void);
 
+	/* Methods for getting and taking ownership of the text collected in memory */
+	UDATA getMemoryLength(void) const;
+	char* detachMemory(void);
+
 	/* Methods for getting the object's status */
 	bool isOpen(void) const;
 	bool isError(void) const;
@@ -68,6 +75,7 @@ private :
 	TextFileStream& operator=(const TextFileStream& source);
 	char *_Buffer;
 	bool _IsOpen;
+	bool _InMemory;
 	UDATA _BufferPos;
 	UDATA _BufferSize;
 
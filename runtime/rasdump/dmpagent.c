@@ -166,7 +166,8 @@ static const J9RASdumpRequest rasDumpRequests[] =
 	{ "prepwalk",  "DO_PREPARE_HEAP_FOR_WALK",   J9RAS_DUMP_DO_PREPARE_HEAP_FOR_WALK },
 	{ "serial",    "DO_SUSPEND_OTHER_DUMPS",     J9RAS_DUMP_DO_SUSPEND_OTHER_DUMPS },
 	{ "attach",    "DO_ATTACH_THREAD",           J9RAS_DUMP_DO_ATTACH_THREAD },
-	{ "preempt",   "DO_PREEMPT_THREADS",         J9RAS_DUMP_DO_PREEMPT_THREADS }
+	{ "preempt",   "DO_PREEMPT_THREADS",         J9RAS_DUMP_DO_PREEMPT_THREADS },
+	{ "defer",     "DO_DEFER_FORMATTING",        J9RAS_DUMP_DO_DEFER_FORMATTING }
 };
 
 #define J9RAS_DUMP_KNOWN_REQUESTS  ( sizeof(rasDumpRequests) / sizeof(J9RASdumpRequest) )
@@ -204,6 +205,7 @@ static omr_error_t doSnapDump (J9RASdumpAgent *agent, char *label, J9RASdumpCont
 static char scanSign (char **cursor);
 omr_error_t doToolDump (J9RASdumpAgent *agent, char *label, J9RASdumpContext *context);
 static omr_error_t doJitDump(J9RASdumpAgent *agent, char *label, J9RASdumpContext *context);
+static omr_error_t doAllocationProfileDump(J9RASdumpAgent *agent, char *label, J9RASdumpContext *context);
 static char * scanSubFilter(J9JavaVM *vm, const J9RASdumpSettings *settings, const char **cursor, UDATA *actionPtr);
 static omr_error_t doJavaVMExit(J9RASdumpAgent *agent, char *label, J9RASdumpContext *context);
 
@@ -408,6 +410,26 @@ static const J9RASdumpSpec rasDumpSpecs[] =
 		  J9RAS_DUMP_DO_SUSPEND_OTHER_DUMPS,
 		  NULL }
 	},
+	{
+		"allocprofile",
+		"Write live allocation samples for pprof",
+		"file=",
+#if defined(J9ZOS390)
+		"_CEE_DMPTARG",
+#else
+		"IBM_COREDIR",
+#endif
+		"Output file",
+		doAllocationProfileDump,
+		{ 0,
+		  NULL,
+		  1, 0,
+		  "allocprofile.%Y" "%m%d.%H" "%M" "%S.%pid.%seq.prof",
+		  NULL,
+		  250,
+		  J9RAS_DUMP_DO_EXCLUSIVE_VM_ACCESS,
+		  NULL }
+	},
 	{
 		"silent",
 		"Dummy dump agent which does nothing",
@@ -802,6 +824,9 @@ doToolDump(J9RASdumpAgent *agent, char *label, J9RASdumpContext *context)
 
 	j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_REQUESTING_DUMP_STR, "Tool", label);
 
+	/* a tool run on the same event may read a javadump still being written in the background */
+	waitForDeferredJavadumps(vm);
+
 	if ( agent->dumpOptions ) {
 		/* Some tools take longer to run => user-specified pause time */
 		char *buf = strstr(agent->dumpOptions, "WAIT");
@@ -1082,6 +1107,40 @@ doJitDump(J9RASdumpAgent *agent, char *label, J9RASdumpContext *context)
 	return result;
 }
 
+/*
+ * Function: doAllocationProfileDump - writes the live objects sampled by the allocation profiler
+ *
+ * Parameters:
+ *  agent [in]	 - dump agent structure
+ *  label [in]	 - file name
+ *  context [in] - dump context (what triggered the dump)
+ *
+ * Returns: OMR_ERROR_NONE, OMR_ERROR_INTERNAL
+ */
+static omr_error_t
+doAllocationProfileDump(J9RASdumpAgent *agent, char *label, J9RASdumpContext *context)
+{
+	J9JavaVM *vm = context->javaVM;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (NULL == vm->allocationProfiler) {
+		/* -XX:+AllocationProfiler was not specified, so there are no samples to write */
+		j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_DMP_ERROR_IN_DUMP_STR, "Allocation profile", label);
+		return OMR_ERROR_INTERNAL;
+	}
+	if (makePath(vm, label) == OMR_ERROR_INTERNAL) {
+		/* Nowhere available to write the dump, we are done, makePath() will have issued error message */
+		return OMR_ERROR_INTERNAL;
+	}
+	j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_REQUESTING_DUMP_STR, "Allocation profile", label);
+	if (0 != vm->internalVMFunctions->dumpAllocationProfile(vm->internalVMFunctions->currentVMThread(vm), label)) {
+		j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_DMP_ERROR_IN_DUMP_STR, "Allocation profile", label);
+		return OMR_ERROR_INTERNAL;
+	}
+	j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Allocation profile", label);
+	return OMR_ERROR_NONE;
+}
+
 
 static char*
 allocString(J9JavaVM *vm, UDATA numBytes)
@@ -2181,6 +2240,8 @@ printDumpAgent(struct J9JavaVM *vm, struct J9RASdumpAgent *agent)
 		j9tty_err_printf(PORTLIB, "tool:\n");
 	} else if (agent->dumpFn == doJitDump) {
 		j9tty_err_printf(PORTLIB, "jit:\n");
+	} else if (agent->dumpFn == doAllocationProfileDump) {
+		j9tty_err_printf(PORTLIB, "allocprofile:\n");
 	} else if (agent->dumpFn == doConsoleDump) {
 		j9tty_err_printf(PORTLIB, "console:\n");
 	} else if (agent->dumpFn == doSilentDump) {
@@ -1200,6 +1200,9 @@ initRasDumpGlobalStorage(J9JavaVM *vm)
 			
 			omrthread_monitor_exit(dump_storage->dumpLabelTokensMutex);
 		} 
+
+		/* a failure here only prevents javadumps from being written in the background */
+		omrthread_monitor_init_with_name(&dump_storage->deferredJavadumpMutex, 0, "deferred javadump mutex");
 	}
 }
 	
@@ -1214,6 +1217,16 @@ freeRasDumpGlobalStorage(J9JavaVM *vm)
 	if (NULL != dump_storage) {
 		/* global storage exists. */
 
+		/* wait for any javadumps still being written by a background thread */
+		if (NULL != dump_storage->deferredJavadumpMutex) {
+			omrthread_monitor_enter(dump_storage->deferredJavadumpMutex);
+			while (0 != dump_storage->deferredJavadumpCount) {
+				omrthread_monitor_wait(dump_storage->deferredJavadumpMutex);
+			}
+			omrthread_monitor_exit(dump_storage->deferredJavadumpMutex);
+			omrthread_monitor_destroy(dump_storage->deferredJavadumpMutex);
+		}
+
 		/* free the contents */
 		if (NULL != dump_storage->dumpLabelTokensMutex) {
 			omrthread_monitor_destroy(dump_storage->dumpLabelTokensMutex);
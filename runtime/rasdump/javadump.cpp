@@ -136,6 +136,41 @@ static UDATA lockHashEqualFunction(void* left, void* right, void* user);
 
 static UDATA rasDumpPreemptLock = 0;
 
+/* A Java stack frame whose location is formatted after exclusive VM access is released */
+typedef struct deferred_frame_record {
+	UDATA textOffset;
+	J9Method *method;
+	UDATA offsetPC;
+	bool compiledMethod;
+} deferred_frame_record;
+
+/* A javadump collected in memory under exclusive VM access, written out by a background thread */
+typedef struct deferred_javadump {
+	J9JavaVM *javaVM;
+	RasDumpGlobalStorage *dumpStorage;
+	char *fileName;
+	char *text;
+	UDATA textLength;
+	deferred_frame_record *frames;
+	UDATA frameCount;
+	bool error;
+	UDATA state;
+} deferred_javadump;
+
+#define DEFERRED_JAVADUMP_STATE_NEW 0
+#define DEFERRED_JAVADUMP_STATE_STARTED 1
+#define DEFERRED_JAVADUMP_STATE_ABANDONED 2
+
+/* How long the requesting thread waits for the background thread to block class unloading */
+#define DEFERRED_JAVADUMP_START_TIMEOUT_MILLIS 1000
+
+static void writeFrameLocation(TextFileStream &stream, J9JavaVM *vm, J9Method *method, UDATA offsetPC, bool compiledMethod, bool lookupSource);
+static bool startDeferredJavadump(deferred_javadump *collected);
+static char *formatDeferredJavadump(deferred_javadump *deferred, UDATA *length);
+static void writeDeferredJavadump(deferred_javadump *deferred, const char *text, UDATA length);
+static void reportJavadumpWritten(J9PortLibrary *portLibrary, const char *fileName, bool error, bool fileMode);
+static int J9THREAD_PROC deferredJavadumpThreadProc(void *entryArg);
+
 typedef struct regioniterationblock {
 	bool _newIteration;
 	const void *_regionStart;
@@ -203,6 +238,12 @@ static const UDATA syncEventsMask =
 	J9RAS_DUMP_ON_TRACE_ASSERT |
 	J9RAS_DUMP_ON_USER_REQUEST;
 
+/* Events which may be raised while a collector holds the class unload mutex */
+static const UDATA gcEventsMask =
+	J9RAS_DUMP_ON_GLOBAL_GC |
+	J9RAS_DUMP_ON_CLASS_UNLOAD |
+	J9RAS_DUMP_ON_EXCESSIVE_GC;
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* Class for writing java core dump files                                                         */
@@ -297,6 +338,10 @@ private :
 #endif
 	void writeTrailer(void);
 
+	/* Internal methods for deferring the formatting of stack frames */
+	bool        deferFrame                   (J9Method* method, UDATA offsetPC, bool compiledMethod);
+	void        writeDeferred                (void);
+
 	/* Internal methods for writing the nested sections */
 	void        writeVMRuntimeState          (U_32 vmRuntimeState);
 	void        writeExceptionDetail         (j9object_t* exceptionRef);
@@ -360,6 +405,10 @@ private :
 	U_32              _TotalCategories;
 	U_32              _MaxCategoryBits;
 	UDATA             _AllocatedVMThreadCount;
+	bool              _DeferFormatting;
+	deferred_frame_record* _DeferredFrames;
+	UDATA             _DeferredFrameCount;
+	UDATA             _DeferredFrameCapacity;
 
 	/* Static declared data */
 	static const unsigned int _MaximumExceptionNameLength;
@@ -438,7 +487,11 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 	_ThreadsWalkStarted(false),
 	_Agent(agent),
 	_TotalCategories(0),
-	_MaxCategoryBits(0)
+	_MaxCategoryBits(0),
+	_DeferFormatting(false),
+	_DeferredFrames(NULL),
+	_DeferredFrameCount(0),
+	_DeferredFrameCapacity(0)
 {
 	PORT_ACCESS_FROM_PORT(_PortLibrary);
 	bool bufferWrites=false;
@@ -467,8 +520,21 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 	  && ((_Context->eventFlags & (J9RAS_DUMP_ON_GP_FAULT | J9RAS_DUMP_ON_ABORT_SIGNAL)) == 0)
 	  && ((_Agent->prepState & J9RAS_DUMP_GOT_EXCLUSIVE_VM_ACCESS) == J9RAS_DUMP_GOT_EXCLUSIVE_VM_ACCESS);
 
-	/* It's a single file so open it */
-	_OutputStream.open(_FileName, bufferWrites);
+	/* With request=defer the sections are collected in memory and a background thread formats the
+	 * stack frame locations and writes the file once exclusive access is released. Not done for
+	 * events raised during a GC, which may hold the class unload mutex the background thread needs.
+	 */
+	if (bufferWrites
+	  && ((_Agent->requestMask & J9RAS_DUMP_DO_DEFER_FORMATTING) == J9RAS_DUMP_DO_DEFER_FORMATTING)
+	  && ((_Context->eventFlags & gcEventsMask) == 0)
+	) {
+		_DeferFormatting = _OutputStream.openMemory();
+	}
+
+	if (!_DeferFormatting) {
+		/* It's a single file so open it */
+		_OutputStream.open(_FileName, bufferWrites);
+	}
 
 	/* Write the sections, these return void so we throw away the per section return value.
 	 * We consolidate the return values for all of the sections so we know after we finish
@@ -527,23 +593,19 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 	CALL_PROTECT(writeClassSection, _Error);
 	CALL_PROTECT(writeTrailer, _Error);
 
-	/* Record the status of the operation */
-	_FileMode = _FileMode || _OutputStream.isOpen();
-	_Error    = _Error    || _OutputStream.isError();
+	if (_DeferFormatting) {
+		/* Hand the collected text to a background thread, which reports the outcome */
+		writeDeferred();
+	} else {
+		/* Record the status of the operation */
+		_FileMode = _FileMode || _OutputStream.isOpen();
+		_Error    = _Error    || _OutputStream.isError();
 
-	/* Close the file */
-	_OutputStream.close();
+		/* Close the file */
+		_OutputStream.close();
 
-	/* Write a message to standard error saying we have written a dump file */
-	if (_Error) {
-		j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_DMP_ERROR_IN_DUMP_STR, "Java", _FileName);
-		Trc_dump_reportDumpError_Event2("Java", _FileName);
-	} else if (_FileMode) {
-		j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Java", _FileName);
-		Trc_dump_reportDumpEnd_Event2("Java", _FileName);
-	} else {
-		j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_NO_CREATE, _FileName);
-		Trc_dump_reportDumpEnd_Event2("Java", "stderr");
+		/* Write a message to standard error saying we have written a dump file */
+		reportJavadumpWritten(_PortLibrary, _FileName, _Error, _FileMode);
 	}
 }
 
@@ -554,7 +616,75 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 /**************************************************************************************************/
 JavaCoreDumpWriter::~JavaCoreDumpWriter()
 {
-	/* Nothing to do currently */
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	if (NULL != _DeferredFrames) {
+		j9mem_free_memory(_DeferredFrames);
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::deferFrame() method implementation                                         */
+/*                                                                                                */
+/**************************************************************************************************/
+bool
+JavaCoreDumpWriter::deferFrame(J9Method* method, UDATA offsetPC, bool compiledMethod)
+{
+	if (_DeferredFrameCount == _DeferredFrameCapacity) {
+		PORT_ACCESS_FROM_PORT(_PortLibrary);
+		UDATA newCapacity = OMR_MAX(_DeferredFrameCapacity * 2, 1024);
+		deferred_frame_record* newFrames = (deferred_frame_record*)j9mem_reallocate_memory(_DeferredFrames, newCapacity * sizeof(deferred_frame_record), OMRMEM_CATEGORY_VM);
+
+		if (NULL == newFrames) {
+			/* Format this frame now instead */
+			return false;
+		}
+		_DeferredFrames = newFrames;
+		_DeferredFrameCapacity = newCapacity;
+	}
+
+	deferred_frame_record* frame = &_DeferredFrames[_DeferredFrameCount];
+	frame->textOffset = _OutputStream.getMemoryLength();
+	frame->method = method;
+	frame->offsetPC = offsetPC;
+	frame->compiledMethod = compiledMethod;
+	_DeferredFrameCount += 1;
+
+	return true;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeDeferred() method implementation                                      */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeDeferred(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	deferred_javadump collected;
+
+	collected.javaVM = _VirtualMachine;
+	collected.dumpStorage = (RasDumpGlobalStorage*)_VirtualMachine->j9rasdumpGlobalStorage;
+	collected.fileName = (char*)_FileName;
+	collected.textLength = _OutputStream.getMemoryLength();
+	collected.text = _OutputStream.detachMemory();
+	collected.frames = _DeferredFrames;
+	collected.frameCount = _DeferredFrameCount;
+	collected.error = _Error || _OutputStream.isError();
+	collected.state = DEFERRED_JAVADUMP_STATE_NEW;
+	_OutputStream.close();
+	_DeferredFrames = NULL;
+
+	if (!startDeferredJavadump(&collected)) {
+		/* No background thread, so format the frames and write the file before exclusive access is released */
+		UDATA length = 0;
+		char *text = formatDeferredJavadump(&collected, &length);
+		j9mem_free_memory(collected.frames);
+		writeDeferredJavadump(&collected, text, length);
+		j9mem_free_memory(text);
+	}
 }
 
 /**************************************************************************************************/
@@ -4680,17 +4810,15 @@ JavaCoreDumpWriter::writeFrame(J9StackWalkState* state)
 		return J9_STACKWALK_STOP_ITERATING;
 	}
 
-	J9Class*     methodClass = J9_CLASS_FROM_METHOD(method);
-	J9UTF8*      className   = J9ROMCLASS_CLASSNAME(methodClass->romClass);
-	J9ROMMethod* romMethod   = J9_ROM_METHOD_FROM_RAM_METHOD(method);
-	J9UTF8*      methodName  = J9ROMMETHOD_NAME(romMethod);
-
-	_OutputStream.writeCharacters("4XESTACKTRACE                at ");
-	_OutputStream.writeCharacters(className);
-	_OutputStream.writeCharacters(".");
-	_OutputStream.writeCharacters(methodName);
+	J9ROMMethod* romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(method);
 
 	if (romMethod->modifiers & J9AccNative) {
+		J9Class* methodClass = J9_CLASS_FROM_METHOD(method);
+
+		_OutputStream.writeCharacters("4XESTACKTRACE                at ");
+		_OutputStream.writeCharacters(J9ROMCLASS_CLASSNAME(methodClass->romClass));
+		_OutputStream.writeCharacters(".");
+		_OutputStream.writeCharacters(J9ROMMETHOD_NAME(romMethod));
 		_OutputStream.writeCharacters("(Native Method)\n");
 		return J9_STACKWALK_KEEP_ITERATING;
 	}
@@ -4711,56 +4839,13 @@ JavaCoreDumpWriter::writeFrame(J9StackWalkState* state)
 	}
 #endif
 
-#ifdef J9VM_OPT_DEBUG_INFO_SERVER
-	/* Write source file and line number info, if available and we can take locks. */
-	if (!avoidLocks()) {
-		J9UTF8* sourceFile = getSourceFileNameForROMClass(_VirtualMachine, methodClass->classLoader, methodClass->romClass);
-		if (sourceFile) {
-			_OutputStream.writeCharacters("(");
-			_OutputStream.writeCharacters(sourceFile);
-
-			UDATA lineNumber = getLineNumberForROMClass(_VirtualMachine, method, offsetPC);
-
-			if (lineNumber != (UDATA)-1) {
-				_OutputStream.writeCharacters(":");
-				_OutputStream.writeInteger(lineNumber, "%zu");
-			}
-
-			if (compiledMethod) {
-				_OutputStream.writeCharacters("(Compiled Code)");
-			}
-
-			_OutputStream.writeCharacters(")\n");
-
-			/* Use a while loop as there may be more than one lock taken in a stack frame. */
-			while((*monitorCount) && ((UDATA)monitorInfo->depth == state->framesWalked)) {
-				_OutputStream.writeCharacters("5XESTACKTRACE                   (entered lock: ");
-				writeObject(monitorInfo->object);
-				_OutputStream.writeCharacters(", entry count: ");
-				_OutputStream.writeInteger(monitorInfo->count, "%zu");
-				_OutputStream.writeCharacters(")\n");
-				monitorInfo++;
-				/* Store the updated progress back in userData for the next callback */
-				state->userData3 = monitorInfo;
-				(*monitorCount)--;
-			}
-
-			return J9_STACKWALK_KEEP_ITERATING;
-		}
-	}
-#endif
-
-	/* avoidLocks() is true or have no source file or line number info available, write PC. */
-	/* (If better information was available we will have returned above.) */
-	_OutputStream.writeCharacters("(Bytecode PC:");
-	_OutputStream.writeInteger(offsetPC, "%zu");
-
-	if (compiledMethod) {
-		_OutputStream.writeCharacters("(Compiled Code)");
+	/* The location is resolved from class data only, so with request=defer the background thread formats it.
+	 * The locks held by the frame refer to heap objects and are always written now.
+	 */
+	if (!_DeferFormatting || !deferFrame(method, offsetPC, compiledMethod)) {
+		writeFrameLocation(_OutputStream, _VirtualMachine, method, offsetPC, compiledMethod, !avoidLocks());
 	}
 
-	_OutputStream.writeCharacters(")\n");
-
 	/* Use a while loop as there may be more than one lock taken in a stack frame. */
 	while((*monitorCount) && ((UDATA)monitorInfo->depth == state->framesWalked)) {
 		_OutputStream.writeCharacters("5XESTACKTRACE                   (entered lock: ");
@@ -5910,6 +5995,25 @@ lockHashEqualFunction(void* left, void* right, void* user)
 	return ((JavaCoreDumpWriter::DeadLockGraphNode*)left)->thread == ((JavaCoreDumpWriter::DeadLockGraphNode*)right)->thread;
 }
 
+/**
+ * Wait until the javadumps being written by background threads are complete, so that the
+ * messages and tool agents which follow a dump see the whole file.
+ * @param vm the Java VM
+ */
+extern "C" void
+waitForDeferredJavadumps(J9JavaVM *vm)
+{
+	RasDumpGlobalStorage *dumpStorage = (RasDumpGlobalStorage *)vm->j9rasdumpGlobalStorage;
+
+	if ((NULL != dumpStorage) && (NULL != dumpStorage->deferredJavadumpMutex)) {
+		omrthread_monitor_enter(dumpStorage->deferredJavadumpMutex);
+		while (0 != dumpStorage->deferredJavadumpCount) {
+			omrthread_monitor_wait(dumpStorage->deferredJavadumpMutex);
+		}
+		omrthread_monitor_exit(dumpStorage->deferredJavadumpMutex);
+	}
+}
+
 /* Primary entry point */
 extern "C" void
 runJavadump(char *label, J9RASdumpContext *context, J9RASdumpAgent *agent)
@@ -5918,6 +6022,275 @@ runJavadump(char *label, J9RASdumpContext *context, J9RASdumpAgent *agent)
 	JavaCoreDumpWriter(label, context, agent);
 }
 
+/**
+ * Write the "4XESTACKTRACE" line for a Java stack frame, up to the lines for the locks it holds.
+ * @param stream the stream to write to
+ * @param vm the Java VM
+ * @param method the method of the frame
+ * @param offsetPC the bytecode index in the method
+ * @param compiledMethod true if the frame is for compiled code
+ * @param lookupSource true if locks may be taken to find the source file and line number
+ */
+static void
+writeFrameLocation(TextFileStream &stream, J9JavaVM *vm, J9Method *method, UDATA offsetPC, bool compiledMethod, bool lookupSource)
+{
+	J9Class*     methodClass = J9_CLASS_FROM_METHOD(method);
+	J9UTF8*      className   = J9ROMCLASS_CLASSNAME(methodClass->romClass);
+	J9ROMMethod* romMethod   = J9_ROM_METHOD_FROM_RAM_METHOD(method);
+	J9UTF8*      methodName  = J9ROMMETHOD_NAME(romMethod);
+
+	stream.writeCharacters("4XESTACKTRACE                at ");
+	stream.writeCharacters(className);
+	stream.writeCharacters(".");
+	stream.writeCharacters(methodName);
+
+#ifdef J9VM_OPT_DEBUG_INFO_SERVER
+	/* Write source file and line number info, if available and we can take locks. */
+	if (lookupSource) {
+		J9UTF8* sourceFile = getSourceFileNameForROMClass(vm, methodClass->classLoader, methodClass->romClass);
+		if (sourceFile) {
+			stream.writeCharacters("(");
+			stream.writeCharacters(sourceFile);
+
+			UDATA lineNumber = getLineNumberForROMClass(vm, method, offsetPC);
+
+			if (lineNumber != (UDATA)-1) {
+				stream.writeCharacters(":");
+				stream.writeInteger(lineNumber, "%zu");
+			}
+
+			if (compiledMethod) {
+				stream.writeCharacters("(Compiled Code)");
+			}
+
+			stream.writeCharacters(")\n");
+			return;
+		}
+	}
+#endif
+
+	/* lookupSource is false or have no source file or line number info available, write PC. */
+	stream.writeCharacters("(Bytecode PC:");
+	stream.writeInteger(offsetPC, "%zu");
+
+	if (compiledMethod) {
+		stream.writeCharacters("(Compiled Code)");
+	}
+
+	stream.writeCharacters(")\n");
+}
+
+/**
+ * Start a background thread to format the deferred stack frames of a javadump and write the file.
+ * The caller holds exclusive VM access, and waits until the background thread is blocking class
+ * unloading so the methods of the deferred frames stay valid once exclusive access is released.
+ * @param collected the text and frames collected under exclusive VM access
+ * @return true if the background thread took ownership of the text and frames, false if the
+ * caller must write them
+ */
+static bool
+startDeferredJavadump(deferred_javadump *collected)
+{
+	J9JavaVM *vm = collected->javaVM;
+	RasDumpGlobalStorage *dumpStorage = collected->dumpStorage;
+	UDATA fileNameLength = strlen(collected->fileName) + 1;
+	deferred_javadump *deferred = NULL;
+	omrthread_t thread = NULL;
+	bool started = false;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if ((NULL == dumpStorage) || (NULL == dumpStorage->deferredJavadumpMutex)) {
+		return false;
+	}
+
+	/* The label belongs to the caller, so copy it after the block */
+	deferred = (deferred_javadump *)j9mem_allocate_memory(sizeof(deferred_javadump) + fileNameLength, OMRMEM_CATEGORY_VM);
+	if (NULL == deferred) {
+		return false;
+	}
+	*deferred = *collected;
+	deferred->fileName = (char *)(deferred + 1);
+	memcpy(deferred->fileName, collected->fileName, fileNameLength);
+
+	omrthread_monitor_enter(dumpStorage->deferredJavadumpMutex);
+	if (0 == omrthread_create(&thread, vm->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL, FALSE, deferredJavadumpThreadProc, deferred)) {
+		dumpStorage->deferredJavadumpCount += 1;
+		while (DEFERRED_JAVADUMP_STATE_NEW == deferred->state) {
+			if (J9THREAD_TIMED_OUT == omrthread_monitor_wait_timed(dumpStorage->deferredJavadumpMutex, DEFERRED_JAVADUMP_START_TIMEOUT_MILLIS, 0)) {
+				break;
+			}
+		}
+		if (DEFERRED_JAVADUMP_STATE_STARTED == deferred->state) {
+			started = true;
+		} else {
+			/* The background thread frees the block when it sees this, the caller keeps the text and frames */
+			deferred->state = DEFERRED_JAVADUMP_STATE_ABANDONED;
+		}
+	} else {
+		j9mem_free_memory(deferred);
+	}
+	omrthread_monitor_exit(dumpStorage->deferredJavadumpMutex);
+
+	return started;
+}
+
+/**
+ * Format the deferred frames of a javadump into its text, in memory.
+ * Class unloading must be blocked, either by exclusive VM access or the class unload mutex.
+ * @param deferred the text and frames collected under exclusive VM access, the text is freed
+ * @param length set to the length of the formatted text
+ * @return the formatted text, to be freed with j9mem_free_memory, or NULL if it could not be
+ * formatted, in which case the text collected under exclusive VM access is returned as it is
+ */
+static char *
+formatDeferredJavadump(deferred_javadump *deferred, UDATA *length)
+{
+	J9JavaVM *vm = deferred->javaVM;
+	TextFileStream stream(vm->portLibrary);
+	UDATA textOffset = 0;
+	char *text = NULL;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (stream.openMemory()) {
+		for (UDATA i = 0; i < deferred->frameCount; i++) {
+			deferred_frame_record *frame = &deferred->frames[i];
+
+			stream.writeCharacters(deferred->text + textOffset, frame->textOffset - textOffset);
+			writeFrameLocation(stream, vm, frame->method, frame->offsetPC, frame->compiledMethod, true);
+			textOffset = frame->textOffset;
+		}
+		stream.writeCharacters(deferred->text + textOffset, deferred->textLength - textOffset);
+
+		if (!stream.isError()) {
+			*length = stream.getMemoryLength();
+			text = stream.detachMemory();
+		}
+		stream.close();
+	}
+
+	if (NULL == text) {
+		/* keep the text without the frame locations rather than lose the dump */
+		deferred->error = true;
+		*length = deferred->textLength;
+		text = deferred->text;
+	} else {
+		j9mem_free_memory(deferred->text);
+	}
+	deferred->text = NULL;
+	return text;
+}
+
+/**
+ * Write the formatted text of a deferred javadump to its file and report that the dump is written.
+ * No locks are needed, so a collection is never kept waiting for the file I/O.
+ * @param deferred the deferred javadump
+ * @param text the formatted text
+ * @param length the length of the formatted text
+ */
+static void
+writeDeferredJavadump(deferred_javadump *deferred, const char *text, UDATA length)
+{
+	J9JavaVM *vm = deferred->javaVM;
+	TextFileStream stream(vm->portLibrary);
+	bool fileMode = false;
+	bool error = deferred->error;
+
+	stream.open(deferred->fileName, true);
+	stream.writeCharacters(text, length);
+
+	fileMode = stream.isOpen();
+	error = error || stream.isError();
+	stream.close();
+
+	reportJavadumpWritten(vm->portLibrary, deferred->fileName, error, fileMode);
+}
+
+/**
+ * Write a message to standard error saying we have written a dump file.
+ * @param portLibrary the port library
+ * @param fileName the dump file
+ * @param error true if any section failed
+ * @param fileMode true if the file was opened
+ */
+static void
+reportJavadumpWritten(J9PortLibrary *portLibrary, const char *fileName, bool error, bool fileMode)
+{
+	PORT_ACCESS_FROM_PORT(portLibrary);
+
+	if (error) {
+		j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_DMP_ERROR_IN_DUMP_STR, "Java", fileName);
+		Trc_dump_reportDumpError_Event2("Java", fileName);
+	} else if (fileMode) {
+		j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Java", fileName);
+		Trc_dump_reportDumpEnd_Event2("Java", fileName);
+	} else {
+		j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_NO_CREATE, fileName);
+		Trc_dump_reportDumpEnd_Event2("Java", "stderr");
+	}
+}
+
+/**
+ * Background thread which writes a deferred javadump. It holds the class unload mutex, as a JIT
+ * compilation does, so classes are not unloaded until the deferred frames have been formatted.
+ * The mutex is released before the file is written, since a class unloading collection takes it
+ * during its pause.
+ * @param entryArg the deferred javadump
+ */
+static int J9THREAD_PROC
+deferredJavadumpThreadProc(void *entryArg)
+{
+	deferred_javadump *deferred = (deferred_javadump *)entryArg;
+	J9JavaVM *vm = deferred->javaVM;
+	RasDumpGlobalStorage *dumpStorage = deferred->dumpStorage;
+	bool abandoned = false;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+#if defined(J9VM_JIT_CLASS_UNLOAD_RWMONITOR)
+	omrthread_rwmutex_enter_read(vm->classUnloadMutex);
+#else
+	omrthread_monitor_enter(vm->classUnloadMutex);
+#endif /* J9VM_JIT_CLASS_UNLOAD_RWMONITOR */
+
+	omrthread_monitor_enter(dumpStorage->deferredJavadumpMutex);
+	if (DEFERRED_JAVADUMP_STATE_ABANDONED == deferred->state) {
+		abandoned = true;
+	} else {
+		deferred->state = DEFERRED_JAVADUMP_STATE_STARTED;
+		omrthread_monitor_notify_all(dumpStorage->deferredJavadumpMutex);
+	}
+	omrthread_monitor_exit(dumpStorage->deferredJavadumpMutex);
+
+	if (!abandoned) {
+		UDATA length = 0;
+		char *text = formatDeferredJavadump(deferred, &length);
+		j9mem_free_memory(deferred->frames);
+
+#if defined(J9VM_JIT_CLASS_UNLOAD_RWMONITOR)
+		omrthread_rwmutex_exit_read(vm->classUnloadMutex);
+#else
+		omrthread_monitor_exit(vm->classUnloadMutex);
+#endif /* J9VM_JIT_CLASS_UNLOAD_RWMONITOR */
+
+		writeDeferredJavadump(deferred, text, length);
+		j9mem_free_memory(text);
+	} else {
+#if defined(J9VM_JIT_CLASS_UNLOAD_RWMONITOR)
+		omrthread_rwmutex_exit_read(vm->classUnloadMutex);
+#else
+		omrthread_monitor_exit(vm->classUnloadMutex);
+#endif /* J9VM_JIT_CLASS_UNLOAD_RWMONITOR */
+	}
+
+	j9mem_free_memory(deferred);
+
+	/* Let the VM shut down once the last deferred javadump is written */
+	omrthread_monitor_enter(dumpStorage->deferredJavadumpMutex);
+	dumpStorage->deferredJavadumpCount -= 1;
+	omrthread_monitor_notify_all(dumpStorage->deferredJavadumpMutex);
+	omrthread_exit(dumpStorage->deferredJavadumpMutex);
+	return 0;
+}
+
 //============================================================================================
 
 static IDATA
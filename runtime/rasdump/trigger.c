@@ -1040,6 +1040,8 @@ triggerDumpAgents(struct J9JavaVM *vm, struct J9VMThread *self, UDATA eventFlags
 		if (dumpTaken == 1) {
 			/* Release accumulated locks */
 			state = unwindAfterDump(vm, &context, state);
+			/* a javadump written in the background is not processed until its file is complete */
+			waitForDeferredJavadumps(vm);
 			if (printed == 1) {
 				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_PROCESSED_EVENT_STR, mapDumpEvent(eventFlags), detailLength, detailData);
 			}
@@ -54,6 +54,7 @@ extern "C" {
 #define RAS_STACKDEPTH_KEYWORD          "STACKDEPTH"
 #define RAS_SLEEPTIME_KEYWORD           "SLEEPTIME"
 #define RAS_COMPRESSION_LEVEL_KEYWORD   "STACKCOMPRESSIONLEVEL"
+#define RAS_METHOD_SAMPLING_KEYWORD     "METHODSAMPLING"
 
 /*
  * ======================================================================
@@ -119,6 +120,7 @@ omr_error_t processTriggerMethodClause(OMR_VMThread *, char *, BOOLEAN atRuntime
 void doTriggerActionJstacktrace(OMR_VMThread *thr);
 omr_error_t setStackDepth(J9JavaVM *thr, const char * value, BOOLEAN atRuntime);
 omr_error_t setStackCompressionLevel(J9JavaVM * vm, const char *str, BOOLEAN atRuntime);
+omr_error_t setMethodSampling(J9JavaVM *vm, const char *str, BOOLEAN atRuntime);
 
 /*
  * =============================================================================
@@ -43,6 +43,7 @@ static void traceMethodArgBoolean (J9VMThread *thr, UDATA* arg0EA, char* cursor,
 static void traceMethodEnter (J9VMThread *thr, J9Method *method, void *receiverAddress, UDATA isCompiled, UDATA doParameters);
 static void traceMethodArgLong (J9VMThread *thr, UDATA* arg0EA, char* cursor, UDATA length);
 static U_8 checkMethod (J9VMThread *thr, J9Method *method);
+static void sampleMethodEvent (J9VMThread *thr, J9Method *method, U_8 *mtFlag, BOOLEAN isEntry);
 
 /**************************************************************************
  * name        - matchMethod
@@ -120,6 +121,8 @@ U_8 checkMethod(J9VMThread *thr, J9Method *method)
 {
 	RasMethodTable *methodTable;
 	U_8 flag = J9_RAS_METHOD_SEEN;
+	/* methodsampling= falls back to full method trace when method triggers are in use */
+	BOOLEAN sampling = J9_ARE_ANY_BITS_SET(thr->javaVM->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_METHOD_TRACE_SAMPLING);
 
 	Trc_trcengine_checkMethod(thr);
 
@@ -136,16 +139,21 @@ U_8 checkMethod(J9VMThread *thr, J9Method *method)
 		if (matchMethod(methodTable, method)) {
 
 			if(methodTable->includeFlag == TRUE) {
-				flag |= J9_RAS_METHOD_TRACING;
-				/* Check if input and return values need to be traced */
-
-				if(methodTable->traceInputRetVals == TRUE) {
-					flag |= J9_RAS_METHOD_TRACE_ARGS;
+				if (sampling) {
+					/* Sampled methods never trace input and return values */
+					flag |= J9_RAS_METHOD_SAMPLING;
+				} else {
+					flag |= J9_RAS_METHOD_TRACING;
+					/* Check if input and return values need to be traced */
+
+					if(methodTable->traceInputRetVals == TRUE) {
+						flag |= J9_RAS_METHOD_TRACE_ARGS;
+					}
 				}
 			} else {
 				/* Disable all method trace for this method */
 
-				flag &= ~(J9_RAS_METHOD_TRACING | J9_RAS_METHOD_TRACE_ARGS);
+				flag &= ~(J9_RAS_METHOD_TRACING | J9_RAS_METHOD_TRACE_ARGS | J9_RAS_METHOD_SAMPLING);
 			}
 		}
 
@@ -311,6 +319,44 @@ traceMethodExitX(J9VMThread *thr, J9Method *method, UDATA isCompiled, void* exce
 
 }
 
+/**************************************************************************
+ * name        - sampleMethodEvent
+ * description - Counts the sampled method entries and exits of a thread and
+ *               records one in every methodSampleRate of them. The record
+ *               holds only the J9Method, the method name is traced once per
+ *               method the first time it is sampled.
+ * parameters  - thread, J9Method pointer, the method's extended flags and
+ *               entry/exit flag.
+ * returns     - none
+ *************************************************************************/
+static void
+sampleMethodEvent(J9VMThread *thr, J9Method *method, U_8 *mtFlag, BOOLEAN isEntry)
+{
+	UDATA count = thr->methodTraceSampleCount + 1;
+
+	if (count < RAS_GLOBAL(methodSampleRate)) {
+		thr->methodTraceSampleCount = count;
+	} else {
+		thr->methodTraceSampleCount = 0;
+
+		if (0 == (*mtFlag & J9_RAS_METHOD_SAMPLE_NAMED)) {
+			J9UTF8* className = J9ROMCLASS_CLASSNAME(J9_CLASS_FROM_METHOD(method)->romClass);
+			J9UTF8* methodName = J9ROMMETHOD_NAME(J9_ROM_METHOD_FROM_RAM_METHOD(method));
+			J9UTF8* methodSignature = J9ROMMETHOD_SIGNATURE(J9_ROM_METHOD_FROM_RAM_METHOD(method));
+
+			/* Racing threads may both trace the name, which is harmless */
+			setExtendedMethodFlags(thr->javaVM, mtFlag, J9_RAS_METHOD_SAMPLE_NAMED);
+			Trc_MethodSampleName(thr, method, J9UTF8_LENGTH(className), J9UTF8_DATA(className), J9UTF8_LENGTH(methodName), J9UTF8_DATA(methodName), J9UTF8_LENGTH(methodSignature), J9UTF8_DATA(methodSignature));
+		}
+
+		if (isEntry) {
+			Trc_MethodEntrySampled(thr, method);
+		} else {
+			Trc_MethodExitSampled(thr, method);
+		}
+	}
+}
+
 static void
 hookRAMClassLoad(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
 {
@@ -348,6 +394,10 @@ trcTraceMethodEnter(J9VMThread* thr, J9Method* method, void *receiverAddress, UD
 		traceMethodEnter(thr, method, receiverAddress, methodType, doParameters);
 	}
 
+	if ( 0 != (*mtFlag & J9_RAS_METHOD_SAMPLING) ) {
+		sampleMethodEvent(thr, method, mtFlag, TRUE);
+	}
+
 	if ( 0 != (*mtFlag & J9_RAS_METHOD_TRIGGERING) ) {
 		rasTriggerMethod(thr, method, TRUE, AFTER_TRACEPOINT);
 	}
@@ -377,6 +427,10 @@ trcTraceMethodExit(J9VMThread* thr, J9Method* method,  void* exceptionPtr, void
 		}
 	}
 
+	if ( 0 != (*mtFlag & J9_RAS_METHOD_SAMPLING) ) {
+		sampleMethodEvent(thr, method, mtFlag, FALSE);
+	}
+
 	if ( 0 != (*mtFlag & J9_RAS_METHOD_TRIGGERING) ) {
 		rasTriggerMethod(thr, method, FALSE, AFTER_TRACEPOINT);
 	}
@@ -391,7 +445,16 @@ enableMethodTraceHooks(J9JavaVM *vm)
 	/* Called from J9VMDLLMain, single threaded at startup so no
 	 * need to protect with vm->runtimeFlagsMutex
 	 */
-	vm->extendedRuntimeFlags |= J9_EXTENDED_RUNTIME_METHOD_TRACE_ENABLED;
+	if ((0 != RAS_GLOBAL_FROM_JAVAVM(methodSampleRate, vm))
+		&& (NULL == RAS_GLOBAL_FROM_JAVAVM(triggerOnMethods, vm))
+	) {
+		/* Sampling relies on the probes in compiled code, so the VM is not
+		 * switched to debug mode and interpreted methods are not sampled.
+		 */
+		vm->extendedRuntimeFlags2 |= J9_EXTENDED_RUNTIME2_METHOD_TRACE_SAMPLING;
+	} else {
+		vm->extendedRuntimeFlags |= J9_EXTENDED_RUNTIME_METHOD_TRACE_ENABLED;
+	}
 
 	if ((*hook)->J9HookRegisterWithCallSite(hook, J9HOOK_VM_INTERNAL_CLASS_LOAD, hookRAMClassLoad, OMR_GET_CALLSITE(), NULL)) {
 		return OMR_ERROR_INTERNAL;
@@ -1133,3 +1133,44 @@ err:
 	vaReportJ9VMCommandLineError(PORTLIB, "stackdepth takes an integer value from 1 to 99999");
 	return OMR_ERROR_INTERNAL;
 }
+
+/**************************************************************************
+ * name        - setMethodSampling
+ * description - Set the sample rate used for the methods option.
+ * parameters  - vm, trace options, atRuntime
+ * returns     - JNI return code
+ *************************************************************************/
+omr_error_t
+setMethodSampling(J9JavaVM *vm, const char *str, BOOLEAN atRuntime)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	int value, length;
+	omr_error_t rc = OMR_ERROR_NONE;
+	const char *p;
+
+	if (getParmNumber(str) != 1) {
+		goto err;
+	}
+
+	p = getPositionalParm(1, str, &length);
+
+	if (length == 0 || length > 7) {
+		goto err;
+	}
+
+	value = decimalString2Int(PORTLIB, p, FALSE, &rc);
+	if (rc != OMR_ERROR_NONE) {
+		goto err;
+	}
+
+	if (value == 0) {
+		goto err;
+	}
+
+	RAS_GLOBAL_FROM_JAVAVM(methodSampleRate,vm) = value;
+	return OMR_ERROR_NONE;
+
+err:
+	vaReportJ9VMCommandLineError(PORTLIB, "methodsampling takes an integer value from 1 to 9999999");
+	return OMR_ERROR_INTERNAL;
+}
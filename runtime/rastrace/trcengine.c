@@ -115,6 +115,7 @@ const struct traceOption TRACE_OPTIONS[] =
 	{RAS_METHODS_KEYWORD, FALSE, setMethod},
 	{RAS_STACKDEPTH_KEYWORD, TRUE, setStackDepth},
 	{RAS_COMPRESSION_LEVEL_KEYWORD, TRUE, setStackCompressionLevel},
+	{RAS_METHOD_SAMPLING_KEYWORD, FALSE, setMethodSampling},
 };
 
 #define NUMBER_OF_TRACE_OPTIONS ( sizeof(TRACE_OPTIONS) / sizeof(struct traceOption))
@@ -167,7 +168,7 @@ J9VMDllMain(J9JavaVM *vm, IDATA stage, void *reserved)
 	IDATA returnVal = J9VMDLLMAIN_OK;
 	omr_error_t rc = OMR_ERROR_NONE;
 
-	char *ignore[] = { "INITIALIZATION", "METHODS", "WHAT", "STACKDEPTH", "STACKCOMPRESSIONLEVEL", NULL };
+	char *ignore[] = { "INITIALIZATION", "METHODS", "WHAT", "STACKDEPTH", "STACKCOMPRESSIONLEVEL", "METHODSAMPLING", NULL };
 	char *opts[UT_MAX_OPTS];
 	int i;
 	UtThreadData **tempThr = NULL;
@@ -888,7 +889,8 @@ static void displayTraceHelp(J9JavaVM *vm)
 	j9tty_err_printf(PORTLIB, "     iprint=[!]tp_spec[,...]             Indented version of print option\n");
 	j9tty_err_printf(PORTLIB, "     external=[!]tp_spec[,...]           Direct trace data to a JVMRI listener\n");
 	j9tty_err_printf(PORTLIB, "     exception=[!]tp_spec[,...]          Use reserved in-core buffer\n");
-	j9tty_err_printf(PORTLIB, "     methods=method_spec[,..]            Trace specified class(es) and methods\n\n");
+	j9tty_err_printf(PORTLIB, "     methods=method_spec[,..]            Trace specified class(es) and methods\n");
+	j9tty_err_printf(PORTLIB, "     methodsampling=nn                   Trace 1 in nn compiled entries and exits of the methods\n\n");
 	j9tty_err_printf(PORTLIB, "     trigger=[!]clause[,clause]...       Enables triggering events (including dumps) on tracepoints\n");
 	j9tty_err_printf(PORTLIB, "     suspend                             Global trace suspend used with trigger\n");
 	j9tty_err_printf(PORTLIB, "     resume                              Global trace resume used with trigger\n");
@@ -28,6 +28,7 @@ omr_add_exports(j9ben
 	Java_jvmti_test_nativeMethodPrefixes_DirectNative_gac4gac3gac2gac1nat
 	Java_jvmti_test_nativeMethodPrefixes_WrappedNative_nat
 	Java_jit_test_vich_JNIObjectArray_getObjectArrayElement
+	Java_jit_test_vich_JNIGlobalRef_globalReference
 	Java_jit_test_vich_JNILocalRef_localReference32
 	Java_jit_test_vich_JNILocalRef_localReference8
 	Java_jit_test_vich_JNIArray_getPrimitiveArrayCritical
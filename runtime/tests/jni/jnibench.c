@@ -3701,6 +3701,54 @@ void JNICALL Java_jit_test_vich_JNILocalRef_localReference32(JNIEnv *env, jobjec
 }
 
 
+jint JNICALL Java_jit_test_vich_JNIGlobalRef_globalReference(JNIEnv *env, jobject obj, jobject o1, jboolean isWeak, jint loopCount)
+{
+	jobjectRefType expectedType = isWeak ? JNIWeakGlobalRefType : JNIGlobalRefType;
+	jobject refs[8];
+	jint errors = 0;
+	jint i, j, k;
+
+	for (i = 0; i < loopCount; i++)
+	{
+		for (j = 0; j < 8; j++)
+		{
+			refs[j] = isWeak ? (*env)->NewWeakGlobalRef(env, o1) : (*env)->NewGlobalRef(env, o1);
+			/* A slot reused from another thread must not still refer to that thread's object */
+			if ((NULL == refs[j])
+				|| (expectedType != (*env)->GetObjectRefType(env, refs[j]))
+				|| !(*env)->IsSameObject(env, refs[j], o1)
+			) {
+				errors += 1;
+			}
+			for (k = 0; k < j; k++)
+			{
+				if (refs[k] == refs[j]) {
+					errors += 1;
+				}
+			}
+		}
+		for (j = 0; j < 8; j++)
+		{
+			if (isWeak) {
+				(*env)->DeleteWeakGlobalRef(env, refs[j]);
+			} else {
+				(*env)->DeleteGlobalRef(env, refs[j]);
+			}
+			/* Deleting one reference must leave the others intact */
+			for (k = j + 1; k < 8; k++)
+			{
+				if ((expectedType != (*env)->GetObjectRefType(env, refs[k]))
+					|| !(*env)->IsSameObject(env, refs[k], o1)
+				) {
+					errors += 1;
+				}
+			}
+		}
+	}
+	return errors;
+}
+
+
 void JNICALL Java_jit_test_vich_JNIObjectArray_getObjectArrayElement(JNIEnv *env, jobject obj, jobjectArray array, jobjectArray blankArray, jint arraySize, jint loopCount)
 {
 	jint i, j;
@@ -1719,6 +1719,19 @@ void JNICALL
 Java_jit_test_vich_JNILocalRef_localReference8(JNIEnv *env, jobject obj, jobject o1, jobject o2, jobject o3, jobject o4, jobject o5, jobject o6, jobject o7, jobject o8, jint loopCount);
 
 
+/**
+* @brief
+* @param *env
+* @param obj
+* @param o1
+* @param isWeak
+* @param loopCount
+* @return the number of references which did not refer to o1
+*/
+jint JNICALL 
+Java_jit_test_vich_JNIGlobalRef_globalReference(JNIEnv *env, jobject obj, jobject o1, jboolean isWeak, jint loopCount);
+
+
 /**
 * @brief
 * @param *env
@@ -0,0 +1,491 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "j9.h"
+#include "j9protos.h"
+#include "j9consts.h"
+#include "mmhook.h"
+#include "ut_j9vm.h"
+#include "vmhook_internal.h"
+#include "vm_api.h"
+#include "vm_internal.h"
+
+extern "C" {
+
+static UDATA frameHashFn(void *key, void *userData);
+static UDATA frameHashEqualFn(void *leftKey, void *rightKey, void *userData);
+static UDATA nodeHashFn(void *key, void *userData);
+static UDATA nodeHashEqualFn(void *leftKey, void *rightKey, void *userData);
+static UDATA allocationProfilerFrameIterator(J9VMThread *currentThread, J9StackWalkState *walkState);
+static J9AllocationProfileFrame *findFrame(J9AllocationProfiler *profiler, J9JavaVM *vm, J9Method *method);
+static void pruneDeadSamples(J9VMThread *currentThread, J9AllocationProfiler *profiler);
+static BOOLEAN reserveSample(J9VMThread *currentThread, J9AllocationProfiler *profiler);
+static void hookAllocationSample(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+static void hookAllocationProfilerClassesUnload(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+
+static UDATA
+frameHashFn(void *key, void *userData)
+{
+	J9AllocationProfileFrame *frame = *(J9AllocationProfileFrame **)key;
+
+	return (UDATA)frame->method;
+}
+
+static UDATA
+frameHashEqualFn(void *leftKey, void *rightKey, void *userData)
+{
+	J9AllocationProfileFrame *leftFrame = *(J9AllocationProfileFrame **)leftKey;
+	J9AllocationProfileFrame *rightFrame = *(J9AllocationProfileFrame **)rightKey;
+
+	return leftFrame->method == rightFrame->method;
+}
+
+static UDATA
+nodeHashFn(void *key, void *userData)
+{
+	J9AllocationProfileNode *node = (J9AllocationProfileNode *)key;
+
+	return ((UDATA)node->parent >> 3) ^ (((UDATA)node->frame >> 3) * 31);
+}
+
+static UDATA
+nodeHashEqualFn(void *leftKey, void *rightKey, void *userData)
+{
+	J9AllocationProfileNode *leftNode = (J9AllocationProfileNode *)leftKey;
+	J9AllocationProfileNode *rightNode = (J9AllocationProfileNode *)rightKey;
+
+	return (leftNode->parent == rightNode->parent) && (leftNode->frame == rightNode->frame);
+}
+
+/**
+ * Record the method of each visible frame, innermost first, in the array in userData1.
+ * userData2 holds the number of methods recorded.
+ */
+static UDATA
+allocationProfilerFrameIterator(J9VMThread *currentThread, J9StackWalkState *walkState)
+{
+	J9Method **methods = (J9Method **)walkState->userData1;
+	UDATA depth = (UDATA)walkState->userData2;
+
+	if (depth < J9_ALLOCATION_PROFILER_MAX_DEPTH) {
+		methods[depth] = walkState->method;
+		walkState->userData2 = (void *)(depth + 1);
+	}
+	return J9_STACKWALK_KEEP_ITERATING;
+}
+
+/**
+ * Find the frame of a method, creating it if this is the first sample to include the method.
+ * Must be called with the profiler mutex held.
+ * @param profiler: the allocation profiler
+ * @param vm: Reference to the VM
+ * @param method: a method on the stack of the allocating thread
+ * @return the frame, or NULL on allocation failure
+ */
+static J9AllocationProfileFrame *
+findFrame(J9AllocationProfiler *profiler, J9JavaVM *vm, J9Method *method)
+{
+	J9AllocationProfileFrame query;
+	J9AllocationProfileFrame *queryPtr = &query;
+	J9AllocationProfileFrame **entry = NULL;
+	J9AllocationProfileFrame *frame = NULL;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	query.method = method;
+	entry = (J9AllocationProfileFrame **)hashTableFind(profiler->frames, &queryPtr);
+	if (NULL != entry) {
+		frame = *entry;
+	} else {
+		frame = (J9AllocationProfileFrame *)pool_newElement(profiler->framePool);
+		if (NULL != frame) {
+			J9UTF8 *className = J9ROMCLASS_CLASSNAME(J9_CLASS_FROM_METHOD(method)->romClass);
+			J9UTF8 *methodName = J9ROMMETHOD_NAME(J9_ROM_METHOD_FROM_RAM_METHOD(method));
+			UDATA classNameLength = J9UTF8_LENGTH(className);
+			UDATA methodNameLength = J9UTF8_LENGTH(methodName);
+			char *name = (char *)j9mem_allocate_memory(classNameLength + methodNameLength + 2, OMRMEM_CATEGORY_VM);
+
+			if (NULL == name) {
+				pool_removeElement(profiler->framePool, frame);
+				return NULL;
+			}
+			/* Report qualified names the way Java tools print them: java.lang.String.<init> */
+			for (UDATA i = 0; i < classNameLength; ++i) {
+				char c = (char)J9UTF8_DATA(className)[i];
+				name[i] = ('/' == c) ? '.' : c;
+			}
+			name[classNameLength] = '.';
+			memcpy(name + classNameLength + 1, J9UTF8_DATA(methodName), methodNameLength);
+			name[classNameLength + methodNameLength + 1] = '\0';
+
+			frame->method = method;
+			frame->name = name;
+			frame->id = pool_numElements(profiler->framePool);
+			if (NULL == hashTableAdd(profiler->frames, &frame)) {
+				j9mem_free_memory(name);
+				pool_removeElement(profiler->framePool, frame);
+				frame = NULL;
+			}
+		}
+	}
+	return frame;
+}
+
+/**
+ * Discard the samples whose objects have been collected. The GC clears the weak
+ * reference of a sample when its object dies.
+ * Must be called with VM access and the profiler mutex held.
+ * @param currentThread: the current thread
+ * @param profiler: the allocation profiler
+ */
+static void
+pruneDeadSamples(J9VMThread *currentThread, J9AllocationProfiler *profiler)
+{
+	J9AllocationProfileSample *samples = profiler->samples;
+	UDATA liveCount = 0;
+
+	for (UDATA i = 0; i < profiler->sampleCount; ++i) {
+		if (NULL == *(j9object_t *)samples[i].weakRef) {
+			j9jni_deleteGlobalRef((JNIEnv *)currentThread, samples[i].weakRef, JNI_TRUE);
+		} else {
+			samples[liveCount] = samples[i];
+			liveCount += 1;
+		}
+	}
+	profiler->sampleCount = liveCount;
+}
+
+/**
+ * Make room for one more sample. Dead samples are pruned when the array is full and
+ * the array is doubled if more than half of its samples are still live.
+ * Must be called with VM access and the profiler mutex held.
+ * @param currentThread: the current thread
+ * @param profiler: the allocation profiler
+ * @return TRUE if there is room for a sample
+ */
+static BOOLEAN
+reserveSample(J9VMThread *currentThread, J9AllocationProfiler *profiler)
+{
+	if (profiler->sampleCount == profiler->sampleCapacity) {
+		pruneDeadSamples(currentThread, profiler);
+		if ((profiler->sampleCount * 2) > profiler->sampleCapacity) {
+			UDATA newCapacity = (0 == profiler->sampleCapacity) ? 1024 : (profiler->sampleCapacity * 2);
+			J9AllocationProfileSample *newSamples = NULL;
+			PORT_ACCESS_FROM_VMC(currentThread);
+
+			newSamples = (J9AllocationProfileSample *)j9mem_reallocate_memory(profiler->samples, newCapacity * sizeof(J9AllocationProfileSample), OMRMEM_CATEGORY_VM);
+			if (NULL != newSamples) {
+				profiler->samples = newSamples;
+				profiler->sampleCapacity = newCapacity;
+			}
+		}
+	}
+	return profiler->sampleCount < profiler->sampleCapacity;
+}
+
+/**
+ * Record the stack of the allocating thread in the call tree and track the sampled
+ * object with a weak global reference.
+ * The current thread has VM access. The stack is walked before the profiler mutex is
+ * entered so that only the tree update is serialized.
+ * userData: the allocation profiler
+ */
+static void
+hookAllocationSample(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	MM_ObjectAllocationSamplingEvent *event = (MM_ObjectAllocationSamplingEvent *)eventData;
+	J9VMThread *currentThread = event->currentThread;
+	J9JavaVM *vm = currentThread->javaVM;
+	J9AllocationProfiler *profiler = (J9AllocationProfiler *)userData;
+	J9Method *methods[J9_ALLOCATION_PROFILER_MAX_DEPTH];
+	J9StackWalkState walkState;
+	UDATA depth = 0;
+
+	walkState.walkThread = currentThread;
+	walkState.flags = J9_STACKWALK_ITERATE_FRAMES | J9_STACKWALK_VISIBLE_ONLY | J9_STACKWALK_INCLUDE_NATIVES | J9_STACKWALK_COUNT_SPECIFIED;
+	walkState.skipCount = 0;
+	walkState.maxFrames = profiler->maxDepth;
+	walkState.userData1 = methods;
+	walkState.userData2 = (void *)0;
+	walkState.frameWalkFunction = allocationProfilerFrameIterator;
+	vm->walkStackFrames(currentThread, &walkState);
+	depth = (UDATA)walkState.userData2;
+
+	if (0 != depth) {
+		jobject weakRef = j9jni_createGlobalRef((JNIEnv *)currentThread, event->object, JNI_TRUE);
+
+		if (NULL != weakRef) {
+			J9AllocationProfileNode *node = NULL;
+
+			omrthread_monitor_enter(profiler->mutex);
+			/* Insert the path from the outermost frame to the allocating frame */
+			while (0 != depth) {
+				J9AllocationProfileNode query;
+
+				depth -= 1;
+				query.parent = node;
+				query.frame = findFrame(profiler, vm, methods[depth]);
+				query.liveCount = 0;
+				query.liveBytes = 0;
+				if (NULL == query.frame) {
+					node = NULL;
+					break;
+				}
+				node = (J9AllocationProfileNode *)hashTableAdd(profiler->nodes, &query);
+				if (NULL == node) {
+					break;
+				}
+			}
+			if ((NULL != node) && reserveSample(currentThread, profiler)) {
+				J9AllocationProfileSample *sample = &profiler->samples[profiler->sampleCount];
+
+				sample->weakRef = weakRef;
+				sample->node = node;
+				sample->size = event->objectSize;
+				profiler->sampleCount += 1;
+				profiler->totalSamples += 1;
+				profiler->totalBytes += event->objectSize;
+				weakRef = NULL;
+			}
+			omrthread_monitor_exit(profiler->mutex);
+
+			if (NULL != weakRef) {
+				j9jni_deleteGlobalRef((JNIEnv *)currentThread, weakRef, JNI_TRUE);
+			}
+		}
+	}
+}
+
+/**
+ * Forget the methods of unloaded classes so that a method allocated at the same address
+ * gets a frame of its own. The frames themselves, and their names, are kept because
+ * call tree nodes refer to them.
+ * This is not thread safe: must be called when the caller has exclusive VM access.
+ * userData: the allocation profiler
+ */
+static void
+hookAllocationProfilerClassesUnload(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	J9AllocationProfiler *profiler = (J9AllocationProfiler *)userData;
+	J9HashTableState walkState;
+	J9AllocationProfileFrame **entry = (J9AllocationProfileFrame **)hashTableStartDo(profiler->frames, &walkState);
+
+	while (NULL != entry) {
+		J9AllocationProfileFrame *frame = *entry;
+
+		if (J9_ARE_ANY_BITS_SET(J9_CLASS_FROM_METHOD(frame->method)->classDepthAndFlags, J9AccClassDying)) {
+			frame->method = NULL;
+			hashTableDoRemove(&walkState);
+		}
+		entry = (J9AllocationProfileFrame **)hashTableNextDo(&walkState);
+	}
+}
+
+/**
+ * Allocate the allocation profiler and register the hooks which maintain it.
+ * Samples are not recorded until allocationProfilerStart() is called.
+ * This is not thread safe. It is called at VM startup.
+ * @param vm: Reference to the VM
+ * @param interval: the number of bytes allocated between samples
+ * @param maxDepth: the maximum number of frames recorded per sample
+ * @return the profiler, or NULL on failure
+ */
+J9AllocationProfiler *
+allocationProfilerNew(J9JavaVM *vm, UDATA interval, UDATA maxDepth)
+{
+	J9AllocationProfiler *profiler = NULL;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	profiler = (J9AllocationProfiler *)j9mem_allocate_memory(sizeof(J9AllocationProfiler), OMRMEM_CATEGORY_VM);
+	if (NULL != profiler) {
+		memset(profiler, 0, sizeof(J9AllocationProfiler));
+		profiler->interval = interval;
+		profiler->maxDepth = OMR_MIN(OMR_MAX(maxDepth, 1), J9_ALLOCATION_PROFILER_MAX_DEPTH);
+		vm->allocationProfiler = profiler;
+		if (0 != omrthread_monitor_init_with_name(&profiler->mutex, 0, "Allocation profiler")) {
+			goto fail;
+		}
+		profiler->framePool = pool_new(sizeof(J9AllocationProfileFrame), 0, 0, 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(PORTLIB));
+		if (NULL == profiler->framePool) {
+			goto fail;
+		}
+		profiler->frames = hashTableNew(OMRPORT_FROM_J9PORT(PORTLIB), J9_GET_CALLSITE(), 256, sizeof(J9AllocationProfileFrame *), sizeof(J9AllocationProfileFrame *), 0, OMRMEM_CATEGORY_VM, frameHashFn, frameHashEqualFn, NULL, vm);
+		if (NULL == profiler->frames) {
+			goto fail;
+		}
+		profiler->nodes = hashTableNew(OMRPORT_FROM_J9PORT(PORTLIB), J9_GET_CALLSITE(), 1024, sizeof(J9AllocationProfileNode), sizeof(J9AllocationProfileNode *), 0, OMRMEM_CATEGORY_VM, nodeHashFn, nodeHashEqualFn, NULL, vm);
+		if (NULL == profiler->nodes) {
+			goto fail;
+		}
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+		{
+			J9HookInterface **vmHooks = J9_HOOK_INTERFACE(vm->hookInterface);
+
+			if (0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CLASSES_UNLOAD, hookAllocationProfilerClassesUnload, OMR_GET_CALLSITE(), profiler)) {
+				goto fail;
+			}
+			if (0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_ANON_CLASSES_UNLOAD, hookAllocationProfilerClassesUnload, OMR_GET_CALLSITE(), profiler)) {
+				/* The profiler is about to be freed, so it must not be left on the class unload hook */
+				(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_CLASSES_UNLOAD, hookAllocationProfilerClassesUnload, profiler);
+				goto fail;
+			}
+		}
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+	}
+	return profiler;
+
+fail:
+	allocationProfilerFree(vm);
+	return NULL;
+}
+
+/**
+ * Register for allocation sampling events and set the GC sampling interval.
+ * The interval is shared with JVMTI SetHeapSamplingInterval.
+ * @param currentThread: the current thread
+ * @return 0 on success, -1 on failure
+ */
+IDATA
+allocationProfilerStart(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9AllocationProfiler *profiler = vm->allocationProfiler;
+	J9HookInterface **gcHooks = vm->memoryManagerFunctions->j9gc_get_hook_interface(vm);
+
+	if (0 != (*gcHooks)->J9HookRegisterWithCallSite(gcHooks, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING, hookAllocationSample, OMR_GET_CALLSITE(), profiler)) {
+		return -1;
+	}
+	vm->memoryManagerFunctions->j9gc_set_allocation_sampling_interval(currentThread, profiler->interval);
+	return 0;
+}
+
+/**
+ * Free the allocation profiler. The weak global references of the samples are
+ * released with the VM reference pools.
+ * This is not thread safe. Called during VM shutdown.
+ * @param vm: Reference to the VM
+ */
+void
+allocationProfilerFree(J9JavaVM *vm)
+{
+	J9AllocationProfiler *profiler = vm->allocationProfiler;
+
+	if (NULL != profiler) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+
+		vm->allocationProfiler = NULL;
+		if (NULL != profiler->nodes) {
+			hashTableFree(profiler->nodes);
+		}
+		if (NULL != profiler->frames) {
+			hashTableFree(profiler->frames);
+		}
+		if (NULL != profiler->framePool) {
+			pool_state poolState;
+			J9AllocationProfileFrame *frame = (J9AllocationProfileFrame *)pool_startDo(profiler->framePool, &poolState);
+
+			while (NULL != frame) {
+				j9mem_free_memory(frame->name);
+				frame = (J9AllocationProfileFrame *)pool_nextDo(&poolState);
+			}
+			pool_kill(profiler->framePool);
+		}
+		if (NULL != profiler->mutex) {
+			omrthread_monitor_destroy(profiler->mutex);
+		}
+		j9mem_free_memory(profiler->samples);
+		j9mem_free_memory(profiler);
+	}
+}
+
+/**
+ * Write the call tree of the sampled objects which are still live. The file uses the
+ * legacy Java heapz format understood by pprof: one line per allocation stack with the
+ * sample count, the sampled bytes and the frame addresses innermost first, followed by
+ * a line per frame address giving the method name. pprof scales the samples assuming
+ * the default 512KB sampling interval.
+ * The caller must have exclusive VM access.
+ * @param currentThread: the current thread
+ * @param fileName: the file to write
+ * @return 0 on success, -1 if the profiler is not enabled or the file could not be written
+ */
+IDATA
+dumpAllocationProfile(J9VMThread *currentThread, const char *fileName)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9AllocationProfiler *profiler = vm->allocationProfiler;
+	J9HashTableState walkState;
+	J9AllocationProfileNode *node = NULL;
+	pool_state poolState;
+	J9AllocationProfileFrame *frame = NULL;
+	IDATA fd = -1;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (NULL == profiler) {
+		return -1;
+	}
+	fd = j9file_open((char *)fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		return -1;
+	}
+
+	/* Mutators hold VM access while they update the profiler, so it is stable here */
+	pruneDeadSamples(currentThread, profiler);
+	node = (J9AllocationProfileNode *)hashTableStartDo(profiler->nodes, &walkState);
+	while (NULL != node) {
+		node->liveCount = 0;
+		node->liveBytes = 0;
+		node = (J9AllocationProfileNode *)hashTableNextDo(&walkState);
+	}
+	for (UDATA i = 0; i < profiler->sampleCount; ++i) {
+		J9AllocationProfileSample *sample = &profiler->samples[i];
+
+		sample->node->liveCount += 1;
+		sample->node->liveBytes += sample->size;
+	}
+
+	j9file_printf(PORTLIB, fd, "--- heapz 1 ---\n");
+	j9file_printf(PORTLIB, fd, "format = java\n");
+	j9file_printf(PORTLIB, fd, "resolution = bytes\n");
+	node = (J9AllocationProfileNode *)hashTableStartDo(profiler->nodes, &walkState);
+	while (NULL != node) {
+		if (0 != node->liveCount) {
+			j9file_printf(PORTLIB, fd, "%zu %zu @", node->liveCount, node->liveBytes);
+			for (J9AllocationProfileNode *caller = node; NULL != caller; caller = caller->parent) {
+				j9file_printf(PORTLIB, fd, " 0x%zx", caller->frame->id);
+			}
+			j9file_printf(PORTLIB, fd, "\n");
+		}
+		node = (J9AllocationProfileNode *)hashTableNextDo(&walkState);
+	}
+	j9file_printf(PORTLIB, fd, "---\n");
+	frame = (J9AllocationProfileFrame *)pool_startDo(profiler->framePool, &poolState);
+	while (NULL != frame) {
+		j9file_printf(PORTLIB, fd, "0x%zx %s\n", frame->id, frame->name);
+		frame = (J9AllocationProfileFrame *)pool_nextDo(&poolState);
+	}
+	j9file_close(fd);
+	return 0;
+}
+
+} /* extern "C" */
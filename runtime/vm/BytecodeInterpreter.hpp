@@ -49,6 +49,7 @@
 #include "ObjectAccessBarrierAPI.hpp"
 #include "ObjectHash.hpp"
 #include "ValueTypeHelpers.hpp"
+#include "InterpreterInlineCache.hpp"
 #include "VMHelpers.hpp"
 #include "VMAccess.hpp"
 #include "ObjectAllocationAPI.hpp"
@@ -2998,11 +2999,8 @@ done:
 					walkFlags |= J9_STACKWALK_HIDE_EXCEPTION_FRAMES;
 					walkState->restartException = receiver;
 				}
-				walkState->flags = walkFlags;
-				walkState->skipCount = 1;	// skip the INL frame
-				walkState->walkThread = _currentThread;
 				updateVMStruct(REGISTER_ARGS);
-				UDATA walkRC = _vm->walkStackFrames(_currentThread, walkState);
+				UDATA walkRC = VM_VMHelpers::walkThrowableStackFrames(_currentThread, walkState, walkFlags, NULL == walkback);
 				/* No need for VMStructHasBeenUpdated as the above walk cannot change the roots */
 				UDATA framesWalked = walkState->framesWalked;
 				UDATA *cachePointer = walkState->cache;
@@ -6934,6 +6932,8 @@ resolve:
 			J9Class *receiverClass = J9OBJECT_CLAZZ(_currentThread, receiver);
 			UDATA methodIndex = methodIndexAndArgCount >> J9_ITABLE_INDEX_SHIFT;
 			J9ROMMethod *romMethod = NULL;
+			J9InterpreterInlineCaches *inlineCaches = NULL;
+			UDATA depth = 0;
 
 			/* Run search in receiverClass->lastITable */
 			J9ITable *iTable = receiverClass->lastITable;
@@ -6941,10 +6941,26 @@ resolve:
 				goto foundITableCache;
 			}
 
+			/* Run search in the inline cache of the call site */
+			inlineCaches = _vm->interpreterInlineCaches;
+			if (NULL != inlineCaches) {
+				J9Method *cachedMethod = VM_InterpreterInlineCache::lookupCallSite(inlineCaches, ramMethodRef, receiverClass);
+				if (NULL != cachedMethod) {
+					_sendMethod = cachedMethod;
+					profileInvokeReceiver(REGISTER_ARGS, receiverClass, _literals, _sendMethod);
+					_pc += offset;
+					goto done;
+				}
+			}
+
 			/* Start search from receiverClass->iTable */
 			iTable = (J9ITable*)receiverClass->iTable;
 			while (NULL != iTable) {
 				if (interfaceClass == iTable->interfaceClass) {
+					if ((NULL != inlineCaches) && (depth >= J9_INTERP_ITABLE_CACHE_DEPTH)) {
+						VM_InterpreterInlineCache::updateITable(inlineCaches, receiverClass, iTable);
+					}
+foundITable:
 					receiverClass->lastITable = iTable;
 foundITableCache:
 					if (J9_UNEXPECTED(J9_ARE_ANY_BITS_SET(methodIndexAndArgCount, J9_ITABLE_INDEX_TAG_BITS))) {
@@ -6983,11 +6999,23 @@ foundITableCache:
 						rc = GOTO_THROW_CURRENT_EXCEPTION;
 						goto done;
 					}
+					if (NULL != inlineCaches) {
+						VM_InterpreterInlineCache::updateCallSite(inlineCaches, ramMethodRef, receiverClass, _sendMethod);
+					}
 					profileInvokeReceiver(REGISTER_ARGS, receiverClass, _literals, _sendMethod);
 					_pc += offset;
 					goto done;
 				}
 				iTable = iTable->next;
+				depth += 1;
+				if ((NULL != inlineCaches) && (J9_INTERP_ITABLE_CACHE_DEPTH == depth)) {
+					/* Deep iTable chain, use the lookup hashed by interface class */
+					J9ITable *cachedITable = VM_InterpreterInlineCache::lookupITable(inlineCaches, receiverClass, interfaceClass);
+					if (NULL != cachedITable) {
+						iTable = cachedITable;
+						goto foundITable;
+					}
+				}
 			}
 			if (!J9RAMINTERFACEMETHODREF_RESOLVED(interfaceClass, methodIndexAndArgCount)) {
 				goto resolve;
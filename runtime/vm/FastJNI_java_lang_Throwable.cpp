@@ -57,10 +57,7 @@ Fast_java_lang_Throwable_fillInStackTrace(J9VMThread *currentThread, j9object_t
 				walkFlags |= J9_STACKWALK_HIDE_EXCEPTION_FRAMES;
 				walkState->restartException = receiver;
 			}
-			walkState->flags = walkFlags;
-			walkState->skipCount = 1;	// skip the INL frame
-			walkState->walkThread = currentThread;
-			UDATA walkRC = vm->walkStackFrames(currentThread, walkState);
+			UDATA walkRC = VM_VMHelpers::walkThrowableStackFrames(currentThread, walkState, walkFlags, NULL == walkback);
 			UDATA framesWalked = walkState->framesWalked;
 			UDATA *cachePointer = walkState->cache;
 			if (J9_STACKWALK_RC_NONE != walkRC) {
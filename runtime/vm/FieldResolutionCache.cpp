@@ -0,0 +1,223 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <string.h>
+
+#include "j9.h"
+#include "j9protos.h"
+#include "j9consts.h"
+#include "ut_j9vm.h"
+#include "vmhook_internal.h"
+#include "vm_internal.h"
+
+#include "LookupCache.hpp"
+
+extern "C" {
+
+static void hookFieldResolutionCacheFlush(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+static void hookFieldResolutionCacheShutdown(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+
+static VMINLINE UDATA
+fieldResolutionCacheHash(J9Class *clazz, U_8 *fieldName, UDATA fieldNameLength, U_8 *signature, UDATA signatureLength)
+{
+	UDATA hash = (UDATA)clazz >> 3;
+	UDATA i = 0;
+
+	for (i = 0; i < fieldNameLength; ++i) {
+		hash = (hash * 31) + fieldName[i];
+	}
+	for (i = 0; i < signatureLength; ++i) {
+		hash = (hash * 31) + signature[i];
+	}
+	return hash;
+}
+
+static VMINLINE J9FieldResolutionCacheEntry *
+fieldResolutionCacheEntry(J9FieldResolutionCache *cache, UDATA hash)
+{
+	return &cache->entries[(hash ^ (hash >> 11)) & (J9_FIELD_RESOLUTION_CACHE_SIZE - 1)];
+}
+
+/**
+ * Clear the field resolution cache. Classes may be unloaded, and the ROM fields of
+ * redefined classes replaced, once this hook returns.
+ * This is not thread safe: must be called when the caller has exclusive VM access.
+ * userData: java VM
+ */
+static void
+hookFieldResolutionCacheFlush(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	J9JavaVM *vm = (J9JavaVM *) userData;
+	J9FieldResolutionCache *cache = vm->fieldResolutionCache;
+
+	if (NULL != cache) {
+		memset(cache->entries, 0, sizeof(cache->entries));
+		cache->flushes += 1;
+	}
+}
+
+/**
+ * Print the cache counters when the VM shuts down.
+ * userData: java VM
+ */
+static void
+hookFieldResolutionCacheShutdown(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	J9JavaVM *vm = (J9JavaVM *) userData;
+	J9FieldResolutionCache *cache = vm->fieldResolutionCache;
+
+	if (NULL != cache) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+
+		lookupCachePrintStats(vm, "Field resolution cache", cache->hits, cache->misses);
+		j9tty_printf(PORTLIB, "\tinherited=%zu flushes=%zu\n", cache->inherited, cache->flushes);
+	}
+}
+
+/**
+ * Allocate the field resolution cache and register the hooks which flush it.
+ * This is not thread safe. It is called at VM startup.
+ * @param vm: Reference to the VM
+ * @param collectStats: true to count hits and misses and print them at shutdown
+ * @return the cache, or NULL on failure
+ */
+J9FieldResolutionCache *
+fieldResolutionCacheNew(J9JavaVM *vm, BOOLEAN collectStats)
+{
+	J9FieldResolutionCache *cache = (J9FieldResolutionCache *) lookupCacheNew(vm, sizeof(J9FieldResolutionCache), hookFieldResolutionCacheFlush, collectStats ? hookFieldResolutionCacheShutdown : NULL);
+
+	if (NULL != cache) {
+		cache->collectStats = collectStats ? 1 : 0;
+		vm->fieldResolutionCache = cache;
+	}
+	return cache;
+}
+
+/**
+ * Free the field resolution cache.
+ * This is not thread safe. Called during VM shutdown.
+ * @param vm: Reference to the VM
+ */
+void
+fieldResolutionCacheFree(J9JavaVM *vm)
+{
+	J9FieldResolutionCache *cache = vm->fieldResolutionCache;
+
+	vm->fieldResolutionCache = NULL;
+	lookupCacheFree(vm, cache, hookFieldResolutionCacheFlush, hookFieldResolutionCacheShutdown);
+}
+
+/**
+ * Find the field a name and signature resolve to when looked up from a class.
+ * @param cache: the field resolution cache
+ * @param clazz: the class the lookup starts from
+ * @param fieldName: the field name
+ * @param fieldNameLength: the length of the field name
+ * @param signature: the field signature
+ * @param signatureLength: the length of the field signature
+ * @param definingClass: receives the class declaring the field
+ * @param offsetOrAddress: receives the instance offset or the static address of the field
+ * @return the field, or NULL if the lookup must be done
+ */
+J9ROMFieldShape *
+fieldResolutionCacheLookup(J9FieldResolutionCache *cache, J9Class *clazz, U_8 *fieldName, UDATA fieldNameLength, U_8 *signature, UDATA signatureLength, J9Class **definingClass, UDATA *offsetOrAddress)
+{
+	UDATA hash = fieldResolutionCacheHash(clazz, fieldName, fieldNameLength, signature, signatureLength);
+	J9FieldResolutionCacheEntry *entry = fieldResolutionCacheEntry(cache, hash);
+	UDATA sequence = 0;
+	J9ROMFieldShape *found = NULL;
+	J9Class *foundDefiningClass = NULL;
+
+	if (VM_LookupCache::beginRead(&entry->sequence, &sequence)) {
+		/* Snapshot the entry, none of it may be dereferenced until the read is validated */
+		J9Class *entryClazz = entry->clazz;
+		UDATA entryHash = entry->hash;
+		J9ROMFieldShape *field = entry->field;
+		J9Class *entryDefiningClass = entry->definingClass;
+		UDATA entryOffsetOrAddress = entry->offsetOrAddress;
+
+		if (VM_LookupCache::endRead(&entry->sequence, sequence)
+		&& (clazz == entryClazz)
+		&& (hash == entryHash)
+		) {
+			J9UTF8 *name = J9ROMFIELDSHAPE_NAME(field);
+			J9UTF8 *sig = J9ROMFIELDSHAPE_SIGNATURE(field);
+
+			if (J9UTF8_DATA_EQUALS(fieldName, fieldNameLength, J9UTF8_DATA(name), J9UTF8_LENGTH(name))
+			&& J9UTF8_DATA_EQUALS(signature, signatureLength, J9UTF8_DATA(sig), J9UTF8_LENGTH(sig))
+			) {
+				if (NULL != definingClass) {
+					*definingClass = entryDefiningClass;
+				}
+				if (NULL != offsetOrAddress) {
+					*offsetOrAddress = entryOffsetOrAddress;
+				}
+				found = field;
+				foundDefiningClass = entryDefiningClass;
+			}
+		}
+	}
+	if (J9_UNEXPECTED(0 != cache->collectStats)) {
+		if (NULL != found) {
+			cache->hits += 1;
+			if (clazz != foundDefiningClass) {
+				cache->inherited += 1;
+			}
+		} else {
+			cache->misses += 1;
+		}
+	}
+	return found;
+}
+
+/**
+ * Record the field a name and signature resolved to. The entry is left unchanged
+ * if another thread is writing it.
+ * @param cache: the field resolution cache
+ * @param clazz: the class the lookup started from
+ * @param fieldName: the field name
+ * @param fieldNameLength: the length of the field name
+ * @param signature: the field signature
+ * @param signatureLength: the length of the field signature
+ * @param field: the field found
+ * @param definingClass: the class declaring the field
+ * @param offsetOrAddress: the instance offset or the static address of the field
+ */
+void
+fieldResolutionCacheStore(J9FieldResolutionCache *cache, J9Class *clazz, U_8 *fieldName, UDATA fieldNameLength, U_8 *signature, UDATA signatureLength, J9ROMFieldShape *field, J9Class *definingClass, UDATA offsetOrAddress)
+{
+	UDATA hash = fieldResolutionCacheHash(clazz, fieldName, fieldNameLength, signature, signatureLength);
+	J9FieldResolutionCacheEntry *entry = fieldResolutionCacheEntry(cache, hash);
+	UDATA sequence = 0;
+
+	if (VM_LookupCache::beginWrite(&entry->sequence, &sequence)) {
+		entry->clazz = clazz;
+		entry->hash = hash;
+		entry->field = field;
+		entry->definingClass = definingClass;
+		entry->offsetOrAddress = offsetOrAddress;
+		VM_LookupCache::endWrite(&entry->sequence, sequence);
+	}
+}
+
+} /* extern "C" */
@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "j9.h"
+#include "j9protos.h"
+#include "j9consts.h"
+#include "ut_j9vm.h"
+#include "vmhook_internal.h"
+#include "vm_internal.h"
+
+extern "C" {
+
+static void hookInterpreterInlineCachesFlush(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+static void hookInterpreterInlineCachesShutdown(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+
+/**
+ * Clear every call site and iTable cache. Cached classes and methods may be freed
+ * or replaced once this hook returns.
+ * This is not thread safe: must be called when the caller has exclusive VM access.
+ * userData: java VM
+ */
+static void
+hookInterpreterInlineCachesFlush(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	J9JavaVM *vm = (J9JavaVM *) userData;
+	J9InterpreterInlineCaches *caches = vm->interpreterInlineCaches;
+
+	if (NULL != caches) {
+		memset(caches->callSites, 0, sizeof(caches->callSites));
+		memset(caches->iTables, 0, sizeof(caches->iTables));
+		caches->flushes += 1;
+	}
+}
+
+/**
+ * Print the cache counters when the VM shuts down.
+ * userData: java VM
+ */
+static void
+hookInterpreterInlineCachesShutdown(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	J9JavaVM *vm = (J9JavaVM *) userData;
+	J9InterpreterInlineCaches *caches = vm->interpreterInlineCaches;
+	UDATA callSites = 0;
+	UDATA polymorphicSites = 0;
+
+	if (NULL == caches) {
+		return;
+	}
+
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	for (UDATA i = 0; i < J9_INTERP_CALL_SITE_CACHE_SIZE; ++i) {
+		J9InterpreterCallSiteCache *cache = &caches->callSites[i];
+		if (0 != cache->callSite) {
+			callSites += 1;
+			if (0 != cache->receiverClass[J9_INTERP_CALL_SITE_CACHE_ENTRIES - 1]) {
+				polymorphicSites += 1;
+			}
+		}
+	}
+
+	lookupCachePrintStats(vm, "Interpreter call site cache", caches->callSiteHits, caches->callSiteMisses);
+	j9tty_printf(PORTLIB, "\tmegamorphic=%zu collisions=%zu\n", caches->callSiteMegamorphic, caches->callSiteCollisions);
+	j9tty_printf(PORTLIB, "\tcall sites cached=%zu polymorphic=%zu of %zu\n",
+			callSites, polymorphicSites, (UDATA)J9_INTERP_CALL_SITE_CACHE_SIZE);
+	lookupCachePrintStats(vm, "Interpreter itable cache", caches->iTableHits, caches->iTableMisses);
+	j9tty_printf(PORTLIB, "\tflushes=%zu\n", caches->flushes);
+}
+
+/**
+ * Allocate the interpreter inline caches and register the hooks which flush them.
+ * This is not thread safe. It is called at VM startup.
+ * @param vm: Reference to the VM
+ * @param collectStats: true to count hits and misses and print them at shutdown
+ * @return the caches, or NULL on failure
+ */
+J9InterpreterInlineCaches *
+interpreterInlineCachesNew(J9JavaVM *vm, BOOLEAN collectStats)
+{
+	J9InterpreterInlineCaches *caches = (J9InterpreterInlineCaches *) lookupCacheNew(vm, sizeof(J9InterpreterInlineCaches), hookInterpreterInlineCachesFlush, collectStats ? hookInterpreterInlineCachesShutdown : NULL);
+
+	if (NULL != caches) {
+		caches->collectStats = collectStats ? 1 : 0;
+		vm->interpreterInlineCaches = caches;
+	}
+	return caches;
+}
+
+/**
+ * Free the interpreter inline caches.
+ * This is not thread safe. Called during VM shutdown.
+ * @param vm: Reference to the VM
+ */
+void
+interpreterInlineCachesFree(J9JavaVM *vm)
+{
+	J9InterpreterInlineCaches *caches = vm->interpreterInlineCaches;
+
+	vm->interpreterInlineCaches = NULL;
+	lookupCacheFree(vm, caches, hookInterpreterInlineCachesFlush, hookInterpreterInlineCachesShutdown);
+}
+
+} /* extern "C" */
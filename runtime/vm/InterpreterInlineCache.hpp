@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(INTERPRETERINLINECACHE_HPP_)
+#define INTERPRETERINLINECACHE_HPP_
+
+#include "j9.h"
+
+#include "AtomicSupport.hpp"
+
+/**
+ * Per call site inline caches and the hashed iTable lookup used by invokeinterface.
+ *
+ * Slots are published with a compare and swap from NULL to J9_INTERP_INLINE_CACHE_BUSY,
+ * followed by the value stores and a write barrier before the key is stored. A published
+ * slot is never modified by mutator threads, so a reader which observes a matching key
+ * can safely read the value after a read barrier. All slots are cleared together, with
+ * exclusive VM access, when classes are unloaded or redefined.
+ */
+class VM_InterpreterInlineCache {
+	/*
+	 * Function members
+	 */
+private:
+	static VMINLINE UDATA
+	hashPointer(UDATA value)
+	{
+		return (value >> 3) ^ (value >> 11);
+	}
+
+public:
+	static VMINLINE J9InterpreterCallSiteCache *
+	callSiteCache(J9InterpreterInlineCaches *caches, void *callSite)
+	{
+		return &caches->callSites[hashPointer((UDATA)callSite) & (J9_INTERP_CALL_SITE_CACHE_SIZE - 1)];
+	}
+
+	/**
+	 * Look up the target of an invokeinterface call site for a receiver class.
+	 *
+	 * @param caches[in] the inline caches of the VM
+	 * @param callSite[in] the J9RAMInterfaceMethodRef of the call site
+	 * @param receiverClass[in] the class of the receiver
+	 *
+	 * @returns the cached method or NULL if the site has not seen the receiver class
+	 */
+	static VMINLINE J9Method *
+	lookupCallSite(J9InterpreterInlineCaches *caches, void *callSite, J9Class *receiverClass)
+	{
+		J9Method *method = NULL;
+		J9InterpreterCallSiteCache *cache = callSiteCache(caches, callSite);
+		if ((UDATA)callSite == cache->callSite) {
+			for (UDATA i = 0; i < J9_INTERP_CALL_SITE_CACHE_ENTRIES; ++i) {
+				if ((UDATA)receiverClass == cache->receiverClass[i]) {
+					VM_AtomicSupport::readBarrier();
+					method = cache->method[i];
+					break;
+				}
+			}
+		}
+		if (J9_UNEXPECTED(0 != caches->collectStats)) {
+			if (NULL != method) {
+				caches->callSiteHits += 1;
+			} else {
+				caches->callSiteMisses += 1;
+			}
+		}
+		return method;
+	}
+
+	/**
+	 * Record the target of an invokeinterface call site for a receiver class. Nothing is
+	 * recorded if the hash slot belongs to another site or if the site is megamorphic.
+	 *
+	 * @param caches[in] the inline caches of the VM
+	 * @param callSite[in] the J9RAMInterfaceMethodRef of the call site
+	 * @param receiverClass[in] the class of the receiver
+	 * @param method[in] the method selected for the receiver class
+	 */
+	static VMINLINE void
+	updateCallSite(J9InterpreterInlineCaches *caches, void *callSite, J9Class *receiverClass, J9Method *method)
+	{
+		J9InterpreterCallSiteCache *cache = callSiteCache(caches, callSite);
+		if ((UDATA)callSite != cache->callSite) {
+			if (0 != VM_AtomicSupport::lockCompareExchange(&cache->callSite, 0, (UDATA)callSite)) {
+				if ((UDATA)callSite != cache->callSite) {
+					if (0 != caches->collectStats) {
+						caches->callSiteCollisions += 1;
+					}
+					return;
+				}
+			}
+		}
+		for (UDATA i = 0; i < J9_INTERP_CALL_SITE_CACHE_ENTRIES; ++i) {
+			UDATA volatile *slot = &cache->receiverClass[i];
+			if (0 == *slot) {
+				if (0 == VM_AtomicSupport::lockCompareExchange(slot, 0, J9_INTERP_INLINE_CACHE_BUSY)) {
+					cache->method[i] = method;
+					VM_AtomicSupport::writeBarrier();
+					*slot = (UDATA)receiverClass;
+					return;
+				}
+			}
+			if ((UDATA)receiverClass == *slot) {
+				/* Another thread recorded the same receiver */
+				return;
+			}
+		}
+		if (0 != caches->collectStats) {
+			caches->callSiteMegamorphic += 1;
+		}
+	}
+
+	/**
+	 * Find the iTable of an interface in a receiver class whose iTable chain is deep.
+	 *
+	 * @param caches[in] the inline caches of the VM
+	 * @param receiverClass[in] the class of the receiver
+	 * @param interfaceClass[in] the interface being searched for
+	 *
+	 * @returns the iTable or NULL if it is not in the cache
+	 */
+	static VMINLINE J9ITable *
+	lookupITable(J9InterpreterInlineCaches *caches, J9Class *receiverClass, J9Class *interfaceClass)
+	{
+		J9ITable *iTable = NULL;
+		J9InterpreterITableCacheEntry *entry = &caches->iTables[(hashPointer((UDATA)receiverClass) ^ hashPointer((UDATA)interfaceClass)) & (J9_INTERP_ITABLE_CACHE_SIZE - 1)];
+		if ((UDATA)receiverClass == entry->receiverClass) {
+			VM_AtomicSupport::readBarrier();
+			if (interfaceClass == entry->interfaceClass) {
+				iTable = entry->iTable;
+			}
+		}
+		if (J9_UNEXPECTED(0 != caches->collectStats)) {
+			if (NULL != iTable) {
+				caches->iTableHits += 1;
+			} else {
+				caches->iTableMisses += 1;
+			}
+		}
+		return iTable;
+	}
+
+	static VMINLINE void
+	updateITable(J9InterpreterInlineCaches *caches, J9Class *receiverClass, J9ITable *iTable)
+	{
+		J9Class *interfaceClass = iTable->interfaceClass;
+		J9InterpreterITableCacheEntry *entry = &caches->iTables[(hashPointer((UDATA)receiverClass) ^ hashPointer((UDATA)interfaceClass)) & (J9_INTERP_ITABLE_CACHE_SIZE - 1)];
+		if (0 == entry->receiverClass) {
+			if (0 == VM_AtomicSupport::lockCompareExchange(&entry->receiverClass, 0, J9_INTERP_INLINE_CACHE_BUSY)) {
+				entry->interfaceClass = interfaceClass;
+				entry->iTable = iTable;
+				VM_AtomicSupport::writeBarrier();
+				entry->receiverClass = (UDATA)receiverClass;
+			}
+		}
+	}
+};
+
+#endif /* INTERPRETERINLINECACHE_HPP_ */
@@ -46,6 +46,7 @@ typedef struct KeyHashTableClassQueryEntry {
 	KeyHashTableClassEntry entry;
 	U_8 *charData;
 	UDATA length;
+	UDATA hash; /* set by classHashFn for class name queries */
 } KeyHashTableClassQueryEntry;
 
 static UDATA classHashFn(void *key, void *userData);
@@ -98,8 +99,30 @@ classHashEqualFn(void *tableNode, void *queryNode, void *userData)
 	UDATA queryNodeLength = 0;
 	const U_8 *tableNodeName = NULL;
 	const U_8 *queryNodeName = NULL;
-	UDATA tableNodeType = classHashGetName(tableNode, &tableNodeName, &tableNodeLength);
-	UDATA queryNodeType = classHashGetName(queryNode, &queryNodeName, &queryNodeLength);
+	UDATA tableNodeType = TYPE_CLASS;
+	UDATA queryNodeType = TYPE_CLASS;
+	UDATA tableNodeTag = ((KeyHashTableClassEntry *)tableNode)->tag;
+	UDATA queryNodeTag = ((KeyHashTableClassEntry *)queryNode)->tag;
+
+	/* Reject mismatched class names by their hashes before comparing the names */
+	if (TAG_RAM_CLASS == (tableNodeTag & MASK_RAM_CLASS)) {
+		UDATA tableNodeHash = ((KeyHashTableClassEntry *)tableNode)->ramClass->classNameHash;
+
+		if (TAG_RAM_CLASS == (queryNodeTag & MASK_RAM_CLASS)) {
+			if (tableNodeHash != ((KeyHashTableClassEntry *)queryNode)->ramClass->classNameHash) {
+				return FALSE;
+			}
+		} else if ((TAG_UTF_QUERY == (queryNodeTag & MASK_QUERY))
+			|| (TAG_UNICODE_QUERY == (queryNodeTag & MASK_QUERY))
+		) {
+			if (tableNodeHash != ((KeyHashTableClassQueryEntry *)queryNode)->hash) {
+				return FALSE;
+			}
+		}
+	}
+
+	tableNodeType = classHashGetName(tableNode, &tableNodeName, &tableNodeLength);
+	queryNodeType = classHashGetName(queryNode, &queryNodeName, &queryNodeLength);
 
 	if (queryNodeType == TYPE_UNICODE) {
 		if (tableNodeType == TYPE_CLASS) {
@@ -181,6 +204,49 @@ classHashEqualFn(void *tableNode, void *queryNode, void *userData)
 	return J9UTF8_DATA_EQUALS(tableNodeName, tableNodeLength, queryNodeName, queryNodeLength);
 }
 
+U_32
+hashClassName(const U_8 *name, UDATA length)
+{
+	U_32 hash = 0;
+
+	while (length != 0) {
+		U_16 unicodeChar = 0;
+		U_8 c = *(name++);
+
+		if ((c & 0x80) == 0x00) {
+			/* one byte encoding */
+
+			unicodeChar = (U_16)c;
+			length -= 1;
+		} else if ((c & 0xE0) == 0xC0) {
+			/* two byte encoding */
+
+			unicodeChar = ((U_16)c & 0x1F) << 6;
+			c = *(name++);
+			unicodeChar += (U_16)c & 0x3F;
+			length -= 2;
+		} else {
+			/* three byte encoding */
+
+			unicodeChar = ((U_16)c & 0x0F) << 12;
+			c = *(name++);
+			unicodeChar += ((U_16)c & 0x3F) << 6;
+			c = *(name++);
+			unicodeChar += (U_16)c & 0x3F;
+			length -= 3;
+		}
+
+		/* Make the String and internal representations of the class name consistent */
+
+		if ('/' == unicodeChar) {
+			unicodeChar = '.';
+		}
+		hash = (hash << 5) - hash + unicodeChar;
+	}
+
+	return hash;
+}
+
 static UDATA
 classHashFn(void *key, void *userData)
 {
@@ -188,8 +254,15 @@ classHashFn(void *key, void *userData)
 	UDATA length = 0;
 	const U_8 *name = NULL;
 	U_32 hash = 0;
-	UDATA type = classHashGetName(key, &name, &length);
+	UDATA tag = ((KeyHashTableClassEntry *)key)->tag;
+	UDATA type = TYPE_CLASS;
 
+	/* The name of a RAM class is hashed once, when the class is added to the table */
+	if (TAG_RAM_CLASS == (tag & MASK_RAM_CLASS)) {
+		return ((KeyHashTableClassEntry *)key)->ramClass->classNameHash;
+	}
+
+	type = classHashGetName(key, &name, &length);
 	if (type == TYPE_UNICODE) {
 		j9object_t stringObject = (j9object_t)name;
 
@@ -215,45 +288,14 @@ classHashFn(void *key, void *userData)
 		}
 		type = TYPE_CLASS;
 	} else {
-		hash = 0;
-		while (length != 0) {
-			U_16 unicodeChar = 0;
-			U_8 c = *(name++);
-
-			if ((c & 0x80) == 0x00) {
-				/* one byte encoding */
-
-				unicodeChar = (U_16)c;
-				length -= 1;
-			} else if ((c & 0xE0) == 0xC0) {
-				/* two byte encoding */
-
-				unicodeChar = ((U_16)c & 0x1F) << 6;
-				c = *(name++);
-				unicodeChar += (U_16)c & 0x3F;
-				length -= 2;
-			} else {
-				/* three byte encoding */
-
-				unicodeChar = ((U_16)c & 0x0F) << 12;
-				c = *(name++);
-				unicodeChar += ((U_16)c & 0x3F) << 6;
-				c = *(name++);
-				unicodeChar += (U_16)c & 0x3F;
-				length -= 3;
-			}
-
-			/* Make the String and internal representations of the class name consistent */
-
-			if ('/' == unicodeChar) {
-				unicodeChar = '.';
-			}
-			hash = (hash << 5) - hash + unicodeChar;
-		}
+		hash = hashClassName(name, length);
 	}
 
 	if (TYPE_PACKAGEID == type) {
 		hash = hash ^ (U_32)type;
+	} else if ((TAG_UTF_QUERY == (tag & MASK_QUERY)) || (TAG_UNICODE_QUERY == (tag & MASK_QUERY))) {
+		/* Remember the hash of the query so that classHashEqualFn can compare it */
+		((KeyHashTableClassQueryEntry *)key)->hash = hash;
 	}
 
 	return hash;
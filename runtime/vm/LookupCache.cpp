@@ -0,0 +1,123 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "j9.h"
+#include "j9protos.h"
+#include "j9consts.h"
+#include "vmhook_internal.h"
+#include "vm_internal.h"
+
+extern "C" {
+
+/**
+ * Allocate a VM lookup cache and register the hooks which clear it and print its counters.
+ * flushHook is called with exclusive VM access when classes are redefined or unloaded, before
+ * their memory may be reused. statsHook, if not NULL, is called when the VM shuts down.
+ * Both hooks are passed the VM as userData.
+ * This is not thread safe. It is called at VM startup.
+ * @param vm: Reference to the VM
+ * @param size: the size of the cache in bytes
+ * @param flushHook: the hook which clears the cache
+ * @param statsHook: the hook which prints the counters, or NULL
+ * @return the zeroed cache, or NULL on failure
+ */
+void *
+lookupCacheNew(J9JavaVM *vm, UDATA size, J9HookFunction flushHook, J9HookFunction statsHook)
+{
+	J9HookInterface **vmHooks = J9_HOOK_INTERFACE(vm->hookInterface);
+	void *cache = NULL;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	cache = j9mem_allocate_memory(size, OMRMEM_CATEGORY_VM);
+	if (NULL != cache) {
+		memset(cache, 0, size);
+		if (0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CLASSES_REDEFINED, flushHook, OMR_GET_CALLSITE(), vm)) {
+			goto fail;
+		}
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+		if ((0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CLASSES_UNLOAD, flushHook, OMR_GET_CALLSITE(), vm))
+		|| (0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_ANON_CLASSES_UNLOAD, flushHook, OMR_GET_CALLSITE(), vm))
+		) {
+			goto fail;
+		}
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+		if (NULL != statsHook) {
+			if (0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_SHUTTING_DOWN, statsHook, OMR_GET_CALLSITE(), vm)) {
+				goto fail;
+			}
+		}
+	}
+	return cache;
+
+fail:
+	lookupCacheFree(vm, cache, flushHook, statsHook);
+	return NULL;
+}
+
+/**
+ * Unregister the hooks of a VM lookup cache and free it.
+ * This is not thread safe. Called during VM shutdown, or when lookupCacheNew() fails.
+ * @param vm: Reference to the VM
+ * @param cache: the cache, or NULL
+ * @param flushHook: the hook passed to lookupCacheNew()
+ * @param statsHook: the hook passed to lookupCacheNew()
+ */
+void
+lookupCacheFree(J9JavaVM *vm, void *cache, J9HookFunction flushHook, J9HookFunction statsHook)
+{
+	if (NULL != cache) {
+		J9HookInterface **vmHooks = J9_HOOK_INTERFACE(vm->hookInterface);
+		PORT_ACCESS_FROM_JAVAVM(vm);
+
+		(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_CLASSES_REDEFINED, flushHook, vm);
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+		(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_CLASSES_UNLOAD, flushHook, vm);
+		(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_ANON_CLASSES_UNLOAD, flushHook, vm);
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+		if (NULL != statsHook) {
+			(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_SHUTTING_DOWN, statsHook, vm);
+		}
+		j9mem_free_memory(cache);
+	}
+}
+
+/**
+ * Print the hit and miss counters of a VM lookup cache.
+ * @param vm: Reference to the VM
+ * @param name: the name of the cache
+ * @param hits: the number of lookups which found an entry
+ * @param misses: the number of lookups which did not
+ */
+void
+lookupCachePrintStats(J9JavaVM *vm, const char *name, UDATA hits, UDATA misses)
+{
+	UDATA lookups = hits + misses;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	j9tty_printf(PORTLIB, "%s statistics:\n", name);
+	j9tty_printf(PORTLIB, "\thits=%zu misses=%zu hit rate=%zu%%\n",
+			hits, misses, (0 == lookups) ? (UDATA)0 : ((hits * 100) / lookups));
+}
+
+} /* extern "C" */
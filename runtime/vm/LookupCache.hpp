@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(LOOKUPCACHE_HPP_)
+#define LOOKUPCACHE_HPP_
+
+#include "j9.h"
+
+#include "AtomicSupport.hpp"
+
+/**
+ * The sequence protocol used by the entries of the stack map and field resolution caches.
+ *
+ * A writer claims an entry by moving its sequence from even to odd with a compare and
+ * swap, stores the entry and then makes the sequence even again. A reader which sees an
+ * odd sequence, or a sequence which changed while it was reading the entry, treats the
+ * entry as a miss. Entries are only cleared with exclusive VM access.
+ */
+class VM_LookupCache {
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Start reading an entry.
+	 *
+	 * @param sequence[in] the sequence of the entry
+	 * @param readSequence[out] the sequence to pass to endRead()
+	 *
+	 * @returns true if the entry may be read, false if it is being written
+	 */
+	static VMINLINE bool
+	beginRead(UDATA volatile *sequence, UDATA *readSequence)
+	{
+		UDATA value = *sequence;
+		*readSequence = value;
+		if (J9_ARE_ANY_BITS_SET(value, 1)) {
+			return false;
+		}
+		VM_AtomicSupport::readBarrier();
+		return true;
+	}
+
+	/**
+	 * Finish reading an entry.
+	 *
+	 * @param sequence[in] the sequence of the entry
+	 * @param readSequence[in] the sequence returned by beginRead()
+	 *
+	 * @returns true if the values read are consistent, false if the entry was written meanwhile
+	 */
+	static VMINLINE bool
+	endRead(UDATA volatile *sequence, UDATA readSequence)
+	{
+		VM_AtomicSupport::readBarrier();
+		return readSequence == *sequence;
+	}
+
+	/**
+	 * Claim an entry for writing.
+	 *
+	 * @param sequence[in] the sequence of the entry
+	 * @param writeSequence[out] the sequence to pass to endWrite()
+	 *
+	 * @returns true if the entry was claimed, false if another thread is writing it
+	 */
+	static VMINLINE bool
+	beginWrite(UDATA volatile *sequence, UDATA *writeSequence)
+	{
+		UDATA value = *sequence;
+		if (J9_ARE_ANY_BITS_SET(value, 1) || (value != VM_AtomicSupport::lockCompareExchange(sequence, value, value + 1))) {
+			return false;
+		}
+		VM_AtomicSupport::writeBarrier();
+		*writeSequence = value;
+		return true;
+	}
+
+	/**
+	 * Publish an entry claimed by beginWrite().
+	 *
+	 * @param sequence[in] the sequence of the entry
+	 * @param writeSequence[in] the sequence returned by beginWrite()
+	 */
+	static VMINLINE void
+	endWrite(UDATA volatile *sequence, UDATA writeSequence)
+	{
+		VM_AtomicSupport::writeBarrier();
+		*sequence = writeSequence + 2;
+	}
+};
+
+#endif /* LOOKUPCACHE_HPP_ */
@@ -0,0 +1,189 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "j9.h"
+#include "j9protos.h"
+#include "j9consts.h"
+#include "ut_j9vm.h"
+#include "vmhook_internal.h"
+#include "vm_internal.h"
+
+#include "LookupCache.hpp"
+
+extern "C" {
+
+static void hookStackMapCacheFlush(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+static void hookStackMapCacheShutdown(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+
+static VMINLINE J9StackMapCacheEntry *
+stackMapCacheEntry(J9StackMapCache *cache, J9ROMMethod *romMethod, UDATA offsetPC, UDATA countAndKind)
+{
+	UDATA hash = ((UDATA)romMethod >> 3) ^ (offsetPC * 31) ^ countAndKind;
+	return &cache->entries[(hash ^ (hash >> 11)) & (J9_STACKMAP_CACHE_SIZE - 1)];
+}
+
+/**
+ * Clear the stack map cache. ROM methods of unloaded classes may be freed and
+ * their memory reused once this hook returns.
+ * This is not thread safe: must be called when the caller has exclusive VM access.
+ * userData: java VM
+ */
+static void
+hookStackMapCacheFlush(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	J9JavaVM *vm = (J9JavaVM *) userData;
+	J9StackMapCache *cache = vm->stackMapCache;
+
+	if (NULL != cache) {
+		memset(cache->entries, 0, sizeof(cache->entries));
+		cache->flushes += 1;
+	}
+}
+
+/**
+ * Print the cache counters when the VM shuts down.
+ * userData: java VM
+ */
+static void
+hookStackMapCacheShutdown(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	J9JavaVM *vm = (J9JavaVM *) userData;
+	J9StackMapCache *cache = vm->stackMapCache;
+
+	if (NULL != cache) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+
+		lookupCachePrintStats(vm, "Stack map cache", cache->hits, cache->misses);
+		j9tty_printf(PORTLIB, "\tuncacheable=%zu flushes=%zu\n", cache->uncacheable, cache->flushes);
+	}
+}
+
+/**
+ * Allocate the stack map cache and register the hooks which flush it.
+ * This is not thread safe. It is called at VM startup.
+ * @param vm: Reference to the VM
+ * @param collectStats: true to count hits and misses and print them at shutdown
+ * @return the cache, or NULL on failure
+ */
+J9StackMapCache *
+stackMapCacheNew(J9JavaVM *vm, BOOLEAN collectStats)
+{
+	J9StackMapCache *cache = (J9StackMapCache *) lookupCacheNew(vm, sizeof(J9StackMapCache), hookStackMapCacheFlush, collectStats ? hookStackMapCacheShutdown : NULL);
+
+	if (NULL != cache) {
+		cache->collectStats = collectStats ? 1 : 0;
+		vm->stackMapCache = cache;
+	}
+	return cache;
+}
+
+/**
+ * Free the stack map cache.
+ * This is not thread safe. Called during VM shutdown.
+ * @param vm: Reference to the VM
+ */
+void
+stackMapCacheFree(J9JavaVM *vm)
+{
+	J9StackMapCache *cache = vm->stackMapCache;
+
+	vm->stackMapCache = NULL;
+	lookupCacheFree(vm, cache, hookStackMapCacheFlush, hookStackMapCacheShutdown);
+}
+
+/**
+ * Copy the cached object slot bits of a bytecode PC into result.
+ * @param cache: the stack map cache
+ * @param kind: J9_STACKMAP_CACHE_LOCALS or J9_STACKMAP_CACHE_STACK
+ * @param romMethod: the method being walked
+ * @param offsetPC: the bytecode index
+ * @param count: the number of mapped slots
+ * @param mapper: identifies the mapper which computed the bits
+ * @param result: receives ((count + 31) / 32) words of bits
+ * @return TRUE if result was filled in, FALSE if the map must be computed
+ */
+BOOLEAN
+stackMapCacheLookup(J9StackMapCache *cache, UDATA kind, J9ROMMethod *romMethod, UDATA offsetPC, UDATA count, UDATA mapper, U_32 *result)
+{
+	BOOLEAN found = FALSE;
+
+	if (count <= J9_STACKMAP_CACHE_MAX_SLOTS) {
+		UDATA countAndKind = (count << 1) | kind;
+		J9StackMapCacheEntry *entry = stackMapCacheEntry(cache, romMethod, offsetPC, countAndKind);
+		UDATA sequence = 0;
+
+		if (VM_LookupCache::beginRead(&entry->sequence, &sequence)) {
+			if ((romMethod == entry->romMethod)
+			&& (offsetPC == entry->offsetPC)
+			&& (countAndKind == entry->countAndKind)
+			&& (mapper == entry->mapper)
+			) {
+				memcpy(result, entry->bits, ((count + 31) / 32) * sizeof(U_32));
+				found = VM_LookupCache::endRead(&entry->sequence, sequence);
+			}
+		}
+		if (J9_UNEXPECTED(0 != cache->collectStats)) {
+			if (found) {
+				cache->hits += 1;
+			} else {
+				cache->misses += 1;
+			}
+		}
+	} else if (J9_UNEXPECTED(0 != cache->collectStats)) {
+		cache->uncacheable += 1;
+	}
+	return found;
+}
+
+/**
+ * Record the object slot bits computed for a bytecode PC. The entry is left unchanged
+ * if another thread is writing it.
+ * @param cache: the stack map cache
+ * @param kind: J9_STACKMAP_CACHE_LOCALS or J9_STACKMAP_CACHE_STACK
+ * @param romMethod: the method being walked
+ * @param offsetPC: the bytecode index
+ * @param count: the number of mapped slots
+ * @param mapper: identifies the mapper which computed the bits
+ * @param bits: ((count + 31) / 32) words of bits
+ */
+void
+stackMapCacheStore(J9StackMapCache *cache, UDATA kind, J9ROMMethod *romMethod, UDATA offsetPC, UDATA count, UDATA mapper, U_32 *bits)
+{
+	if (count <= J9_STACKMAP_CACHE_MAX_SLOTS) {
+		UDATA countAndKind = (count << 1) | kind;
+		J9StackMapCacheEntry *entry = stackMapCacheEntry(cache, romMethod, offsetPC, countAndKind);
+		UDATA sequence = 0;
+
+		if (VM_LookupCache::beginWrite(&entry->sequence, &sequence)) {
+			entry->romMethod = romMethod;
+			entry->offsetPC = offsetPC;
+			entry->countAndKind = countAndKind;
+			entry->mapper = mapper;
+			memcpy(entry->bits, bits, ((count + 31) / 32) * sizeof(U_32));
+			VM_LookupCache::endWrite(&entry->sequence, sequence);
+		}
+	}
+}
+
+} /* extern "C" */
@@ -2529,6 +2529,8 @@ fail:
 
 			/* Default to no class path entry. */
 			ramClass->romClass = romClass;
+			/* The class table reads the name hash without locking, so it must be set before the class is published */
+			ramClass->classNameHash = hashClassName(J9UTF8_DATA(className), J9UTF8_LENGTH(className));
 			ramClass->eyecatcher = 0x99669966;
 			ramClass->module = NULL;
 			ramClass->reservedCounter = 0;
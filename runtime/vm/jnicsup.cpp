@@ -1477,10 +1477,118 @@ void  initializeJNITable(J9JavaVM *vm)
 }
 
 
+/*
+ * Return the global reference slot cache of the current thread, allocating it on first use.
+ * Returns NULL if the cache is disabled or cannot be allocated, in which case the caller
+ * must allocate and free slots directly from the pools.
+ */
+static J9JNIGlobalRefCache *
+getJNIGlobalRefCache(J9VMThread *vmThread)
+{
+	J9JNIGlobalRefCache *cache = vmThread->jniGlobalRefCache;
+	if (NULL == cache) {
+		J9JavaVM *vm = vmThread->javaVM;
+		/* The realtime access barrier must observe every store to a global reference slot */
+		if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_JNI_GLOBAL_REF_THREAD_CACHE)
+		&& J9_ARE_NO_BITS_SET(vm->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_USER_REALTIME_ACCESS_BARRIER)
+		) {
+			PORT_ACCESS_FROM_JAVAVM(vm);
+			cache = (J9JNIGlobalRefCache *)j9mem_allocate_memory(sizeof(J9JNIGlobalRefCache), J9MEM_CATEGORY_JNI);
+			if (NULL != cache) {
+				memset(cache, 0, sizeof(J9JNIGlobalRefCache));
+				vmThread->jniGlobalRefCache = cache;
+			}
+		}
+	}
+	return cache;
+}
+
+/*
+ * Move up to J9_JNI_GLOBAL_REF_CACHE_BATCH new slots from a pool into an empty cache.
+ * The slots are cleared under the mutex, so a concurrent collector walking the pool
+ * sees either NULL or the object stored once the slot is handed out.
+ */
+static void
+refillJNIGlobalRefCache(J9JavaVM *vm, J9JNIGlobalRefCache *cache, UDATA kind)
+{
+	J9Pool *pool = (J9_JNI_GLOBAL_REF_CACHE_WEAK == kind) ? vm->jniWeakGlobalReferences : vm->jniGlobalReferences;
+	UDATA count = 0;
+
+#ifdef J9VM_THR_PREEMPTIVE
+	omrthread_monitor_enter(vm->jniFrameMutex);
+#endif
+
+	while (count < J9_JNI_GLOBAL_REF_CACHE_BATCH) {
+		j9object_t *slot = (j9object_t*)pool_newElement(pool);
+		if (NULL == slot) {
+			break;
+		}
+		*slot = NULL;
+		cache->slots[kind][count] = slot;
+		count += 1;
+	}
+
+#ifdef J9VM_THR_PREEMPTIVE
+	omrthread_monitor_exit(vm->jniFrameMutex);
+#endif
+
+	cache->count[kind] = count;
+}
+
+/*
+ * Return the topmost flushCount slots of one kind from the cache to their pool.
+ * Slots which do not belong to the pool (invalid deletes) are dropped.
+ */
+static void
+flushJNIGlobalRefCacheSlots(J9JavaVM *vm, J9JNIGlobalRefCache *cache, UDATA kind, UDATA flushCount)
+{
+	J9Pool *pool = (J9_JNI_GLOBAL_REF_CACHE_WEAK == kind) ? vm->jniWeakGlobalReferences : vm->jniGlobalReferences;
+	UDATA count = cache->count[kind];
+
+	Assert_VM_true(flushCount <= count);
+
+#ifdef J9VM_THR_PREEMPTIVE
+	omrthread_monitor_enter(vm->jniFrameMutex);
+#endif
+
+	while (0 != flushCount) {
+		j9object_t *slot = cache->slots[kind][--count];
+		if (pool_includesElement(pool, slot) == TRUE) {
+			pool_removeElement(pool, slot);
+		}
+		flushCount -= 1;
+	}
+
+#ifdef J9VM_THR_PREEMPTIVE
+	omrthread_monitor_exit(vm->jniFrameMutex);
+#endif
+
+	cache->count[kind] = count;
+}
+
+void
+flushJNIGlobalRefCache(J9VMThread *currentThread)
+{
+	J9JNIGlobalRefCache *cache = currentThread->jniGlobalRefCache;
+
+	Assert_VM_mustHaveVMAccess(currentThread);
+
+	if (NULL != cache) {
+		J9JavaVM *vm = currentThread->javaVM;
+		flushJNIGlobalRefCacheSlots(vm, cache, J9_JNI_GLOBAL_REF_CACHE_STRONG, cache->count[J9_JNI_GLOBAL_REF_CACHE_STRONG]);
+		flushJNIGlobalRefCacheSlots(vm, cache, J9_JNI_GLOBAL_REF_CACHE_WEAK, cache->count[J9_JNI_GLOBAL_REF_CACHE_WEAK]);
+	}
+}
+
 /*
  * 1) Private routine.  Used to delete a jni global reference from an actual object pointer.
  * 2) We don't acquire VM access - caller must already have it.
  * 3) globalRef may be NULL
+ * 4) With the thread cache enabled, the slot is cleared and kept by the current thread without
+ *    taking the jniFrameMutex. Pool membership is only checked when the cache overflows.
+ * 5) A slot which already holds NULL is never cached: it was either deleted before or is a
+ *    cleared weak reference. Deleting it again from the current thread is ignored, otherwise
+ *    it goes back to the pool under the mutex.
  */
 void JNICALL
 j9jni_deleteGlobalRef(JNIEnv *env, jobject globalRef, jboolean isWeak)
@@ -1491,6 +1599,26 @@ j9jni_deleteGlobalRef(JNIEnv *env, jobject globalRef, jboolean isWeak)
 	Assert_VM_mustHaveVMAccess(vmThread);
 
 	if (globalRef != NULL) {
+		J9JNIGlobalRefCache *cache = getJNIGlobalRefCache(vmThread);
+
+		if (NULL != cache) {
+			UDATA kind = isWeak ? J9_JNI_GLOBAL_REF_CACHE_WEAK : J9_JNI_GLOBAL_REF_CACHE_STRONG;
+			if (NULL != *(j9object_t*)globalRef) {
+				if (J9_JNI_GLOBAL_REF_CACHE_SIZE == cache->count[kind]) {
+					flushJNIGlobalRefCacheSlots(vm, cache, kind, J9_JNI_GLOBAL_REF_CACHE_BATCH);
+				}
+				*(j9object_t*)globalRef = NULL;
+				cache->slots[kind][cache->count[kind]] = (j9object_t*)globalRef;
+				cache->count[kind] += 1;
+				return;
+			}
+			for (UDATA i = 0; i < cache->count[kind]; ++i) {
+				if ((j9object_t*)globalRef == cache->slots[kind][i]) {
+					/* Deleted twice, the slot must not be handed out to two creators */
+					return;
+				}
+			}
+		}
 
 #ifdef J9VM_THR_PREEMPTIVE
 		omrthread_monitor_enter(vm->jniFrameMutex);
@@ -1524,11 +1652,27 @@ j9jni_createGlobalRef(JNIEnv *env, j9object_t object, jboolean isWeak)
 {
 	J9VMThread * vmThread = (J9VMThread *) env;
 	J9JavaVM * vm = vmThread->javaVM;
+	J9JNIGlobalRefCache *cache = NULL;
 	j9object_t * result;
 
 	Assert_VM_mustHaveVMAccess(vmThread);
 	Assert_VM_notNull(object);
 
+	cache = getJNIGlobalRefCache(vmThread);
+	if (NULL != cache) {
+		UDATA kind = isWeak ? J9_JNI_GLOBAL_REF_CACHE_WEAK : J9_JNI_GLOBAL_REF_CACHE_STRONG;
+		if (0 == cache->count[kind]) {
+			refillJNIGlobalRefCache(vm, cache, kind);
+		}
+		if (0 != cache->count[kind]) {
+			cache->count[kind] -= 1;
+			result = cache->slots[kind][cache->count[kind]];
+			/* The slot already holds NULL, so a concurrent collector never reads garbage from it */
+			*result = object;
+			return (jobject) result;
+		}
+	}
+
 #ifdef J9VM_THR_PREEMPTIVE
 	omrthread_monitor_enter(vm->jniFrameMutex);
 #endif
@@ -254,6 +254,10 @@ deallocateVMThread(J9VMThread * vmThread, UDATA decrementZombieCount, UDATA send
 
 	j9mem_free_memory(vmThread->lastDecompilation);
 
+	/* threadCleanup() has returned any cached slots to the global reference pools */
+	j9mem_free_memory(vmThread->jniGlobalRefCache);
+	vmThread->jniGlobalRefCache = NULL;
+
 #if defined(J9VM_JIT_DYNAMIC_LOOP_TRANSFER)
 	if (vmThread->dltBlock.temps != vmThread->dltBlock.inlineTempsBuffer) {
 		j9mem_free_memory(vmThread->dltBlock.temps);
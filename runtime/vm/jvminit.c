@@ -817,6 +817,13 @@ freeJavaVM(J9JavaVM * vm)
 	fieldIndexTableFree(vm);
 #endif
 
+	interpreterInlineCachesFree(vm);
+	stackMapCacheFree(vm);
+	fieldResolutionCacheFree(vm);
+	allocationProfilerFree(vm);
+	j9mem_free_memory(vm->throwSiteCounters);
+	vm->throwSiteCounters = NULL;
+
 	/* Close the trace DLL. This has to be after all hashtable and pool free events, otherwise we'll crash on pool tracepoints */
 	if (0 != traceDescriptor) {
 		j9sl_close_shared_library(traceDescriptor);
@@ -1987,6 +1994,104 @@ IDATA VMInitStages(J9JavaVM *vm, IDATA stage, void* reserved) {
 				vm->extendedRuntimeFlags2 &= ~J9_EXTENDED_RUNTIME2_ENABLE_DEEPSCAN;
 			}
 
+			argIndex = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXINTERPRETERINLINECACHES, NULL);
+			argIndex2 = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXNOINTERPRETERINLINECACHES, NULL);
+
+			/* Enable the invokeinterface inline caches by default */
+			if (argIndex >= argIndex2) {
+				BOOLEAN collectStats = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXPRINTINTERPRETERINLINECACHESTATS, NULL) >= 0;
+				if (NULL == interpreterInlineCachesNew(vm, collectStats)) {
+					goto _error;
+				}
+			}
+
+			argIndex = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXSTACKMAPCACHE, NULL);
+			argIndex2 = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXNOSTACKMAPCACHE, NULL);
+
+			/* Enable the cache of bytecode frame maps by default */
+			if (argIndex >= argIndex2) {
+				BOOLEAN collectStats = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXPRINTSTACKMAPCACHESTATS, NULL) >= 0;
+				if (NULL == stackMapCacheNew(vm, collectStats)) {
+					goto _error;
+				}
+			}
+
+			argIndex = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXFIELDRESOLUTIONCACHE, NULL);
+			argIndex2 = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXNOFIELDRESOLUTIONCACHE, NULL);
+
+			/* Enable the cache of resolved field names by default */
+			if (argIndex >= argIndex2) {
+				BOOLEAN collectStats = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXPRINTFIELDRESOLUTIONCACHESTATS, NULL) >= 0;
+				if (NULL == fieldResolutionCacheNew(vm, collectStats)) {
+					goto _error;
+				}
+			}
+
+			/* By default every Throwable records its complete stack trace */
+			if ((argIndex = FIND_AND_CONSUME_ARG(STARTSWITH_MATCH, VMOPT_XXSTACKTRACETHROWSITELIMIT_EQUALS, NULL)) >= 0) {
+				UDATA limit = 0;
+				char *optname = VMOPT_XXSTACKTRACETHROWSITELIMIT_EQUALS;
+				parseError = GET_INTEGER_VALUE(argIndex, optname, limit);
+				if (OPTION_OK != parseError) {
+					parseErrorOption = VMOPT_XXSTACKTRACETHROWSITELIMIT_EQUALS;
+					goto _memParseError;
+				}
+				if (0 != limit) {
+					UDATA tableSize = J9_THROW_SITE_TABLE_SIZE * sizeof(J9ThrowSiteCounter);
+					vm->throwSiteCounters = (J9ThrowSiteCounter *)j9mem_allocate_memory(tableSize, OMRMEM_CATEGORY_VM);
+					if (NULL == vm->throwSiteCounters) {
+						goto _error;
+					}
+					memset(vm->throwSiteCounters, 0, tableSize);
+					vm->stackTraceThrowSiteLimit = limit;
+				}
+			}
+
+			argIndex = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXJNIGLOBALREFTHREADCACHE, NULL);
+			argIndex2 = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXNOJNIGLOBALREFTHREADCACHE, NULL);
+
+			/* Cache JNI global reference slots per thread by default */
+			if (argIndex >= argIndex2) {
+				vm->extendedRuntimeFlags2 |= J9_EXTENDED_RUNTIME2_JNI_GLOBAL_REF_THREAD_CACHE;
+			}
+
+			argIndex = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXALLOCATIONPROFILER, NULL);
+			argIndex2 = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXNOALLOCATIONPROFILER, NULL);
+
+			/* The allocation profiler is disabled by default */
+			if (argIndex > argIndex2) {
+				UDATA interval = J9_ALLOCATION_PROFILER_DEFAULT_INTERVAL;
+				UDATA maxDepth = J9_ALLOCATION_PROFILER_DEFAULT_DEPTH;
+
+				if ((argIndex = FIND_AND_CONSUME_ARG(STARTSWITH_MATCH, VMOPT_XXALLOCATIONPROFILERINTERVAL_EQUALS, NULL)) >= 0) {
+					char *optname = VMOPT_XXALLOCATIONPROFILERINTERVAL_EQUALS;
+					parseError = GET_MEMORY_VALUE(argIndex, optname, interval);
+					if (OPTION_OK != parseError) {
+						parseErrorOption = VMOPT_XXALLOCATIONPROFILERINTERVAL_EQUALS;
+						goto _memParseError;
+					}
+				}
+				if ((argIndex = FIND_AND_CONSUME_ARG(STARTSWITH_MATCH, VMOPT_XXALLOCATIONPROFILERDEPTH_EQUALS, NULL)) >= 0) {
+					char *optname = VMOPT_XXALLOCATIONPROFILERDEPTH_EQUALS;
+					parseError = GET_INTEGER_VALUE(argIndex, optname, maxDepth);
+					if (OPTION_OK != parseError) {
+						parseErrorOption = VMOPT_XXALLOCATIONPROFILERDEPTH_EQUALS;
+						goto _memParseError;
+					}
+				}
+				if (NULL == allocationProfilerNew(vm, interval, maxDepth)) {
+					goto _error;
+				}
+			}
+
+			argIndex = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXPARALLELJVMTIHEAPITERATION, NULL);
+			argIndex2 = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXNOPARALLELJVMTIHEAPITERATION, NULL);
+
+			/* Agent callbacks run concurrently on the GC worker threads, so this is disabled by default */
+			if (argIndex > argIndex2) {
+				vm->extendedRuntimeFlags2 |= J9_EXTENDED_RUNTIME2_PARALLEL_JVMTI_HEAP_ITERATION;
+			}
+
 			parseError = setMemoryOptionToOptElse(vm, &(vm->directByteBufferMemoryMax),
 					VMOPT_XXMAXDIRECTMEMORYSIZEEQUALS, (UDATA) -1, TRUE);
 			if (OPTION_OK != parseError) {
@@ -2429,6 +2534,11 @@ IDATA VMInitStages(J9JavaVM *vm, IDATA stage, void* reserved) {
 				goto _error;
 			}
 #endif /* J9VM_INTERP_ATOMIC_FREE_JNI_USES_FLUSH */
+			if (NULL != vm->allocationProfiler) {
+				if (0 != allocationProfilerStart(vm->mainThread)) {
+					goto _error;
+				}
+			}
 			TRIGGER_J9HOOK_VM_ABOUT_TO_BOOTSTRAP(vm->hookInterface, vm->mainThread);
 			/* At this point, the decision about which interpreter to use has been made */
 			vm->bytecodeLoop = J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_DEBUG_MODE)
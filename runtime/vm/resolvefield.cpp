@@ -87,11 +87,19 @@ findField(J9VMThread *vmStruct, J9Class *clazz, U_8 *fieldName, UDATA fieldNameL
 #endif
 	J9Class* currentClass = clazz;
 	J9ROMFieldShape* field;
+	J9FieldResolutionCache *cache = J9VMTHREAD_JAVAVM(vmStruct)->fieldResolutionCache;
 
 #ifdef J9VM_INTERP_TRACING
 	j9tty_printf(PORTLIB, "findField - %.*s %.*s\n", fieldNameLength, fieldName, signatureLength, signature);
 #endif
 
+	if (NULL != cache) {
+		field = fieldResolutionCacheLookup(cache, clazz, fieldName, fieldNameLength, signature, signatureLength, definingClass, offsetOrAddress);
+		if (field != NULL) {
+			return field;
+		}
+	}
+
 	do {        
 		J9ROMClass* romClass = NULL;
 		J9SRP *interfaces = NULL;
@@ -103,7 +111,7 @@ findField(J9VMThread *vmStruct, J9Class *clazz, U_8 *fieldName, UDATA fieldNameL
 			signature, signatureLength, 
 			offsetOrAddress, definingClass);
 		if (field != NULL) {
-			return field;
+			goto found;
 		}
 
 		/* walk the direct super interfaces, and all of their inherited interfaces */
@@ -124,7 +132,7 @@ findField(J9VMThread *vmStruct, J9Class *clazz, U_8 *fieldName, UDATA fieldNameL
 					signature, signatureLength,
 					offsetOrAddress, definingClass);
 				if (field != NULL) {
-					return field;
+					goto found;
 				}
 				iTable = iTable ? iTable->next : (J9ITable *)interfaceClass->iTable;
 				if (iTable == NULL) break;
@@ -147,6 +155,12 @@ findField(J9VMThread *vmStruct, J9Class *clazz, U_8 *fieldName, UDATA fieldNameL
 	}
 
 	return NULL;
+
+found:
+	if ((NULL != cache) && (NULL != definingClass) && (NULL != offsetOrAddress)) {
+		fieldResolutionCacheStore(cache, clazz, fieldName, fieldNameLength, signature, signatureLength, field, *definingClass, *offsetOrAddress);
+	}
+	return field;
 }
 
 
@@ -1464,6 +1464,13 @@ getLocalsMap(J9StackWalkState * walkState, J9ROMClass * romClass, J9ROMMethod *
 
 #ifdef J9VM_INTERP_STACKWALK_TRACING
 	swPrintf(walkState, 4, "\tUsing local mapper\n");
+#else
+	/* The mapper is part of the key as JVMTI may install the debug local mapper */
+	if ((NULL != vm->stackMapCache)
+	&& stackMapCacheLookup(vm->stackMapCache, J9_STACKMAP_CACHE_LOCALS, romMethod, offsetPC, argTempCount, (UDATA)vm->localMapFunction, result)
+	) {
+		return;
+	}
 #endif
 	errorCode = vm->localMapFunction(PORTLIB, romClass, romMethod, offsetPC, result, vm, j9mapmemory_GetBuffer, j9mapmemory_ReleaseBuffer);
 
@@ -1476,6 +1483,11 @@ getLocalsMap(J9StackWalkState * walkState, J9ROMClass * romClass, J9ROMMethod *
 		Assert_VM_stackMapFailed();
 #endif
 	}
+#ifndef J9VM_INTERP_STACKWALK_TRACING
+	else if (NULL != vm->stackMapCache) {
+		stackMapCacheStore(vm->stackMapCache, J9_STACKMAP_CACHE_LOCALS, romMethod, offsetPC, argTempCount, (UDATA)vm->localMapFunction, result);
+	}
+#endif
 
 	return;
 }
@@ -1486,6 +1498,15 @@ getStackMap(J9StackWalkState * walkState, J9ROMClass * romClass, J9ROMMethod * r
 {
 	PORT_ACCESS_FROM_WALKSTATE(walkState);
 	IDATA errorCode;
+#ifndef J9VM_INTERP_STACKWALK_TRACING
+	J9StackMapCache *stackMapCache = walkState->walkThread->javaVM->stackMapCache;
+
+	if ((NULL != stackMapCache)
+	&& stackMapCacheLookup(stackMapCache, J9_STACKMAP_CACHE_STACK, romMethod, offsetPC, pushCount, 0, result)
+	) {
+		return;
+	}
+#endif
 
 	errorCode = j9stackmap_StackBitsForPC(PORTLIB, offsetPC, romClass, romMethod, result, pushCount, walkState->walkThread->javaVM, j9mapmemory_GetBuffer, j9mapmemory_ReleaseBuffer);
 	if (errorCode < 0) {
@@ -1497,6 +1518,11 @@ getStackMap(J9StackWalkState * walkState, J9ROMClass * romClass, J9ROMMethod * r
 		Assert_VM_stackMapFailed();
 #endif
 	}
+#ifndef J9VM_INTERP_STACKWALK_TRACING
+	else if (NULL != stackMapCache) {
+		stackMapCacheStore(stackMapCache, J9_STACKMAP_CACHE_STACK, romMethod, offsetPC, pushCount, 0, result);
+	}
+#endif
 	return;
 }
 
@@ -97,6 +97,196 @@ fieldIndexTableNew(J9JavaVM* vm, J9PortLibrary *portLib);
 void
 fieldIndexTableFree(J9JavaVM* vm);
 
+/* ---------------- AllocationProfiler.cpp ---------------- */
+
+/**
+* @brief Allocate the allocation profiler and register the hooks which maintain it
+* @param *vm
+* @param interval
+* @param maxDepth
+* @return J9AllocationProfiler *
+*/
+J9AllocationProfiler *
+allocationProfilerNew(J9JavaVM *vm, UDATA interval, UDATA maxDepth);
+
+
+/**
+* @brief Set the allocation sampling interval and start recording samples
+* @param *currentThread
+* @return IDATA
+*/
+IDATA
+allocationProfilerStart(J9VMThread *currentThread);
+
+
+/**
+* @brief
+* @param *vm
+* @return void
+*/
+void
+allocationProfilerFree(J9JavaVM *vm);
+
+/* ---------------- FieldResolutionCache.cpp ---------------- */
+
+/**
+* @brief Allocate the cache of resolved field names and register the hooks which flush it
+* @param *vm
+* @param collectStats
+* @return J9FieldResolutionCache *
+*/
+J9FieldResolutionCache *
+fieldResolutionCacheNew(J9JavaVM *vm, BOOLEAN collectStats);
+
+
+/**
+* @brief
+* @param *vm
+* @return void
+*/
+void
+fieldResolutionCacheFree(J9JavaVM *vm);
+
+
+/**
+* @brief Find the cached field a name and signature resolve to from a class
+* @param *cache
+* @param *clazz
+* @param *fieldName
+* @param fieldNameLength
+* @param *signature
+* @param signatureLength
+* @param **definingClass
+* @param *offsetOrAddress
+* @return J9ROMFieldShape *
+*/
+J9ROMFieldShape *
+fieldResolutionCacheLookup(J9FieldResolutionCache *cache, J9Class *clazz, U_8 *fieldName, UDATA fieldNameLength, U_8 *signature, UDATA signatureLength, J9Class **definingClass, UDATA *offsetOrAddress);
+
+
+/**
+* @brief Record the field a name and signature resolved to from a class
+* @param *cache
+* @param *clazz
+* @param *fieldName
+* @param fieldNameLength
+* @param *signature
+* @param signatureLength
+* @param *field
+* @param *definingClass
+* @param offsetOrAddress
+* @return void
+*/
+void
+fieldResolutionCacheStore(J9FieldResolutionCache *cache, J9Class *clazz, U_8 *fieldName, UDATA fieldNameLength, U_8 *signature, UDATA signatureLength, J9ROMFieldShape *field, J9Class *definingClass, UDATA offsetOrAddress);
+
+/* ---------------- InterpreterInlineCache.cpp ---------------- */
+
+/**
+* @brief Allocate the invokeinterface inline caches and register the hooks which flush them
+* @param *vm
+* @param collectStats
+* @return J9InterpreterInlineCaches *
+*/
+J9InterpreterInlineCaches *
+interpreterInlineCachesNew(J9JavaVM *vm, BOOLEAN collectStats);
+
+
+/**
+* @brief
+* @param *vm
+* @return void
+*/
+void
+interpreterInlineCachesFree(J9JavaVM *vm);
+
+/* ---------------- LookupCache.cpp ---------------- */
+
+/**
+* @brief Allocate a lookup cache and register the hooks which flush it and print its counters
+* @param *vm
+* @param size
+* @param flushHook
+* @param statsHook
+* @return void *
+*/
+void *
+lookupCacheNew(J9JavaVM *vm, UDATA size, J9HookFunction flushHook, J9HookFunction statsHook);
+
+
+/**
+* @brief Unregister the hooks of a lookup cache and free it
+* @param *vm
+* @param *cache
+* @param flushHook
+* @param statsHook
+* @return void
+*/
+void
+lookupCacheFree(J9JavaVM *vm, void *cache, J9HookFunction flushHook, J9HookFunction statsHook);
+
+
+/**
+* @brief Print the hit and miss counters of a lookup cache
+* @param *vm
+* @param *name
+* @param hits
+* @param misses
+* @return void
+*/
+void
+lookupCachePrintStats(J9JavaVM *vm, const char *name, UDATA hits, UDATA misses);
+
+/* ---------------- StackMapCache.cpp ---------------- */
+
+/**
+* @brief Allocate the cache of bytecode local and stack maps and register the hooks which flush it
+* @param *vm
+* @param collectStats
+* @return J9StackMapCache *
+*/
+J9StackMapCache *
+stackMapCacheNew(J9JavaVM *vm, BOOLEAN collectStats);
+
+
+/**
+* @brief
+* @param *vm
+* @return void
+*/
+void
+stackMapCacheFree(J9JavaVM *vm);
+
+
+/**
+* @brief Copy the cached map of a bytecode PC into result
+* @param *cache
+* @param kind
+* @param *romMethod
+* @param offsetPC
+* @param count
+* @param mapper
+* @param *result
+* @return BOOLEAN
+*/
+BOOLEAN
+stackMapCacheLookup(J9StackMapCache *cache, UDATA kind, J9ROMMethod *romMethod, UDATA offsetPC, UDATA count, UDATA mapper, U_32 *result);
+
+
+/**
+* @brief Record the map computed for a bytecode PC
+* @param *cache
+* @param kind
+* @param *romMethod
+* @param offsetPC
+* @param count
+* @param mapper
+* @param *bits
+* @return void
+*/
+void
+stackMapCacheStore(J9StackMapCache *cache, UDATA kind, J9ROMMethod *romMethod, UDATA offsetPC, UDATA count, UDATA mapper, U_32 *bits);
+
 /* ---------------- jniinv.c ---------------- */
 
 /**
@@ -199,6 +389,15 @@ jniParseArguments(J9JavaVM *vm, char *optArg);
 UDATA
 lookupJNINative(J9VMThread *currentThread, J9NativeLibrary *nativeLibrary, J9Method *nativeMethod, char * symbolName, char* argSignature);
 
+/**
+ * Return the JNI global and weak global reference slots cached by a thread
+ * to their pools. The caller must have VM access.
+ *
+ * \param currentThread The thread whose cache is flushed.
+ */
+void
+flushJNIGlobalRefCache(J9VMThread *currentThread);
+
 /* ---------------- logsupport.c ---------------- */
 /**
 * @brief
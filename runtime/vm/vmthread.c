@@ -419,6 +419,7 @@ void threadCleanup(J9VMThread * vmThread, UDATA forkedByVM)
 
 	acquireVMAccess(vmThread);
 	cleanUpAttachedThread(vmThread);
+	flushJNIGlobalRefCache(vmThread);
 	releaseVMAccess(vmThread);
 	
 #if defined(OMR_GC_CONCURRENT_SCAVENGER) && defined(J9VM_ARCH_S390)
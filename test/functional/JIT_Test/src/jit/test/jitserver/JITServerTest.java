@@ -205,6 +205,48 @@ public class JITServerTest {
 		destroyAndCheckProcess(server, serverBuilder);
 	}
 
+	public void testServerPrefetch() throws IOException, InterruptedException {
+		logger.info("running testServerPrefetch: INFO and above level logging enabled");
+
+		redirectProcessOutputs(clientBuilder, "testServerPrefetch.client");
+		redirectProcessOutputs(serverBuilder, "testServerPrefetch.server");
+		serverBuilder.environment().put("TR_PrintJITServerPrefetchStats", "1");
+
+		try {
+			final Process server = startProcess(serverBuilder, "server");
+
+			Thread.sleep(SERVER_START_WAIT_TIME_MS);
+
+			final Process client = startProcess(clientBuilder, "client");
+
+			logger.info("Waiting for " + CLIENT_TEST_TIME_MS + " millis.");
+			Thread.sleep(CLIENT_TEST_TIME_MS);
+
+			logger.info("Stopping client...");
+			destroyAndCheckProcess(client, clientBuilder);
+
+			logger.info("Stopping server...");
+			destroyAndCheckProcess(server, serverBuilder);
+		} finally {
+			serverBuilder.environment().remove("TR_PrintJITServerPrefetchStats");
+		}
+
+		// The server prints the prefetch statistics when it shuts down
+		boolean foundBundles = false;
+		try (Scanner s = new Scanner(serverBuilder.redirectOutput().file())) {
+			while (s.hasNextLine()) {
+				final String line = s.nextLine();
+				if (line.matches("Bundles received: [1-9][0-9]* .*")) {
+					foundBundles = true;
+				}
+			}
+		}
+		if (!foundBundles) {
+			dumpProcessLog(serverBuilder);
+			AssertJUnit.fail("The server did not receive any prefetch bundles with its compilation requests.");
+		}
+	}
+
 	public void testServerGoesDown() throws IOException, InterruptedException {
 		logger.info("running testServerGoesDown: INFO and above level logging enabled");
 
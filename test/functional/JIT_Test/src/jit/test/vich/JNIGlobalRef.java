@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package jit.test.vich;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+import jit.test.vich.utils.Timer;
+
+public class JNIGlobalRef {
+
+	private static Logger logger = Logger.getLogger(JNIGlobalRef.class);
+	Timer timer;
+
+	static {
+		try {
+			System.loadLibrary("j9ben");
+		} catch (UnsatisfiedLinkError e) {}
+	}
+
+	public JNIGlobalRef() {
+		timer = new Timer ();
+	}
+
+	static final int loopCount = 100000;
+	static final int threadCount = 64;
+
+	/**
+	 * Creates and deletes 8 global references to o1, loopCount times.
+	 * @return the number of references which did not refer to o1 while they were live
+	 */
+	public native int globalReference(Object o1, boolean isWeak, int loopCount);
+
+	private void runThreads(final boolean isWeak) throws InterruptedException {
+		Thread[] threads = new Thread[threadCount];
+		final Throwable[] failures = new Throwable[threadCount];
+		for (int i = 0; i < threadCount; i++) {
+			final int index = i;
+			threads[i] = new Thread() {
+				public void run() {
+					try {
+						/* Each thread references its own object so a slot cached across threads is detected */
+						int errors = globalReference(new Object(), isWeak, loopCount);
+						if (0 != errors) {
+							failures[index] = new AssertionError(errors + " invalid global references in " + getName());
+						}
+					} catch (Throwable t) {
+						failures[index] = t;
+					}
+				}
+			};
+		}
+		for (int i = 0; i < threadCount; i++) {
+			threads[i].start();
+		}
+		for (int i = 0; i < threadCount; i++) {
+			threads[i].join();
+		}
+		for (int i = 0; i < threadCount; i++) {
+			if (null != failures[i]) {
+				logger.error("Thread " + i + " failed", failures[i]);
+				Assert.fail("Thread " + i + " failed: " + failures[i]);
+			}
+		}
+	}
+
+	@Test(groups = { "level.sanity","component.jit" })
+	public void testJNIGlobalRef() throws InterruptedException
+	{
+		Object o1 = new Integer(0);
+
+		try
+		{
+			Assert.assertEquals(globalReference(o1, false, 1), 0, "invalid global references");
+			Assert.assertEquals(globalReference(o1, true, 1), 0, "invalid weak global references");
+		} catch (UnsatisfiedLinkError e) {
+			Assert.fail("No natives for JNI tests");
+		}
+
+		timer.reset();
+		int errors = globalReference(o1, false, loopCount);
+		timer.mark();
+		Assert.assertEquals(errors, 0, "invalid global references");
+		logger.info(loopCount + " New/DeleteGlobalRef calls (on 8 refs) = " + timer.delta());
+
+		timer.reset();
+		errors = globalReference(o1, true, loopCount);
+		timer.mark();
+		Assert.assertEquals(errors, 0, "invalid weak global references");
+		logger.info(loopCount + " New/DeleteWeakGlobalRef calls (on 8 refs) = " + timer.delta());
+
+		timer.reset();
+		runThreads(false);
+		timer.mark();
+		logger.info(threadCount + " threads x " + loopCount + " New/DeleteGlobalRef calls (on 8 refs) = " + timer.delta());
+
+		timer.reset();
+		runThreads(true);
+		timer.mark();
+		logger.info(threadCount + " threads x " + loopCount + " New/DeleteWeakGlobalRef calls (on 8 refs) = " + timer.delta());
+	}
+}
@@ -62,13 +62,14 @@ public class TestJcmd extends AttachApiTest {
 	private static final String DUMP_JAVA = "Dump.java";
 	private static final String DUMP_SNAP = "Dump.snap";
 	private static final String DUMP_SYSTEM = "Dump.system";
+	private static final String DUMP_ALLOCPROFILE = "Dump.allocprofile";
 	private static final String GC_CLASS_HISTOGRAM = "GC.class_histogram";
 	private static final String GC_HEAP_DUMP = "GC.heap_dump";
 	private static final String GC_RUN = "GC.run";
 	private static final String HELP_COMMAND = "help";
 	private static final String THREAD_PRINT = "Thread.print";
 	private static String[] JCMD_COMMANDS = {DUMP_HEAP, DUMP_JAVA, DUMP_SNAP,
-		DUMP_SYSTEM, GC_CLASS_HISTOGRAM, GC_HEAP_DUMP, GC_RUN, HELP_COMMAND, THREAD_PRINT};
+		DUMP_SYSTEM, DUMP_ALLOCPROFILE, GC_CLASS_HISTOGRAM, GC_HEAP_DUMP, GC_RUN, HELP_COMMAND, THREAD_PRINT};
 	private static String[] JCMD_COMMANDS_REQUIRE_OPTION = {GC_CLASS_HISTOGRAM, GC_RUN, HELP_COMMAND, THREAD_PRINT};
 	private static String[] JCMD_COMMANDS_DUMP = {DUMP_HEAP, DUMP_JAVA, DUMP_SNAP, DUMP_SYSTEM, GC_HEAP_DUMP};
 
@@ -0,0 +1,178 @@
+package j9vm.test.benchmark.classloading;
+
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.atomic.AtomicBoolean;
+import java.util.concurrent.atomic.AtomicReference;
+
+/**
+ * Measures the throughput of class table lookups made concurrently by several threads.
+ * Each thread calls findLoadedClass on a loader which defined the classes being looked
+ * up, so every lookup is answered from that loader's class table. Half of the names are
+ * not loaded, which exercises the lookup misses.
+ *
+ * Prints "FAILED" and exits with a non-zero status if a lookup returns the wrong answer.
+ *
+ * Usage: FindLoadedClassBenchmark [threads [seconds]]
+ */
+public class FindLoadedClassBenchmark {
+
+	/* Classes defined again by the peeking loader; the names must match the nested classes below */
+	private static final String[] LOADED_CLASS_NAMES = {
+		"j9vm.test.benchmark.classloading.FindLoadedClassBenchmark$TargetA",
+		"j9vm.test.benchmark.classloading.FindLoadedClassBenchmark$TargetB",
+		"j9vm.test.benchmark.classloading.FindLoadedClassBenchmark$TargetC",
+		"j9vm.test.benchmark.classloading.FindLoadedClassBenchmark$TargetD",
+		"j9vm.test.benchmark.classloading.FindLoadedClassBenchmark$TargetE",
+		"j9vm.test.benchmark.classloading.FindLoadedClassBenchmark$TargetF",
+		"j9vm.test.benchmark.classloading.FindLoadedClassBenchmark$TargetG",
+		"j9vm.test.benchmark.classloading.FindLoadedClassBenchmark$TargetH",
+	};
+
+	private static final String[] MISSING_CLASS_NAMES = {
+		"j9vm.test.benchmark.classloading.FindLoadedClassBenchmark$Target",
+		"j9vm.test.benchmark.classloading.FindLoadedClassBenchmark$TargetBX",
+		"j9vm.test.benchmark.classloading.FindLoadedClassBenchmark$TargetI",
+		"j9vm.test.benchmark.classloading.FindLoadedClassBenchmark$targetD",
+		"org.openj9.missing.FindLoadedClassBenchmark$TargetE",
+		"org.openj9.missing.TargetF",
+		"java.lang.FindLoadedClassBenchmark$TargetG",
+		"TargetH",
+	};
+
+	static class TargetA {}
+	static class TargetB {}
+	static class TargetC {}
+	static class TargetD {}
+	static class TargetE {}
+	static class TargetF {}
+	static class TargetG {}
+	static class TargetH {}
+
+	/**
+	 * Defines its own copies of the target classes, so that they are in its class table.
+	 */
+	static class PeekingClassLoader extends ClassLoader {
+		PeekingClassLoader(ClassLoader parent) {
+			super(parent);
+		}
+
+		Class<?> define(String name) throws IOException {
+			String resourceName = name.replace('.', '/') + ".class";
+			InputStream in = getParent().getResourceAsStream(resourceName);
+			if (null == in) {
+				throw new IOException(resourceName + " not found");
+			}
+			try {
+				ByteArrayOutputStream bytes = new ByteArrayOutputStream();
+				byte[] buffer = new byte[4096];
+				for (int count = in.read(buffer); count > 0; count = in.read(buffer)) {
+					bytes.write(buffer, 0, count);
+				}
+				return defineClass(name, bytes.toByteArray(), 0, bytes.size());
+			} finally {
+				in.close();
+			}
+		}
+
+		Class<?> peek(String name) {
+			return findLoadedClass(name);
+		}
+	}
+
+	public static void main(String[] args) throws Exception {
+		int threadCount = (args.length > 0) ? Integer.parseInt(args[0]) : Runtime.getRuntime().availableProcessors();
+		int seconds = (args.length > 1) ? Integer.parseInt(args[1]) : 5;
+		final PeekingClassLoader loader = new PeekingClassLoader(FindLoadedClassBenchmark.class.getClassLoader());
+
+		for (String name : LOADED_CLASS_NAMES) {
+			Class<?> defined = loader.define(name);
+			if (loader.peek(name) != defined) {
+				System.out.println("FAILED: " + name + " is not in the class table of its defining loader");
+				System.exit(1);
+			}
+		}
+
+		final AtomicBoolean stop = new AtomicBoolean(false);
+		final AtomicReference<Throwable> failure = new AtomicReference<Throwable>();
+		final CountDownLatch start = new CountDownLatch(1);
+		final long[] lookups = new long[threadCount];
+		Thread[] threads = new Thread[threadCount];
+
+		for (int i = 0; i < threadCount; ++i) {
+			final int id = i;
+			threads[i] = new Thread("FindLoadedClassBenchmark-" + i) {
+				public void run() {
+					long count = 0;
+					try {
+						start.await();
+						while (!stop.get()) {
+							for (int j = 0; j < LOADED_CLASS_NAMES.length; ++j) {
+								if (null == loader.peek(LOADED_CLASS_NAMES[j])) {
+									throw new RuntimeException(LOADED_CLASS_NAMES[j] + " not found");
+								}
+								if (null != loader.peek(MISSING_CLASS_NAMES[j])) {
+									throw new RuntimeException(MISSING_CLASS_NAMES[j] + " found");
+								}
+							}
+							count += LOADED_CLASS_NAMES.length + MISSING_CLASS_NAMES.length;
+						}
+					} catch (Throwable t) {
+						failure.compareAndSet(null, t);
+						stop.set(true);
+					}
+					lookups[id] = count;
+				}
+			};
+			threads[i].start();
+		}
+
+		long startTime = System.nanoTime();
+		start.countDown();
+		for (long waited = 0; (waited < seconds * 1000L) && !stop.get(); waited += 100) {
+			Thread.sleep(100);
+		}
+		stop.set(true);
+		for (Thread thread : threads) {
+			thread.join();
+		}
+		long endTime = System.nanoTime();
+
+		if (null != failure.get()) {
+			System.out.println("FAILED: " + failure.get());
+			System.exit(1);
+		}
+
+		long total = 0;
+		for (long count : lookups) {
+			total += count;
+		}
+		double elapsedSeconds = (endTime - startTime) / 1e9;
+		System.out.println(threadCount + " threads did " + total + " lookups in " + (endTime - startTime) + " nanoseconds");
+		System.out.println("Throughput: " + (long)(total / elapsedSeconds) + " lookups per second");
+	}
+}
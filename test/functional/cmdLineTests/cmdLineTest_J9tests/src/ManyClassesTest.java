@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.util.ArrayList;
+import java.util.List;
+
+/**
+ * @file ManyClassesTest.java
+ * @brief Defines the same class in many class loaders and keeps all of them alive,
+ *        so that the JIT sees more classes than its class hierarchy table initially holds.
+ */
+
+class ManyClassesTest {
+    static class Leaf {
+        public int value() {
+            return 42;
+        }
+    }
+
+    private static final String LEAF_NAME = Leaf.class.getName();
+
+    static class LeafLoader extends ClassLoader {
+        private final byte[] bytes;
+
+        LeafLoader(byte[] bytes) {
+            super(ManyClassesTest.class.getClassLoader());
+            this.bytes = bytes;
+        }
+
+        protected synchronized Class<?> loadClass(String name, boolean resolve) throws ClassNotFoundException {
+            if (LEAF_NAME.equals(name)) {
+                Class<?> clazz = findLoadedClass(name);
+                if (null == clazz) {
+                    clazz = defineClass(name, bytes, 0, bytes.length);
+                }
+                return clazz;
+            }
+            return super.loadClass(name, resolve);
+        }
+    }
+
+    private static byte[] leafBytes() throws IOException {
+        String resource = LEAF_NAME.replace('.', '/') + ".class";
+        InputStream in = ManyClassesTest.class.getClassLoader().getResourceAsStream(resource);
+        ByteArrayOutputStream out = new ByteArrayOutputStream();
+        byte[] buffer = new byte[4096];
+        int count = 0;
+        try {
+            while (-1 != (count = in.read(buffer))) {
+                out.write(buffer, 0, count);
+            }
+        } finally {
+            in.close();
+        }
+        return out.toByteArray();
+    }
+
+    public static void main(String[] args) throws Exception {
+        int classCount = Integer.parseInt(args[0]);
+        byte[] bytes = leafBytes();
+        List<Class<?>> classes = new ArrayList<Class<?>>(classCount);
+
+        for (int i = 0; i < classCount; i++) {
+            Class<?> clazz = new LeafLoader(bytes).loadClass(LEAF_NAME);
+            if (Leaf.class == clazz) {
+                System.out.println("FAILED: class " + i + " was not defined by its own loader");
+                System.exit(1);
+            }
+            classes.add(clazz);
+        }
+        System.out.println("Loaded " + classes.size() + " classes");
+        System.out.println("Test ran to completion");
+    }
+}
@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file ThrowSiteLimitTest.java
+ * @brief Throws repeatedly from deep stacks to test the command line option
+ *        -XX:StackTraceThrowSiteLimit=. The first traces of a throw site are complete,
+ *        later ones only keep the top frames. Run with -Xint so that no frames are inlined.
+ */
+
+class ThrowSiteLimitTest {
+    private static final int DEPTH = 40;
+    private static final int LIMITED_FRAMES = 8;
+
+    private static void throwFirst(int depth) {
+        if (0 == depth) {
+            throw new IllegalStateException("first");
+        }
+        throwFirst(depth - 1);
+    }
+
+    private static void throwSecond(int depth) {
+        if (0 == depth) {
+            throw new IllegalArgumentException("second");
+        }
+        throwSecond(depth - 1);
+    }
+
+    private static int traceLength(boolean first) {
+        try {
+            if (first) {
+                throwFirst(DEPTH);
+            } else {
+                throwSecond(DEPTH);
+            }
+        } catch (RuntimeException e) {
+            return e.getStackTrace().length;
+        }
+        throw new RuntimeException("nothing was thrown");
+    }
+
+    private static void fail(String message) {
+        System.out.println("FAILED: " + message);
+        System.exit(1);
+    }
+
+    public static void main(String[] args) {
+        int limit = Integer.parseInt(args[0]);
+
+        for (int i = 0; i < (3 * limit); i++) {
+            int length = traceLength(true);
+            if ((i < limit) && (length <= DEPTH)) {
+                fail("trace " + i + " has " + length + " frames, it should be complete");
+            }
+            if ((i >= limit) && (length > LIMITED_FRAMES)) {
+                fail("trace " + i + " has " + length + " frames, it should be truncated");
+            }
+        }
+        /* Another throw site has its own count */
+        int length = traceLength(false);
+        if (length <= DEPTH) {
+            fail("the first trace of another site has " + length + " frames, it should be complete");
+        }
+        System.out.println("Test ran to completion");
+    }
+}
@@ -0,0 +1,58 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+import java.util.Arrays;
+
+/**
+ * Allocates arrays large enough to be stored in arraylet leaves, checks that every element is zero, then dirties
+ * them and lets them die so that their leaf regions are freed and reused. Run with
+ * -XXgc:tarokEnableFreeRegionZeroing, the leaves are mostly regions zeroed in the background.
+ */
+public class ArrayletZeroing
+{
+	private static final int RETAINED_ARRAYS = 8;
+	private static final int ARRAY_LENGTH = 1024 * 1024;
+
+	/**
+	 * @param args Takes one optional argument: the number of arrays to allocate (default 2000).
+	 */
+	public static void main(String[] args)
+	{
+		int iterations = (1 == args.length) ? Integer.parseInt(args[0]) : 2000;
+		long[][] retained = new long[RETAINED_ARRAYS][];
+
+		for (int i = 0; i < iterations; i++) {
+			long[] array = new long[ARRAY_LENGTH];
+			for (int j = 0; j < ARRAY_LENGTH; j++) {
+				if (0 != array[j]) {
+					System.out.println("FAILED: element " + j + " of array " + i + " is " + array[j]);
+					System.exit(1);
+				}
+			}
+			/* leave garbage behind for the next array which reuses these regions */
+			Arrays.fill(array, -1L);
+			retained[i % RETAINED_ARRAYS] = array;
+		}
+		System.out.println("Test ran to completion");
+	}
+}
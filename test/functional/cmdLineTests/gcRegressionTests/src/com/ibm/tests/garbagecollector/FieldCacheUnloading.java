@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+
+/**
+ * Loads two classes with the same field name and signature but different field offsets, alternately and each from
+ * a new class loader which is then dropped, so that the VM unloads one class and may allocate the next at the same
+ * address. Field resolution must never return the offset cached for the unloaded class. Best run with
+ * -Xalwaysclassgc.
+ */
+public class FieldCacheUnloading
+{
+	private static final long SENTINEL = 0x5A5A5A5A5A5A5A5AL;
+
+	public interface ValueHolder
+	{
+		void setValue(int value);
+		boolean check(int value);
+	}
+
+	public static class Small implements ValueHolder
+	{
+		int value;
+
+		public void setValue(int value) {
+			this.value = value;
+		}
+
+		public boolean check(int value) {
+			return this.value == value;
+		}
+	}
+
+	public static class Large implements ValueHolder
+	{
+		long pad0 = SENTINEL;
+		long pad1 = SENTINEL;
+		long pad2 = SENTINEL;
+		long pad3 = SENTINEL;
+		int value;
+
+		public void setValue(int value) {
+			this.value = value;
+		}
+
+		public boolean check(int value) {
+			return (this.value == value) && (SENTINEL == pad0) && (SENTINEL == pad1) && (SENTINEL == pad2) && (SENTINEL == pad3);
+		}
+	}
+
+	/**
+	 * Defines its own copy of one class, delegating everything else to its parent.
+	 */
+	static class DefiningClassLoader extends ClassLoader
+	{
+		DefiningClassLoader() {
+			super(FieldCacheUnloading.class.getClassLoader());
+		}
+
+		Class<?> define(String name) throws IOException {
+			InputStream in = getParent().getResourceAsStream(name.replace('.', '/') + ".class");
+			try {
+				ByteArrayOutputStream bytes = new ByteArrayOutputStream();
+				byte[] buffer = new byte[4096];
+				for (int count = in.read(buffer); count > 0; count = in.read(buffer)) {
+					bytes.write(buffer, 0, count);
+				}
+				return defineClass(name, bytes.toByteArray(), 0, bytes.size());
+			} finally {
+				in.close();
+			}
+		}
+	}
+
+	private static boolean test(String className, int value) throws Exception
+	{
+		Class<?> clazz = new DefiningClassLoader().define(className);
+		ValueHolder holder = (ValueHolder)clazz.newInstance();
+
+		/* resolve the field from bytecode, then by reflection */
+		holder.setValue(value);
+		if (!holder.check(value)) {
+			System.out.println("FAILED: " + className + " field resolved to the wrong offset");
+			return false;
+		}
+		if (value != clazz.getDeclaredField("value").getInt(holder)) {
+			System.out.println("FAILED: " + className + " reflected field resolved to the wrong offset");
+			return false;
+		}
+		return true;
+	}
+
+	/**
+	 * @param args Takes one optional argument: the number of classes to load (default 500).
+	 */
+	public static void main(String[] args) throws Exception
+	{
+		int iterations = (1 == args.length) ? Integer.parseInt(args[0]) : 500;
+
+		for (int i = 0; i < iterations; i++) {
+			String className = (0 == (i % 2)) ? Small.class.getName() : Large.class.getName();
+			if (!test(className, i)) {
+				System.exit(1);
+			}
+			System.gc();
+		}
+		System.out.println("Test ran to completion");
+	}
+}
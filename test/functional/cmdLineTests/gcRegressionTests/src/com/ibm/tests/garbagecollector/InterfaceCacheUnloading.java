@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+/**
+ * Calls an interface method through one invokeinterface call site on receivers of two classes which place
+ * the method in different vTable slots, each class defined by a new class loader which is then dropped. The
+ * VM may unload one class and allocate the next at the same address, so the interpreter inline caches must
+ * never dispatch through the slot cached for the unloaded class. A receiver of a class which is never
+ * unloaded keeps the call site polymorphic. Best run with -Xint -Xalwaysclassgc.
+ */
+public class InterfaceCacheUnloading
+{
+	private static final int CALLS = 100;
+
+	public interface Answer
+	{
+		int answer();
+	}
+
+	public interface Padding
+	{
+		int pad0();
+		int pad1();
+		int pad2();
+	}
+
+	public static class Few implements Answer
+	{
+		public int answer() {
+			return 1;
+		}
+	}
+
+	public static class Many implements Padding, Answer
+	{
+		public int pad0() {
+			return -1;
+		}
+
+		public int pad1() {
+			return -1;
+		}
+
+		public int pad2() {
+			return -1;
+		}
+
+		public int answer() {
+			return 2;
+		}
+	}
+
+	public static class Persistent implements Answer
+	{
+		public int answer() {
+			return 3;
+		}
+	}
+
+	private static int call(Answer answer)
+	{
+		return answer.answer();
+	}
+
+	private static boolean test(String className, int expected) throws Exception
+	{
+		Class<?> clazz = new FieldCacheUnloading.DefiningClassLoader().define(className);
+		Answer answer = (Answer)clazz.newInstance();
+		Answer persistent = new Persistent();
+
+		for (int i = 0; i < CALLS; i++) {
+			if (expected != call(answer)) {
+				System.out.println("FAILED: " + className + " dispatched to the wrong method");
+				return false;
+			}
+			if (3 != call(persistent)) {
+				System.out.println("FAILED: " + Persistent.class.getName() + " dispatched to the wrong method");
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * @param args Takes one optional argument: the number of classes to load (default 500).
+	 */
+	public static void main(String[] args) throws Exception
+	{
+		int iterations = (1 == args.length) ? Integer.parseInt(args[0]) : 500;
+
+		for (int i = 0; i < iterations; i++) {
+			boolean few = (0 == (i % 2));
+			if (!test(few ? Few.class.getName() : Many.class.getName(), few ? 1 : 2)) {
+				System.exit(1);
+			}
+			System.gc();
+		}
+		System.out.println("Test ran to completion");
+	}
+}
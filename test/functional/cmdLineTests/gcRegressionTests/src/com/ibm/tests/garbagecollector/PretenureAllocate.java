@@ -0,0 +1,52 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+/**
+ * Allocates arrays of this class which outlive many scavenges, mixed with short lived garbage, so that the
+ * scavenger copies almost all of their bytes again and again. Run with -Xgc:scvPretenure, the array class
+ * should be pretenured, which shows in the pretenured element of the verbose GC output.
+ */
+public class PretenureAllocate
+{
+	private static final int RETAINED_ARRAYS = 4000;
+	private static final int ARRAY_LENGTH = 256;
+	private static final int GARBAGE_BYTES = 60000;
+
+	public static Object _garbageHolder;
+
+	/**
+	 * @param args Takes one optional argument: the number of long lived arrays to allocate (default 100000).
+	 */
+	public static void main(String[] args)
+	{
+		int iterations = (1 == args.length) ? Integer.parseInt(args[0]) : 100000;
+		PretenureAllocate[][] retained = new PretenureAllocate[RETAINED_ARRAYS][];
+
+		for (int i = 0; i < iterations; i++) {
+			/* each array stays reachable for RETAINED_ARRAYS iterations, far longer than the interval between scavenges */
+			retained[i % RETAINED_ARRAYS] = new PretenureAllocate[ARRAY_LENGTH];
+			_garbageHolder = new byte[GARBAGE_BYTES];
+		}
+		System.out.println("Test ran to completion");
+	}
+}
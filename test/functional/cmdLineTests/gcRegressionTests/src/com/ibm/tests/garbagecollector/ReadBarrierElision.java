@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+/**
+ * Repeatedly loads the same reference field within a block, and loads fields of objects just allocated,
+ * while short lived garbage keeps concurrent scavenges running. These are the loads whose read barriers
+ * the JIT elides. Any load which returns an evacuated object shows as a wrong value, and with
+ * TR_verifyReadBarrierElision set as a trap. Run with -Xgc:concurrentScavenge.
+ */
+public class ReadBarrierElision
+{
+	private static final int HOLDERS = 20000;
+	private static final int GARBAGE_BYTES = 1000;
+
+	public static Object _garbageHolder;
+
+	static class Value
+	{
+		final int value;
+
+		Value(int value)
+		{
+			this.value = value;
+		}
+	}
+
+	static class Holder
+	{
+		Value first;
+		Value second;
+	}
+
+	/*
+	 * The second load of holder.first follows a barriered load of the same slot with no GC point between.
+	 * The store to scratch.first may alias it, so the two loads are not commoned.
+	 */
+	static int readSameSlot(Holder holder, Holder scratch)
+	{
+		int sum = holder.first.value;
+		scratch.first = holder.second;
+		return sum + holder.first.value;
+	}
+
+	/* the loads from the new holder can only see references stored after it was allocated */
+	static int readNewObject(Value first, Value second)
+	{
+		Holder holder = new Holder();
+		holder.first = first;
+		holder.second = second;
+		return holder.first.value + holder.second.value;
+	}
+
+	/**
+	 * @param args Takes one optional argument: the number of iterations (default 2000000).
+	 */
+	public static void main(String[] args)
+	{
+		int iterations = (1 == args.length) ? Integer.parseInt(args[0]) : 2000000;
+		Holder[] holders = new Holder[HOLDERS];
+		Holder scratch = new Holder();
+
+		for (int i = 0; i < HOLDERS; i++) {
+			holders[i] = new Holder();
+			holders[i].first = new Value(i);
+			holders[i].second = new Value(-i);
+		}
+
+		for (int i = 0; i < iterations; i++) {
+			int index = i % HOLDERS;
+			Holder holder = holders[index];
+			if ((2 * index) != readSameSlot(holder, scratch)) {
+				System.out.println("FAILED: holder " + index + " read the wrong value");
+				System.exit(1);
+			}
+			if (0 != readNewObject(holder.first, holder.second)) {
+				System.out.println("FAILED: new holder for " + index + " read the wrong value");
+				System.exit(1);
+			}
+			/* move the values so that scavenges keep copying them */
+			if (0 == (i % 7)) {
+				holder.first = new Value(index);
+				holder.second = new Value(-index);
+			}
+			_garbageHolder = new byte[GARBAGE_BYTES];
+		}
+		System.out.println("Test ran to completion");
+	}
+}
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+/**
+ * Runs global collections from the bottom of deep interpreted stacks whose frames keep objects in
+ * locals and on the operand stack, at the same PCs every time. The collector finds those objects
+ * through the cached local and stack maps, so a wrong map loses or corrupts them.
+ * Best run with -Xint.
+ */
+public class StackMapCacheWalk
+{
+	private static final int DEPTH = 200;
+
+	static class Node
+	{
+		final int value;
+		final Node next;
+
+		Node(int value, Node next) {
+			this.value = value;
+			this.next = next;
+		}
+	}
+
+	private static int check(Node node, int expected, int below)
+	{
+		if ((null == node) || (expected != node.value)) {
+			throw new IllegalStateException("local object lost at depth " + expected);
+		}
+		return below + 1;
+	}
+
+	/**
+	 * Holds a Node in a local and another on the operand stack across the recursive call.
+	 */
+	private static int descend(int depth, Node chain)
+	{
+		Node local = new Node(depth, chain);
+		long wide = depth;
+		if (0 == depth) {
+			Object[] garbage = new Object[64];
+			for (int i = 0; i < garbage.length; i++) {
+				garbage[i] = new int[256];
+			}
+			System.gc();
+			return check(local, 0, 0);
+		}
+		int below = check(local, depth, descend(depth - 1, local));
+		if (wide != local.value) {
+			throw new IllegalStateException("primitive local corrupted at depth " + depth);
+		}
+		return below;
+	}
+
+	/**
+	 * @param args Takes one optional argument: the number of walks (default 50).
+	 */
+	public static void main(String[] args)
+	{
+		int iterations = (1 == args.length) ? Integer.parseInt(args[0]) : 50;
+
+		for (int i = 0; i < iterations; i++) {
+			Node root = new Node(-1, null);
+			int frames = descend(DEPTH, root);
+			if ((DEPTH + 1) != frames) {
+				System.out.println("FAILED: returned through " + frames + " frames, expected " + (DEPTH + 1));
+				System.exit(1);
+			}
+			if (-1 != root.value) {
+				System.out.println("FAILED: root object corrupted");
+				System.exit(1);
+			}
+		}
+		System.out.println("Test ran to completion");
+	}
+}
@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+/**
+ * Keeps many Strings with a few distinct values alive across many copying collections, so that
+ * -Xgc:stringDeduplication finds duplicates among them, then checks that every String still has its value.
+ */
+public class StringDeduplicationAllocate
+{
+	private static final int DISTINCT_VALUES = 16;
+	private static final int GARBAGE_BYTES = 60000;
+	private static final int ROUNDS = 20;
+	private static final int GARBAGE_PER_ROUND = 1000;
+
+	public static Object _garbageHolder;
+
+	/**
+	 * @param args Takes one optional argument: the number of long lived Strings to allocate (default 20000).
+	 */
+	public static void main(String[] args)
+	{
+		int count = (1 == args.length) ? Integer.parseInt(args[0]) : 20000;
+		String[] expected = new String[DISTINCT_VALUES];
+		for (int i = 0; i < DISTINCT_VALUES; i++) {
+			expected[i] = "String deduplication test value " + i;
+		}
+
+		String[] retained = new String[count];
+		for (int i = 0; i < count; i++) {
+			/* each String gets its own copy of the value */
+			retained[i] = new String(expected[i % DISTINCT_VALUES].toCharArray());
+		}
+
+		for (int round = 0; round < ROUNDS; round++) {
+			for (int i = 0; i < GARBAGE_PER_ROUND; i++) {
+				_garbageHolder = new byte[GARBAGE_BYTES];
+			}
+			/* give the deduplication thread time to work through the Strings queued by the collections */
+			try {
+				Thread.sleep(50);
+			} catch (InterruptedException e) {
+				/* the sleep is only a hint */
+			}
+		}
+
+		for (int i = 0; i < count; i++) {
+			String value = expected[i % DISTINCT_VALUES];
+			if (!value.equals(retained[i]) || (value.hashCode() != retained[i].hashCode())) {
+				System.out.println("FAILED: String " + i + " is \"" + retained[i] + "\" rather than \"" + value + "\"");
+				System.exit(1);
+			}
+		}
+		System.out.println("Test ran to completion");
+	}
+}
@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+import java.io.File;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+/**
+ * Round trip of a binary verbose GC log through com.ibm.jvm.format.VerboseGCFormat.
+ * Run without arguments under -Xgc:verboseBinary,fvtest_verboseBinaryTextCopy, it
+ * triggers a number of explicit collections. Run with the name of the log that JVM
+ * wrote, it formats the log and checks that the result is identical to the text copy
+ * the same JVM wrote next to it, and that each collection is reported as a cycle end
+ * matched to a cycle start.
+ * The formatter is in a package which is not exported, so the second run needs
+ * --add-exports=openj9.traceformat/com.ibm.jvm.format=ALL-UNNAMED on Java 9 and later.
+ */
+public class VerboseBinaryRoundTrip
+{
+	private static final int COLLECTIONS = 5;
+
+	private static final Pattern CYCLE = Pattern.compile(
+			"<cycle-(start|end) id=\"(\\d+)\" type=\"([^\"]+)\" timestamp=\"[^\"]+\"( contextid=\"(\\d+)\" durationms=\"[0-9.]+\")?"
+			+ " nursery-free=\"(\\d+)\" nursery-total=\"(\\d+)\" tenure-free=\"(\\d+)\" tenure-total=\"(\\d+)\" />");
+
+	public static void main(String[] args) throws Throwable
+	{
+		if (0 == args.length) {
+			for (int i = 0; i < COLLECTIONS; i++) {
+				System.gc();
+			}
+			System.out.println("Test ran to completion");
+			return;
+		}
+
+		File text = File.createTempFile("verbosebinary", ".log");
+		text.deleteOnExit();
+		File xml = File.createTempFile("verbosebinary", ".xml");
+		xml.deleteOnExit();
+		Class<?> formatter = Class.forName("com.ibm.jvm.format.VerboseGCFormat");
+		formatter.getMethod("main", String[].class).invoke(null, (Object)new String[] { args[0], text.getPath() });
+		formatter.getMethod("main", String[].class).invoke(null, (Object)new String[] { "-cycles", args[0], xml.getPath() });
+
+		String failure = compare(Files.readAllBytes(text.toPath()), Files.readAllBytes(new File(args[0] + ".txt").toPath()));
+		if (null == failure) {
+			failure = check(Files.readAllLines(xml.toPath(), StandardCharsets.UTF_8));
+		}
+		if (null != failure) {
+			System.out.println("FAILED: " + failure);
+			System.exit(1);
+		}
+		System.out.println("Test ran to completion");
+	}
+
+	private static String compare(byte[] formatted, byte[] expected)
+	{
+		if (0 == expected.length) {
+			return "the text copy of the log is empty";
+		}
+		if (!new String(formatted, StandardCharsets.UTF_8).contains("<verbosegc ")) {
+			return "the formatted log has no <verbosegc> element";
+		}
+		int length = Math.min(formatted.length, expected.length);
+		for (int i = 0; i < length; i++) {
+			if (formatted[i] != expected[i]) {
+				return "the formatted log differs from the text copy at byte " + i;
+			}
+		}
+		if (formatted.length != expected.length) {
+			return "the formatted log has " + formatted.length + " bytes but the text copy has " + expected.length;
+		}
+		return null;
+	}
+
+	private static String check(List<String> lines)
+	{
+		if (lines.size() < 2) {
+			return "the formatted log is empty";
+		}
+		if (!lines.get(0).startsWith("<?xml")) {
+			return "the formatted log does not start with an XML declaration: " + lines.get(0);
+		}
+		if (!lines.get(lines.size() - 1).equals("</verbosegc>")) {
+			return "the formatted log does not end with </verbosegc>";
+		}
+
+		Map<String, Long> openCycles = new HashMap<>();
+		long lastId = -1;
+		int cycleEnds = 0;
+		for (String line : lines) {
+			if (!line.startsWith("<cycle-")) {
+				continue;
+			}
+			Matcher matcher = CYCLE.matcher(line);
+			if (!matcher.matches()) {
+				return "malformed record: " + line;
+			}
+			long id = Long.parseLong(matcher.group(2));
+			if (id <= lastId) {
+				return "records are out of order: " + line;
+			}
+			lastId = id;
+			if ((Long.parseLong(matcher.group(6)) > Long.parseLong(matcher.group(7)))
+				|| (Long.parseLong(matcher.group(8)) > Long.parseLong(matcher.group(9)))
+			) {
+				return "more free than total memory: " + line;
+			}
+			String type = matcher.group(3);
+			if ("start".equals(matcher.group(1))) {
+				openCycles.put(type, Long.valueOf(id));
+			} else {
+				Long startId = openCycles.remove(type);
+				if ((null == startId) || (null == matcher.group(5)) || (startId.longValue() != Long.parseLong(matcher.group(5)))) {
+					return "cycle end without a matching start: " + line;
+				}
+				cycleEnds += 1;
+			}
+		}
+		if (cycleEnds < COLLECTIONS) {
+			return "expected at least " + COLLECTIONS + " cycles but found " + cycleEnds;
+		}
+		return null;
+	}
+}